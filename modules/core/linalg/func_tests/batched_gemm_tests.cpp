@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/batched_gemm.hpp"
+#include "core/linalg/include/gemm.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> RandomValues(std::size_t count, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(-1, 1);
+  std::vector<T> values(count);
+  for (auto &value : values) {
+    value = dist(gen);
+  }
+  return values;
+}
+
+// A strided batch of m x k by k x n products. Rows and matrices are padded, so that a kernel that
+// ignores the strides reads or writes the wrong elements.
+struct Batch {
+  Batch(std::size_t batch, std::size_t rows, std::size_t cols, std::size_t inner)
+      : count(batch),
+        m(rows),
+        n(cols),
+        k(inner),
+        lda(inner + 1),
+        ldb(cols + 2),
+        ldc(cols + 3),
+        stride_a((rows * lda) + 5),
+        stride_b((inner * ldb) + 6),
+        stride_c((rows * ldc) + 7),
+        a(RandomValues<double>(batch * stride_a, 1)),
+        b(RandomValues<double>(batch * stride_b, 2)),
+        c(RandomValues<double>(batch * stride_c, 3)) {}
+
+  // C of the product i as the naive loops compute it from the initial c
+  [[nodiscard]] std::vector<double> Expected(std::size_t i, double alpha, double beta) const {
+    std::vector<double> expected(c.begin() + static_cast<std::ptrdiff_t>(i * stride_c),
+                                 c.begin() + static_cast<std::ptrdiff_t>((i + 1) * stride_c));
+    for (std::size_t r = 0; r < m; ++r) {
+      for (std::size_t j = 0; j < n; ++j) {
+        double sum = 0.0;
+        for (std::size_t p = 0; p < k; ++p) {
+          sum += a[(i * stride_a) + (r * lda) + p] * b[(i * stride_b) + (p * ldb) + j];
+        }
+        expected[(r * ldc) + j] = (alpha * sum) + (beta == 0.0 ? 0.0 : beta * expected[(r * ldc) + j]);
+      }
+    }
+    return expected;
+  }
+
+  void ExpectMatches(const std::vector<double> &result, double alpha, double beta) const {
+    for (std::size_t i = 0; i < count; ++i) {
+      const auto expected = Expected(i, alpha, beta);
+      for (std::size_t e = 0; e < stride_c; ++e) {
+        ASSERT_NEAR(result[(i * stride_c) + e], expected[e], 1e-12) << "product " << i << ", element " << e;
+      }
+    }
+  }
+
+  std::size_t count, m, n, k, lda, ldb, ldc, stride_a, stride_b, stride_c;
+  std::vector<double> a, b, c;
+};
+
+void ExpectBatchMatchesNaive(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, double alpha,
+                             double beta) {
+  const Batch data(batch, m, n, k);
+  auto c = data.c;
+  ppc::linalg::BatchedGemm(batch, m, n, k, alpha, data.a.data(), data.lda, data.stride_a, data.b.data(), data.ldb,
+                           data.stride_b, beta, c.data(), data.ldc, data.stride_c);
+  data.ExpectMatches(c, alpha, beta);
+}
+
+// Runs body(i) in reverse order, to catch kernels that depend on the order of the batch
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+}  // namespace
+
+TEST(batched_gemm_tests, common_square_sizes_match_naive) {
+  for (std::size_t size : {2, 3, 4, 8, 16, 32}) {
+    ExpectBatchMatchesNaive(37, size, size, size, 1.0, 0.0);
+  }
+}
+
+TEST(batched_gemm_tests, other_small_shapes_match_naive) {
+  ExpectBatchMatchesNaive(29, 5, 7, 3, 1.0, 0.0);
+  ExpectBatchMatchesNaive(3, 64, 1, 64, 1.0, 0.0);
+  ExpectBatchMatchesNaive(11, 1, 13, 1, 1.0, 0.0);
+}
+
+TEST(batched_gemm_tests, alpha_and_beta_are_applied) {
+  ExpectBatchMatchesNaive(17, 8, 8, 8, -0.5, 2.0);
+  ExpectBatchMatchesNaive(17, 6, 9, 5, 3.0, -1.0);
+  ExpectBatchMatchesNaive(2, 70, 65, 80, 0.5, 0.25);
+}
+
+TEST(batched_gemm_tests, large_products_go_to_gemm) { ExpectBatchMatchesNaive(3, 97, 65, 130, 1.0, 0.0); }
+
+TEST(batched_gemm_tests, compile_time_sizes_match_naive) {
+  const Batch data(1000, 4, 8, 3);
+  auto c = data.c;
+  ppc::linalg::BatchedGemm<4, 8, 3>(data.count, 2.0, data.a.data(), data.lda, data.stride_a, data.b.data(), data.ldb,
+                                    data.stride_b, 1.0, c.data(), data.ldc, data.stride_c, ReverseFor{});
+  data.ExpectMatches(c, 2.0, 1.0);
+}
+
+TEST(batched_gemm_tests, empty_inner_dimension_scales_c) { ExpectBatchMatchesNaive(5, 4, 4, 0, 1.0, 3.0); }
+
+TEST(batched_gemm_tests, float_inputs_are_summed_in_double) {
+  constexpr std::size_t kBatch = 10;
+  constexpr std::size_t kN = 16;
+  const auto a = RandomValues<float>(kBatch * kN * kN, 4);
+  const auto b = RandomValues<float>(kBatch * kN * kN, 5);
+  std::vector<double> c(kBatch * kN * kN);
+  ppc::linalg::BatchedGemm(kBatch, kN, kN, kN, 1.0, a.data(), kN, kN * kN, b.data(), kN, kN * kN, 0.0, c.data(), kN,
+                           kN * kN);
+  for (std::size_t i = 0; i < kBatch; ++i) {
+    for (std::size_t r = 0; r < kN; ++r) {
+      for (std::size_t j = 0; j < kN; ++j) {
+        double expected = 0.0;
+        for (std::size_t p = 0; p < kN; ++p) {
+          expected += static_cast<double>(a[(i * kN * kN) + (r * kN) + p]) * b[(i * kN * kN) + (p * kN) + j];
+        }
+        ASSERT_NEAR(c[(i * kN * kN) + (r * kN) + j], expected, 1e-13);
+      }
+    }
+  }
+}
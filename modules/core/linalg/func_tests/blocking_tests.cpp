@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+
+namespace {
+
+const ppc::linalg::CacheSizes kCaches{.l1 = 32 * 1024, .l2 = 1024 * 1024};
+
+}  // namespace
+
+TEST(blocking_tests, cache_sizes_are_known) {
+  const auto &caches = ppc::linalg::GetCacheSizes();
+  EXPECT_GT(caches.l1, 0U);
+  EXPECT_GE(caches.l2, caches.l1);
+}
+
+TEST(blocking_tests, problem_fitting_in_l1_is_not_blocked) {
+  // 3 * 32 * 32 doubles are 24 KiB
+  EXPECT_EQ(ppc::linalg::ChooseBlockSize(32, sizeof(double), kCaches), 32U);
+  EXPECT_EQ(ppc::linalg::ChooseBlockSize(1, sizeof(double), kCaches), 1U);
+}
+
+TEST(blocking_tests, tiles_fill_half_of_l2) {
+  const std::size_t block = ppc::linalg::ChooseBlockSize(1000, sizeof(double), kCaches);
+  EXPECT_EQ(block % 8, 0U);
+  EXPECT_LE(3 * block * block * sizeof(double), kCaches.l2 / 2);
+  EXPECT_GT(3 * (block + 8) * (block + 8) * sizeof(double), kCaches.l2 / 2);
+}
+
+TEST(blocking_tests, tiles_are_at_least_a_cache_line) {
+  const ppc::linalg::CacheSizes tiny{.l1 = 64, .l2 = 128};
+  EXPECT_EQ(ppc::linalg::ChooseBlockSize(100, sizeof(double), tiny), 8U);
+  EXPECT_EQ(ppc::linalg::ChooseBlockSize(100, sizeof(float), tiny), 16U);
+}
+
+TEST(blocking_tests, dividing_block_size_divides) {
+  for (std::size_t n : {97, 149, 400, 1000, 1024}) {
+    const std::size_t block = ppc::linalg::ChooseDividingBlockSize(n, sizeof(double), kCaches);
+    EXPECT_EQ(n % block, 0U) << n;
+    EXPECT_LE(block, ppc::linalg::ChooseBlockSize(n, sizeof(double), kCaches)) << n;
+  }
+  // 149 is a prime above the tile size, so only the trivial tiles divide it
+  EXPECT_EQ(ppc::linalg::ChooseDividingBlockSize(149, sizeof(double), kCaches), 1U);
+}
+
+TEST(blocking_tests, tiling_has_a_remainder_tile) {
+  const ppc::linalg::BlockTiling tiling(100, 32);
+  ASSERT_EQ(tiling.Count(), 4U);
+  EXPECT_EQ(tiling.Begin(3), 96U);
+  EXPECT_EQ(tiling.Size(2), 32U);
+  EXPECT_EQ(tiling.Size(3), 4U);
+}
+
+TEST(blocking_tests, tiling_of_a_divisible_size_is_even) {
+  const ppc::linalg::BlockTiling tiling(96, 32);
+  ASSERT_EQ(tiling.Count(), 3U);
+  EXPECT_EQ(tiling.Size(2), 32U);
+}
+
+TEST(blocking_tests, cannon_blocks_cover_the_inner_dimension_once) {
+  const std::size_t grid = 5;
+  for (std::size_t i = 0; i < grid; ++i) {
+    for (std::size_t j = 0; j < grid; ++j) {
+      std::vector<int> seen(grid);
+      for (std::size_t step = 0; step < grid; ++step) {
+        ++seen[ppc::linalg::CannonBlock(i, j, step, grid)];
+      }
+      EXPECT_EQ(seen, std::vector<int>(grid, 1));
+    }
+  }
+  // Each step shifts A left and B up by one block
+  EXPECT_EQ(ppc::linalg::CannonBlock(1, 2, 0, grid), 3U);
+  EXPECT_EQ(ppc::linalg::CannonBlock(1, 2, 1, grid), 4U);
+  EXPECT_EQ(ppc::linalg::CannonBlock(1, 2, 2, grid), 0U);
+}
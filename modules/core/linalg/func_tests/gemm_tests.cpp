@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/precision.hpp"
+
+namespace {
+
+template <typename T>
+std::vector<T> RandomMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<T> dist(-1, 1);
+  std::vector<T> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+template <typename T>
+void NaiveGemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda, const T *b,
+               std::size_t ldb, T beta, T *c, std::size_t ldc) {
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      T sum{};
+      for (std::size_t p = 0; p < k; ++p) {
+        sum += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+      c[(i * ldc) + j] = (alpha * sum) + (beta == T{} ? T{} : beta * c[(i * ldc) + j]);
+    }
+  }
+}
+
+template <typename T>
+void ExpectGemmMatchesNaive(std::size_t m, std::size_t n, std::size_t k, T alpha, T beta, double tolerance) {
+  auto a = RandomMatrix<T>(m, k, 1);
+  auto b = RandomMatrix<T>(k, n, 2);
+  auto c = RandomMatrix<T>(m, n, 3);
+  auto expected = c;
+  NaiveGemm(m, n, k, alpha, a.data(), k, b.data(), n, beta, expected.data(), n);
+  ppc::linalg::Gemm(m, n, k, alpha, a.data(), k, b.data(), n, beta, c.data(), n);
+  for (std::size_t i = 0; i < m * n; ++i) {
+    ASSERT_NEAR(c[i], expected[i], tolerance) << "m=" << m << " n=" << n << " k=" << k << " at " << i;
+  }
+}
+
+// Visits the iterations back to front, to check that Gemm does not rely on the order
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i-- > 0;) {
+      body(i);
+    }
+  }
+};
+
+}  // namespace
+
+TEST(gemm_tests, square_matches_naive) { ExpectGemmMatchesNaive<double>(64, 64, 64, 1.0, 0.0, 1e-12); }
+
+TEST(gemm_tests, odd_shapes_match_naive) {
+  for (std::size_t m : {1, 5, 7, 97}) {
+    for (std::size_t n : {1, 3, 17, 259}) {
+      for (std::size_t k : {1, 2, 13}) {
+        ExpectGemmMatchesNaive<double>(m, n, k, 1.0, 0.0, 1e-12);
+      }
+    }
+  }
+}
+
+TEST(gemm_tests, deep_inner_dimension_is_split_into_slices) {
+  ExpectGemmMatchesNaive<double>(20, 30, 700, 1.0, 0.0, 1e-10);
+}
+
+TEST(gemm_tests, alpha_and_beta_are_applied) {
+  ExpectGemmMatchesNaive<double>(33, 41, 29, 2.5, -0.5, 1e-12);
+  ExpectGemmMatchesNaive<double>(33, 41, 29, 1.0, 1.0, 1e-12);
+}
+
+TEST(gemm_tests, generic_kernel_handles_float) { ExpectGemmMatchesNaive<float>(50, 70, 300, 1.0F, 0.0F, 1e-3); }
+
+TEST(gemm_tests, float_odd_shapes_match_naive) {
+  for (std::size_t m : {1, 7, 97}) {
+    for (std::size_t n : {3, 33, 259}) {
+      ExpectGemmMatchesNaive<float>(m, n, 13, 1.0F, 0.0F, 1e-4);
+    }
+  }
+  ExpectGemmMatchesNaive<float>(33, 41, 29, 2.5F, -0.5F, 1e-4);
+}
+
+TEST(gemm_tests, mixed_precision_sums_float_inputs_in_double) {
+  const std::size_t m = 20;
+  const std::size_t n = 30;
+  const std::size_t k = 4000;
+  const auto a = RandomMatrix<float>(m, k, 8);
+  const auto b = RandomMatrix<float>(k, n, 9);
+  const std::vector<double> a_wide(a.begin(), a.end());
+  const std::vector<double> b_wide(b.begin(), b.end());
+  std::vector<double> reference(m * n);
+  NaiveGemm(m, n, k, 1.0, a_wide.data(), k, b_wide.data(), n, 0.0, reference.data(), n);
+
+  std::vector<float> single(m * n);
+  std::vector<double> mixed(m * n);
+  ppc::linalg::GemmWorkspace<double> workspace;
+  ppc::linalg::Gemm(m, n, k, 1.0F, a.data(), k, b.data(), n, 0.0F, single.data(), n);
+  ppc::linalg::Gemm(m, n, k, 1.0, a.data(), k, b.data(), n, 0.0, mixed.data(), n, workspace);
+
+  const auto single_error = ppc::linalg::CompareToReference(single.data(), reference.data(), m * n);
+  const auto mixed_error = ppc::linalg::CompareToReference(mixed.data(), reference.data(), m * n);
+  EXPECT_LT(mixed_error.max_rel, 1e-12);
+  EXPECT_LT(single_error.max_rel, 1e-4);
+  EXPECT_GT(single_error.max_rel, mixed_error.max_rel);
+}
+
+TEST(gemm_tests, error_is_relative_to_largest_reference) {
+  const std::vector<double> reference = {4.0, -8.0, 2.0};
+  const std::vector<float> values = {4.5F, -8.0F, 1.0F};
+  const auto error = ppc::linalg::CompareToReference(values.data(), reference.data(), values.size());
+  EXPECT_EQ(error.max_abs, 1.0);
+  EXPECT_EQ(error.max_rel, 0.125);
+}
+
+TEST(gemm_tests, zero_beta_overwrites_nan) {
+  std::vector<double> a(9, 1.0);
+  std::vector<double> b(9, 2.0);
+  std::vector<double> c(9, std::numeric_limits<double>::quiet_NaN());
+  ppc::linalg::Gemm<double>(3, 3, 3, 1.0, a.data(), 3, b.data(), 3, 0.0, c.data(), 3);
+  for (double value : c) {
+    EXPECT_EQ(value, 6.0);
+  }
+}
+
+TEST(gemm_tests, empty_inner_dimension_only_scales_c) {
+  std::vector<double> c(6, 3.0);
+  ppc::linalg::Gemm<double>(2, 3, 0, 1.0, nullptr, 0, nullptr, 3, 2.0, c.data(), 3);
+  for (double value : c) {
+    EXPECT_EQ(value, 6.0);
+  }
+}
+
+TEST(gemm_tests, works_on_submatrix_views) {
+  // 10 x 12 block at (3, 5) of a 40 x 40 matrix times 12 x 9 block at (2, 4) of another
+  const std::size_t ld = 40;
+  auto a = RandomMatrix<double>(ld, ld, 4);
+  auto b = RandomMatrix<double>(ld, ld, 5);
+  std::vector<double> c(ld * ld, 7.0);
+  auto expected = c;
+  NaiveGemm<double>(10, 9, 12, 1.0, &a[(3 * ld) + 5], ld, &b[(2 * ld) + 4], ld, 1.0, &expected[(1 * ld) + 1], ld);
+  ppc::linalg::Gemm<double>(10, 9, 12, 1.0, &a[(3 * ld) + 5], ld, &b[(2 * ld) + 4], ld, 1.0, &c[(1 * ld) + 1], ld);
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-12) << i;
+  }
+}
+
+TEST(gemm_tests, result_does_not_depend_on_iteration_order) {
+  const std::size_t m = 150;
+  const std::size_t n = 300;
+  const std::size_t k = 270;
+  auto a = RandomMatrix<double>(m, k, 6);
+  auto b = RandomMatrix<double>(k, n, 7);
+  std::vector<double> serial(m * n);
+  std::vector<double> reversed(m * n);
+  ppc::linalg::GemmWorkspace<double> workspace;
+  ppc::linalg::Gemm(m, n, k, 1.0, a.data(), k, b.data(), n, 0.0, serial.data(), n, workspace);
+  ppc::linalg::Gemm(m, n, k, 1.0, a.data(), k, b.data(), n, 0.0, reversed.data(), n, workspace, ReverseFor{});
+  EXPECT_EQ(serial, reversed);
+}
@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+
+#ifdef _OPENMP
+
+namespace {
+
+// Counts the times every index is visited, which has to be once
+template <typename ParallelFor>
+void ExpectEveryIndexOnce(const ParallelFor &parallel_for, std::size_t count) {
+  std::vector<std::atomic<int>> visits(count);
+  parallel_for(count, [&](std::size_t i) { visits[i].fetch_add(1); });
+  for (std::size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(visits[i].load(), 1) << i;
+  }
+}
+
+}  // namespace
+
+TEST(parallel_for_tests, omp_for_visits_every_index_once) {
+  ExpectEveryIndexOnce(ppc::linalg::OmpFor{}, 0);
+  ExpectEveryIndexOnce(ppc::linalg::OmpFor{}, 1);
+  ExpectEveryIndexOnce(ppc::linalg::OmpFor{}, 1000);
+}
+
+TEST(parallel_for_tests, omp_task_for_visits_every_index_once) {
+  ExpectEveryIndexOnce(ppc::linalg::OmpTaskFor{}, 0);
+  ExpectEveryIndexOnce(ppc::linalg::OmpTaskFor{}, 1000);
+}
+
+// A nested call joins the tasks of the outer one instead of starting a parallel region of its own
+TEST(parallel_for_tests, omp_task_for_nests) {
+  constexpr std::size_t kOuter = 7;
+  constexpr std::size_t kInner = 50;
+  std::vector<std::atomic<int>> visits(kOuter * kInner);
+  const ppc::linalg::OmpTaskFor parallel_for;
+  parallel_for(kOuter, [&](std::size_t i) {
+    parallel_for(kInner, [&](std::size_t j) { visits[(i * kInner) + j].fetch_add(1); });
+  });
+  for (std::size_t i = 0; i < visits.size(); ++i) {
+    ASSERT_EQ(visits[i].load(), 1) << i;
+  }
+}
+
+#endif
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/precision.hpp"
+#include "core/linalg/include/strassen.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1, 1);
+  std::vector<double> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+void NaiveProduct(std::size_t m, std::size_t n, std::size_t k, const double *a, std::size_t lda, const double *b,
+                  std::size_t ldb, double *c, std::size_t ldc) {
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      double sum = 0.0;
+      for (std::size_t p = 0; p < k; ++p) {
+        sum += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+      c[(i * ldc) + j] = sum;
+    }
+  }
+}
+
+void ExpectStrassenMatchesNaive(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size) {
+  auto a = RandomMatrix(m, k, 1);
+  auto b = RandomMatrix(k, n, 2);
+  std::vector<double> expected(m * n);
+  std::vector<double> c(m * n, 5.0);
+  NaiveProduct(m, n, k, a.data(), k, b.data(), n, expected.data(), n);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  ppc::linalg::StrassenWinograd(m, n, k, a.data(), k, b.data(), n, c.data(), n, workspace, leaf_size);
+  for (std::size_t i = 0; i < m * n; ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-10) << "m=" << m << " n=" << n << " k=" << k << " at " << i;
+  }
+}
+
+// Visits the iterations back to front, to check that nothing relies on the order
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i-- > 0;) {
+      body(i);
+    }
+  }
+};
+
+// Runs every iteration on a thread of its own, so that concurrent products really overlap
+struct ThreadFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      threads.emplace_back([&body, i] { body(i); });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+template <typename ForkJoin = ppc::linalg::SerialFor>
+void ExpectTasksMatchNaive(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size, std::size_t task_depth,
+                           const ForkJoin &fork = {}) {
+  auto a = RandomMatrix(m, k, 10);
+  auto b = RandomMatrix(k, n, 11);
+  std::vector<double> expected(m * n);
+  std::vector<double> c(m * n, 5.0);
+  NaiveProduct(m, n, k, a.data(), k, b.data(), n, expected.data(), n);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  ppc::linalg::StrassenWinogradTasks(m, n, k, a.data(), k, b.data(), n, c.data(), n, workspace, leaf_size, task_depth,
+                                     fork);
+  for (std::size_t i = 0; i < m * n; ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-10) << "m=" << m << " n=" << n << " k=" << k << " at " << i;
+  }
+}
+
+}  // namespace
+
+TEST(strassen_tests, power_of_two_matches_naive) { ExpectStrassenMatchesNaive(128, 128, 128, 8); }
+
+TEST(strassen_tests, odd_sizes_are_peeled_at_every_level) {
+  // 2^k + 1 is the worst case for padding: here every level peels one row, column and inner index
+  ExpectStrassenMatchesNaive(129, 129, 129, 8);
+  ExpectStrassenMatchesNaive(67, 67, 67, 4);
+}
+
+TEST(strassen_tests, rectangular_shapes_match_naive) {
+  ExpectStrassenMatchesNaive(90, 45, 70, 8);
+  ExpectStrassenMatchesNaive(33, 100, 21, 4);
+  ExpectStrassenMatchesNaive(1, 50, 50, 4);
+}
+
+TEST(strassen_tests, float_matches_naive) {
+  const std::size_t size = 129;
+  const auto a_wide = RandomMatrix(size, size, 16);
+  const auto b_wide = RandomMatrix(size, size, 17);
+  const std::vector<float> a(a_wide.begin(), a_wide.end());
+  const std::vector<float> b(b_wide.begin(), b_wide.end());
+  std::vector<double> expected(size * size);
+  NaiveProduct(size, size, size, a_wide.data(), size, b_wide.data(), size, expected.data(), size);
+  std::vector<float> c(size * size);
+  ppc::linalg::StrassenWorkspace<float> workspace;
+  ppc::linalg::StrassenWinograd(size, size, size, a.data(), size, b.data(), size, c.data(), size, workspace, 8);
+  EXPECT_LT(ppc::linalg::CompareToReference(c.data(), expected.data(), c.size()).max_rel, 1e-5);
+}
+
+TEST(strassen_tests, leaf_size_above_the_shape_is_plain_gemm) { ExpectStrassenMatchesNaive(40, 30, 20, 64); }
+
+TEST(strassen_tests, works_on_submatrix_views) {
+  // 37 x 41 block at (3, 5) of a 60 x 60 matrix times 41 x 29 block at (2, 4) of another
+  const std::size_t ld = 60;
+  auto a = RandomMatrix(ld, ld, 4);
+  auto b = RandomMatrix(ld, ld, 5);
+  std::vector<double> c(ld * ld, 7.0);
+  auto expected = c;
+  NaiveProduct(37, 29, 41, &a[(3 * ld) + 5], ld, &b[(2 * ld) + 4], ld, &expected[(1 * ld) + 1], ld);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  ppc::linalg::StrassenWinograd<double>(37, 29, 41, &a[(3 * ld) + 5], ld, &b[(2 * ld) + 4], ld, &c[(1 * ld) + 1], ld,
+                                        workspace, 4);
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-10) << i;
+  }
+}
+
+TEST(strassen_tests, reserved_workspace_is_not_reallocated) {
+  const std::size_t size = 100;
+  auto a = RandomMatrix(size, size, 6);
+  auto b = RandomMatrix(size, size, 7);
+  std::vector<double> c(size * size);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  workspace.Reserve(size, size, size, 8);
+  const double *scratch = workspace.Scratch();
+  const double *packed_a = workspace.Gemm().PackedA();
+  ppc::linalg::StrassenWinograd(size, size, size, a.data(), size, b.data(), size, c.data(), size, workspace, 8);
+  ppc::linalg::StrassenWinograd(size / 2, size / 3, size, a.data(), size, b.data(), size, c.data(), size, workspace,
+                                8);
+  EXPECT_EQ(workspace.Scratch(), scratch);
+  EXPECT_EQ(workspace.Gemm().PackedA(), packed_a);
+}
+
+TEST(strassen_tests, result_does_not_depend_on_iteration_order) {
+  const std::size_t size = 75;
+  auto a = RandomMatrix(size, size, 8);
+  auto b = RandomMatrix(size, size, 9);
+  std::vector<double> serial(size * size);
+  std::vector<double> reversed(size * size);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  ppc::linalg::StrassenWinograd(size, size, size, a.data(), size, b.data(), size, serial.data(), size, workspace, 8);
+  ppc::linalg::StrassenWinograd(size, size, size, a.data(), size, b.data(), size, reversed.data(), size, workspace, 8,
+                                ReverseFor{});
+  EXPECT_EQ(serial, reversed);
+}
+
+TEST(strassen_tests, tasks_match_naive) {
+  ExpectTasksMatchNaive(128, 128, 128, 8, 1);
+  ExpectTasksMatchNaive(128, 128, 128, 8, 2);
+  ExpectTasksMatchNaive(129, 67, 99, 8, 2);
+  ExpectTasksMatchNaive(30, 30, 30, 8, 5);
+}
+
+TEST(strassen_tests, tasks_run_concurrently) { ExpectTasksMatchNaive(97, 101, 103, 8, 2, ThreadFor{}); }
+
+TEST(strassen_tests, tasks_do_not_depend_on_iteration_order) {
+  const std::size_t size = 75;
+  auto a = RandomMatrix(size, size, 12);
+  auto b = RandomMatrix(size, size, 13);
+  std::vector<double> serial(size * size);
+  std::vector<double> reversed(size * size);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  ppc::linalg::StrassenWinogradTasks(size, size, size, a.data(), size, b.data(), size, serial.data(), size, workspace,
+                                     8, 2);
+  ppc::linalg::StrassenWinogradTasks(size, size, size, a.data(), size, b.data(), size, reversed.data(), size,
+                                     workspace, 8, 2, ReverseFor{});
+  EXPECT_EQ(serial, reversed);
+}
+
+TEST(strassen_tests, tasks_reserved_workspace_is_not_reallocated) {
+  const std::size_t size = 100;
+  auto a = RandomMatrix(size, size, 14);
+  auto b = RandomMatrix(size, size, 15);
+  std::vector<double> c(size * size);
+  ppc::linalg::StrassenWorkspace<double> workspace;
+  workspace.Reserve(size, size, size, 8, 2);
+  const double *scratch = workspace.Scratch();
+  const double *packed_b = workspace.Gemm(48).PackedB();
+  ppc::linalg::StrassenWinogradTasks(size, size, size, a.data(), size, b.data(), size, c.data(), size, workspace, 8, 2);
+  ppc::linalg::StrassenWinograd(size, size, size, a.data(), size, b.data(), size, c.data(), size, workspace, 8);
+  EXPECT_EQ(workspace.Scratch(), scratch);
+  EXPECT_EQ(workspace.Gemm(48).PackedB(), packed_b);
+}
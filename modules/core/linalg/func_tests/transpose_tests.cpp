@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "core/linalg/include/transpose.hpp"
+
+namespace {
+
+// Distinct nonzero values, so that any misplaced element shows
+template <typename T>
+std::vector<T> Iota(std::size_t count) {
+  std::vector<T> values(count);
+  std::iota(values.begin(), values.end(), T{1});
+  return values;
+}
+
+// Runs body(i) in reverse order, to catch tiles that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+template <typename T>
+void ExpectTransposeMatches(std::size_t rows, std::size_t cols) {
+  const std::size_t lds = cols + 3;
+  const std::size_t ldd = rows + 5;
+  const auto src = Iota<T>(rows * lds);
+  std::vector<T> dst(cols * ldd);
+  ppc::linalg::Transpose(rows, cols, src.data(), lds, dst.data(), ldd, ReverseFor{});
+  for (std::size_t j = 0; j < cols; ++j) {
+    for (std::size_t i = 0; i < ldd; ++i) {
+      // The padding past each row of dst stays untouched
+      const T expected = i < rows ? src[(i * lds) + j] : T{};
+      ASSERT_EQ(dst[(j * ldd) + i], expected) << rows << "x" << cols << " at " << j << ", " << i;
+    }
+  }
+}
+
+template <typename T>
+void ExpectTransposeInPlaceMatches(std::size_t n) {
+  const std::size_t lda = n + 2;
+  const auto original = Iota<T>(n * lda);
+  auto a = original;
+  ppc::linalg::TransposeInPlace(n, a.data(), lda, ReverseFor{});
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < lda; ++j) {
+      const T expected = j < n ? original[(j * lda) + i] : original[(i * lda) + j];
+      ASSERT_EQ(a[(i * lda) + j], expected) << n << " at " << i << ", " << j;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(transpose_tests, rectangular_double) {
+  for (std::size_t rows : {1, 3, 4, 32, 45, 100}) {
+    for (std::size_t cols : {1, 2, 8, 33, 71}) {
+      ExpectTransposeMatches<double>(rows, cols);
+    }
+  }
+}
+
+TEST(transpose_tests, rectangular_float) {
+  for (std::size_t rows : {1, 7, 8, 16, 65}) {
+    for (std::size_t cols : {1, 8, 9, 40, 130}) {
+      ExpectTransposeMatches<float>(rows, cols);
+    }
+  }
+}
+
+TEST(transpose_tests, other_element_types) {
+  ExpectTransposeMatches<int>(37, 19);
+  ExpectTransposeMatches<unsigned char>(5, 11);
+}
+
+TEST(transpose_tests, in_place_square) {
+  for (std::size_t n : {1, 2, 4, 31, 32, 33, 64, 100, 257}) {
+    ExpectTransposeInPlaceMatches<double>(n);
+    ExpectTransposeInPlaceMatches<float>(n);
+  }
+}
+
+TEST(transpose_tests, empty_matrix_is_left_alone) {
+  std::vector<double> dst(4, -1.0);
+  ppc::linalg::Transpose<double>(0, 5, nullptr, 5, dst.data(), 1);
+  ppc::linalg::TransposeInPlace<double>(0, nullptr, 0);
+  EXPECT_EQ(dst, std::vector<double>(4, -1.0));
+}
+
+TEST(transpose_tests, block_major_offsets) {
+  // 5 x 7 in 3 x 3 tiles: bands of 3 and 2 rows, tiles of 3, 3 and 1 columns
+  EXPECT_EQ(ppc::linalg::BlockMajorOffset(5, 7, 3, 0, 0), 0U);
+  EXPECT_EQ(ppc::linalg::BlockMajorOffset(5, 7, 3, 0, 1), 9U);
+  EXPECT_EQ(ppc::linalg::BlockMajorOffset(5, 7, 3, 0, 2), 18U);
+  EXPECT_EQ(ppc::linalg::BlockMajorOffset(5, 7, 3, 1, 0), 21U);
+  EXPECT_EQ(ppc::linalg::BlockMajorOffset(5, 7, 3, 1, 2), 33U);
+}
+
+TEST(transpose_tests, block_major_tiles_are_contiguous) {
+  constexpr std::size_t kRows = 50;
+  constexpr std::size_t kCols = 70;
+  constexpr std::size_t kBlock = 16;
+  const auto src = Iota<double>(kRows * kCols);
+  std::vector<double> blocked(kRows * kCols);
+  ppc::linalg::RowToBlockMajor(kRows, kCols, kBlock, src.data(), kCols, blocked.data(), ReverseFor{});
+  // Tile (1, 4) holds rows 16..31 and columns 64..69
+  const double *tile = blocked.data() + ppc::linalg::BlockMajorOffset(kRows, kCols, kBlock, 1, 4);
+  for (std::size_t i = 0; i < 16; ++i) {
+    for (std::size_t j = 0; j < 6; ++j) {
+      ASSERT_EQ(tile[(i * 6) + j], src[((16 + i) * kCols) + 64 + j]);
+    }
+  }
+
+  std::vector<double> back(kRows * kCols);
+  ppc::linalg::BlockToRowMajor(kRows, kCols, kBlock, blocked.data(), back.data(), kCols, ReverseFor{});
+  EXPECT_EQ(back, src);
+}
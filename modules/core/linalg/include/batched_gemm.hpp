@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "core/linalg/include/gemm.hpp"
+
+namespace ppc::linalg {
+
+// Products with no dimension above this are multiplied directly, without packing; larger ones go to Gemm,
+// whose packing only pays off once the panels are reused
+inline constexpr std::size_t kBatchedGemmSmallSize = 64;
+
+// Multiply-adds in one unit of parallel work over a batch: a 4x4 product is far too little to be
+// scheduled on its own, so consecutive products of a batch are grouped up to about this much
+inline constexpr std::size_t kBatchedGemmChunkWork = std::size_t{1} << 16;
+
+// Dimension of a small product known at compile time
+template <std::size_t V>
+using Extent = std::integral_constant<std::size_t, V>;
+
+namespace detail {
+
+// Upper bound of a dimension of type D: its value for an Extent, the small size limit for a std::size_t
+template <typename D>
+inline constexpr std::size_t kMaxExtent = kBatchedGemmSmallSize;
+template <std::size_t V>
+inline constexpr std::size_t kMaxExtent<Extent<V>> = V;
+
+// c = alpha * a * b + beta * c for one small product, a row of C at a time. M, N and K are either
+// std::size_t or Extent: with extents the loops are unrolled and the row of C stays in registers.
+template <typename T, typename In, typename M, typename N, typename K>
+void SmallGemm(M m, N n, K k, T alpha, const In *a, std::size_t lda, const In *b, std::size_t ldb, T beta, T *c,
+               std::size_t ldc) {
+  std::array<T, kMaxExtent<N>> acc;
+  for (std::size_t i = 0; i < m; ++i) {
+    std::fill_n(acc.begin(), static_cast<std::size_t>(n), T{});
+    for (std::size_t p = 0; p < k; ++p) {
+      const T a_ip = static_cast<T>(a[(i * lda) + p]);
+      const In *b_row = b + (p * ldb);
+      for (std::size_t j = 0; j < n; ++j) {
+        acc[j] += a_ip * static_cast<T>(b_row[j]);
+      }
+    }
+    T *c_row = c + (i * ldc);
+    for (std::size_t j = 0; j < n; ++j) {
+      c_row[j] = beta == T{} ? alpha * acc[j] : (alpha * acc[j]) + (beta * c_row[j]);
+    }
+  }
+}
+
+template <typename T, typename In, typename M, typename N, typename K, typename ParallelFor>
+void SmallGemmBatch(std::size_t batch, M m, N n, K k, T alpha, const In *a, std::size_t lda, std::size_t stride_a,
+                    const In *b, std::size_t ldb, std::size_t stride_b, T beta, T *c, std::size_t ldc,
+                    std::size_t stride_c, const ParallelFor &parallel_for) {
+  const std::size_t work = std::max<std::size_t>(static_cast<std::size_t>(m) * n * k, 1);
+  const std::size_t chunk = std::max<std::size_t>(kBatchedGemmChunkWork / work, 1);
+  parallel_for((batch + chunk - 1) / chunk, [&](std::size_t first) {
+    const std::size_t end = std::min(batch, (first + 1) * chunk);
+    for (std::size_t i = first * chunk; i < end; ++i) {
+      SmallGemm(m, n, k, alpha, a + (i * stride_a), lda, b + (i * stride_b), ldb, beta, c + (i * stride_c), ldc);
+    }
+  });
+}
+
+}  // namespace detail
+
+// Strided batch of products with the sizes fixed at compile time, for callers that know them:
+// C_i = alpha * A_i * B_i + beta * C_i for i in [0, batch), where A_i starts at a + i * stride_a, and
+// so on. Each matrix is row-major with the row strides lda, ldb and ldc; A and B may be of a narrower
+// type than T, as in the mixed-precision Gemm. parallel_for runs over groups of products, see Gemm.
+template <std::size_t M, std::size_t N, std::size_t K, typename T, typename In, typename ParallelFor = SerialFor>
+  requires(M <= kBatchedGemmSmallSize && N <= kBatchedGemmSmallSize && K <= kBatchedGemmSmallSize)
+void BatchedGemm(std::size_t batch, T alpha, const In *a, std::size_t lda, std::size_t stride_a, const In *b,
+                 std::size_t ldb, std::size_t stride_b, T beta, T *c, std::size_t ldc, std::size_t stride_c,
+                 const ParallelFor &parallel_for = {}) {
+  detail::SmallGemmBatch(batch, Extent<M>{}, Extent<N>{}, Extent<K>{}, alpha, a, lda, stride_a, b, ldb, stride_b,
+                         beta, c, ldc, stride_c, parallel_for);
+}
+
+// Same with the sizes known at run time. Square products of the common small sizes go to the compile-time
+// kernels above, other small ones to the same loops with runtime bounds, and products too large to be
+// small are done one after another, each by a Gemm parallel on its own.
+template <typename T, typename In, typename ParallelFor = SerialFor>
+void BatchedGemm(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, T alpha, const In *a,
+                 std::size_t lda, std::size_t stride_a, const In *b, std::size_t ldb, std::size_t stride_b, T beta,
+                 T *c, std::size_t ldc, std::size_t stride_c, GemmWorkspace<T> &workspace,
+                 const ParallelFor &parallel_for = {}) {
+  if (batch == 0 || m == 0 || n == 0) {
+    return;
+  }
+  if (std::max({m, n, k}) > kBatchedGemmSmallSize) {
+    for (std::size_t i = 0; i < batch; ++i) {
+      Gemm(m, n, k, alpha, a + (i * stride_a), lda, b + (i * stride_b), ldb, beta, c + (i * stride_c), ldc,
+           workspace, parallel_for);
+    }
+    return;
+  }
+  auto run = [&](auto rows, auto cols, auto inner) {
+    detail::SmallGemmBatch(batch, rows, cols, inner, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc,
+                           stride_c, parallel_for);
+  };
+  if (m == n && n == k) {
+    switch (m) {
+      case 2:
+        return run(Extent<2>{}, Extent<2>{}, Extent<2>{});
+      case 3:
+        return run(Extent<3>{}, Extent<3>{}, Extent<3>{});
+      case 4:
+        return run(Extent<4>{}, Extent<4>{}, Extent<4>{});
+      case 8:
+        return run(Extent<8>{}, Extent<8>{}, Extent<8>{});
+      case 16:
+        return run(Extent<16>{}, Extent<16>{}, Extent<16>{});
+      case 32:
+        return run(Extent<32>{}, Extent<32>{}, Extent<32>{});
+      default:
+        break;
+    }
+  }
+  run(m, n, k);
+}
+
+// Same with a workspace of its own, which is only allocated for products too large to be small
+template <typename T, typename In, typename ParallelFor = SerialFor>
+void BatchedGemm(std::size_t batch, std::size_t m, std::size_t n, std::size_t k, T alpha, const In *a,
+                 std::size_t lda, std::size_t stride_a, const In *b, std::size_t ldb, std::size_t stride_b, T beta,
+                 T *c, std::size_t ldc, std::size_t stride_c, const ParallelFor &parallel_for = {}) {
+  GemmWorkspace<T> workspace;
+  BatchedGemm(batch, m, n, k, alpha, a, lda, stride_a, b, ldb, stride_b, beta, c, ldc, stride_c, workspace,
+              parallel_for);
+}
+
+}  // namespace ppc::linalg
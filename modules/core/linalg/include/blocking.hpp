@@ -0,0 +1,52 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ppc::linalg {
+
+// Per-core data cache sizes in bytes
+struct CacheSizes {
+  std::size_t l1 = 32 * 1024;
+  std::size_t l2 = 1024 * 1024;
+};
+
+// Cache sizes of this machine, read from the system once; the defaults above stand in for what it does not report
+const CacheSizes &GetCacheSizes();
+
+// Side of the square tiles of a blocked n x n multiplication with elements of element_size bytes.
+// If all three matrices fit in L1 there is nothing to block and the tile is the whole matrix; otherwise
+// a tile of A, one of B and one of C take up about half of L2, leaving the rest to the streams around
+// them. Tiles are a multiple of a cache line wide and need not divide n: see BlockTiling.
+std::size_t ChooseBlockSize(std::size_t n, std::size_t element_size, const CacheSizes &caches = GetCacheSizes());
+
+// Largest divisor of n not above ChooseBlockSize, for algorithms that can only work with equal tiles
+std::size_t ChooseDividingBlockSize(std::size_t n, std::size_t element_size,
+                                    const CacheSizes &caches = GetCacheSizes());
+
+// Split of [0, n) into tiles of block_size, the last of which is shorter when block_size does not divide n
+class BlockTiling {
+ public:
+  BlockTiling(std::size_t n, std::size_t block_size)
+      : n_(n), block_size_(std::max<std::size_t>(block_size, 1)), count_((n + block_size_ - 1) / block_size_) {}
+
+  [[nodiscard]] std::size_t Count() const { return count_; }
+  [[nodiscard]] std::size_t BlockSize() const { return block_size_; }
+  [[nodiscard]] std::size_t Begin(std::size_t tile) const { return tile * block_size_; }
+  [[nodiscard]] std::size_t Size(std::size_t tile) const { return std::min(block_size_, n_ - Begin(tile)); }
+
+ private:
+  std::size_t n_;
+  std::size_t block_size_;
+  std::size_t count_;
+};
+
+// Inner block that Cannon's algorithm multiplies into block (i, j) of C at the given step of a grid x grid
+// tiling. This is the initial skew and the step rotations of A and B done as index arithmetic, so that the
+// blocks are read in place and nothing moves; with MPI the same blocks reach process (i, j) through
+// sendrecv_replace along the rows and columns of a periodic Cartesian communicator.
+inline std::size_t CannonBlock(std::size_t i, std::size_t j, std::size_t step, std::size_t grid) {
+  return (i + j + step) % grid;
+}
+
+}  // namespace ppc::linalg
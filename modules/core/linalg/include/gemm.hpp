@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
+
+#include "core/linalg/include/parallel_for.hpp"
+
+namespace ppc::linalg {
+
+// Packed panels are aligned to a cache line, so that the kernels can use aligned vector loads
+inline constexpr std::size_t kGemmAlignment = 64;
+
+// Cache blocking. A unit of parallel work is a kGemmMc x kGemmNc tile of C over a kGemmKc-deep
+// slice of the inner dimension: the kGemmKc x kNr panel of B in use stays in L1 while the
+// kGemmMc x kGemmKc block of A streams through the kernel from L2.
+inline constexpr std::size_t kGemmKc = 256;
+inline constexpr std::size_t kGemmMc = 96;
+inline constexpr std::size_t kGemmNc = 256;
+
+// Register-blocked micro-kernel: c[kMr x kNr] (row stride ldc) += a_panel * b_panel, where
+// a_panel holds kc columns of kMr values and b_panel kc rows of kNr values.
+// The generic version is written so that the compiler keeps acc in vector registers.
+template <typename T>
+struct GemmKernel {
+  static constexpr std::size_t kMr = 4;
+  static constexpr std::size_t kNr = 8;
+
+  static void Run(std::size_t kc, const T *a, const T *b, T *c, std::size_t ldc) {
+    T acc[kMr][kNr] = {};
+    for (std::size_t p = 0; p < kc; ++p, a += kMr, b += kNr) {
+      for (std::size_t r = 0; r < kMr; ++r) {
+        for (std::size_t j = 0; j < kNr; ++j) {
+          acc[r][j] += a[r] * b[j];
+        }
+      }
+    }
+    for (std::size_t r = 0; r < kMr; ++r) {
+      for (std::size_t j = 0; j < kNr; ++j) {
+        c[(r * ldc) + j] += acc[r][j];
+      }
+    }
+  }
+};
+
+#if defined(__AVX512F__)
+
+template <>
+struct GemmKernel<float> {
+  static constexpr std::size_t kMr = 8;
+  static constexpr std::size_t kNr = 32;
+
+  static void Run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc) {
+    __m512 acc[kMr][2];
+    for (auto &row : acc) {
+      row[0] = _mm512_setzero_ps();
+      row[1] = _mm512_setzero_ps();
+    }
+    for (std::size_t p = 0; p < kc; ++p, a += kMr, b += kNr) {
+      const __m512 b0 = _mm512_load_ps(b);
+      const __m512 b1 = _mm512_load_ps(b + 16);
+      for (std::size_t r = 0; r < kMr; ++r) {
+        const __m512 ar = _mm512_set1_ps(a[r]);
+        acc[r][0] = _mm512_fmadd_ps(ar, b0, acc[r][0]);
+        acc[r][1] = _mm512_fmadd_ps(ar, b1, acc[r][1]);
+      }
+    }
+    for (std::size_t r = 0; r < kMr; ++r) {
+      float *row = c + (r * ldc);
+      _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[r][0]));
+      _mm512_storeu_ps(row + 16, _mm512_add_ps(_mm512_loadu_ps(row + 16), acc[r][1]));
+    }
+  }
+};
+
+template <>
+struct GemmKernel<double> {
+  static constexpr std::size_t kMr = 8;
+  static constexpr std::size_t kNr = 16;
+
+  static void Run(std::size_t kc, const double *a, const double *b, double *c, std::size_t ldc) {
+    __m512d acc[kMr][2];
+    for (auto &row : acc) {
+      row[0] = _mm512_setzero_pd();
+      row[1] = _mm512_setzero_pd();
+    }
+    for (std::size_t p = 0; p < kc; ++p, a += kMr, b += kNr) {
+      const __m512d b0 = _mm512_load_pd(b);
+      const __m512d b1 = _mm512_load_pd(b + 8);
+      for (std::size_t r = 0; r < kMr; ++r) {
+        const __m512d ar = _mm512_set1_pd(a[r]);
+        acc[r][0] = _mm512_fmadd_pd(ar, b0, acc[r][0]);
+        acc[r][1] = _mm512_fmadd_pd(ar, b1, acc[r][1]);
+      }
+    }
+    for (std::size_t r = 0; r < kMr; ++r) {
+      double *row = c + (r * ldc);
+      _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[r][0]));
+      _mm512_storeu_pd(row + 8, _mm512_add_pd(_mm512_loadu_pd(row + 8), acc[r][1]));
+    }
+  }
+};
+
+#elif defined(__AVX2__) && defined(__FMA__)
+
+template <>
+struct GemmKernel<float> {
+  static constexpr std::size_t kMr = 6;
+  static constexpr std::size_t kNr = 16;
+
+  static void Run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc) {
+    __m256 acc[kMr][2];
+    for (auto &row : acc) {
+      row[0] = _mm256_setzero_ps();
+      row[1] = _mm256_setzero_ps();
+    }
+    for (std::size_t p = 0; p < kc; ++p, a += kMr, b += kNr) {
+      const __m256 b0 = _mm256_load_ps(b);
+      const __m256 b1 = _mm256_load_ps(b + 8);
+      for (std::size_t r = 0; r < kMr; ++r) {
+        const __m256 ar = _mm256_broadcast_ss(a + r);
+        acc[r][0] = _mm256_fmadd_ps(ar, b0, acc[r][0]);
+        acc[r][1] = _mm256_fmadd_ps(ar, b1, acc[r][1]);
+      }
+    }
+    for (std::size_t r = 0; r < kMr; ++r) {
+      float *row = c + (r * ldc);
+      _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), acc[r][0]));
+      _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), acc[r][1]));
+    }
+  }
+};
+
+template <>
+struct GemmKernel<double> {
+  static constexpr std::size_t kMr = 6;
+  static constexpr std::size_t kNr = 8;
+
+  static void Run(std::size_t kc, const double *a, const double *b, double *c, std::size_t ldc) {
+    __m256d acc[kMr][2];
+    for (auto &row : acc) {
+      row[0] = _mm256_setzero_pd();
+      row[1] = _mm256_setzero_pd();
+    }
+    for (std::size_t p = 0; p < kc; ++p, a += kMr, b += kNr) {
+      const __m256d b0 = _mm256_load_pd(b);
+      const __m256d b1 = _mm256_load_pd(b + 4);
+      for (std::size_t r = 0; r < kMr; ++r) {
+        const __m256d ar = _mm256_broadcast_sd(a + r);
+        acc[r][0] = _mm256_fmadd_pd(ar, b0, acc[r][0]);
+        acc[r][1] = _mm256_fmadd_pd(ar, b1, acc[r][1]);
+      }
+    }
+    for (std::size_t r = 0; r < kMr; ++r) {
+      double *row = c + (r * ldc);
+      _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), acc[r][0]));
+      _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), acc[r][1]));
+    }
+  }
+};
+
+#endif
+
+static_assert(kGemmMc % GemmKernel<double>::kMr == 0 && kGemmNc % GemmKernel<double>::kNr == 0);
+static_assert(kGemmMc % GemmKernel<float>::kMr == 0 && kGemmNc % GemmKernel<float>::kNr == 0);
+
+// Packing buffers of Gemm. Grows on demand and is never shrunk, so a workspace reserved for the
+// largest shape up front makes every later multiplication allocation-free.
+template <typename T>
+class GemmWorkspace {
+ public:
+  // Makes room for Gemm on an m x k by k x n product; smaller products fit as well
+  void Reserve(std::size_t m, std::size_t n, std::size_t k) {
+    constexpr std::size_t kMr = GemmKernel<T>::kMr;
+    constexpr std::size_t kNr = GemmKernel<T>::kNr;
+    const std::size_t kc = std::min(k, kGemmKc);
+    packed_a_ = Grow(a_, ((m + kMr - 1) / kMr) * kMr * kc);
+    packed_b_ = Grow(b_, ((n + kNr - 1) / kNr) * kNr * kc);
+  }
+  [[nodiscard]] T *PackedA() const { return packed_a_; }
+  [[nodiscard]] T *PackedB() const { return packed_b_; }
+
+ private:
+  // Returns the first aligned element of a buffer that has room for size elements past it
+  static T *Grow(std::vector<T> &buffer, std::size_t size) {
+    const std::size_t padded = size + (kGemmAlignment / sizeof(T));
+    if (buffer.size() < padded) {
+      buffer.resize(padded);
+    }
+    void *ptr = buffer.data();
+    std::size_t space = buffer.size() * sizeof(T);
+    return static_cast<T *>(std::align(kGemmAlignment, size * sizeof(T), ptr, space));
+  }
+
+  std::vector<T> a_;
+  std::vector<T> b_;
+  T *packed_a_ = nullptr;
+  T *packed_b_ = nullptr;
+};
+
+namespace detail {
+
+// First kc columns of the given rows of A scaled by alpha, column by column, zero-padded to Mr rows
+template <typename T, std::size_t Mr, typename In>
+void PackPanelA(const In *a, std::size_t lda, std::size_t rows, std::size_t kc, T alpha, T *out) {
+  for (std::size_t p = 0; p < kc; ++p, out += Mr) {
+    for (std::size_t r = 0; r < Mr; ++r) {
+      out[r] = r < rows ? alpha * static_cast<T>(a[(r * lda) + p]) : T{};
+    }
+  }
+}
+
+// First kc rows of the given columns of B, row by row, zero-padded to Nr columns
+template <typename T, std::size_t Nr, typename In>
+void PackPanelB(const In *b, std::size_t ldb, std::size_t cols, std::size_t kc, T *out) {
+  for (std::size_t p = 0; p < kc; ++p, out += Nr) {
+    const In *row = b + (p * ldb);
+    if (cols == Nr) {
+      std::copy(row, row + Nr, out);
+    } else {
+      std::copy(row, row + cols, out);
+      std::fill(out + cols, out + Nr, T{});
+    }
+  }
+}
+
+// Body of both Gemm overloads below; A and B are converted to T as they are packed
+template <typename T, typename In, typename ParallelFor>
+void GemmPacked(std::size_t m, std::size_t n, std::size_t k, T alpha, const In *a, std::size_t lda, const In *b,
+                std::size_t ldb, T beta, T *c, std::size_t ldc, GemmWorkspace<T> &workspace,
+                const ParallelFor &parallel_for) {
+  using Kernel = GemmKernel<T>;
+  constexpr std::size_t kMr = Kernel::kMr;
+  constexpr std::size_t kNr = Kernel::kNr;
+  if (m == 0 || n == 0) {
+    return;
+  }
+  if (beta != T{1}) {
+    parallel_for(m, [&](std::size_t i) {
+      T *row = c + (i * ldc);
+      if (beta == T{}) {
+        std::fill(row, row + n, T{});
+      } else {
+        std::for_each(row, row + n, [beta](T &value) { value *= beta; });
+      }
+    });
+  }
+  if (k == 0 || alpha == T{}) {
+    return;
+  }
+
+  const std::size_t m_panels = (m + kMr - 1) / kMr;
+  const std::size_t n_panels = (n + kNr - 1) / kNr;
+  const std::size_t row_blocks = (m + kGemmMc - 1) / kGemmMc;
+  const std::size_t col_blocks = (n + kGemmNc - 1) / kGemmNc;
+  const std::size_t kc_max = std::min(k, kGemmKc);
+  workspace.Reserve(m, n, k);
+  T *packed_a = workspace.PackedA();
+  T *packed_b = workspace.PackedB();
+
+  for (std::size_t pc = 0; pc < k; pc += kc_max) {
+    const std::size_t kc = std::min(kc_max, k - pc);
+    parallel_for(m_panels + n_panels, [&](std::size_t panel) {
+      if (panel < m_panels) {
+        const std::size_t row = panel * kMr;
+        PackPanelA<T, kMr>(a + (row * lda) + pc, lda, std::min(kMr, m - row), kc, alpha, packed_a + (panel * kMr * kc));
+      } else {
+        const std::size_t col = (panel - m_panels) * kNr;
+        PackPanelB<T, kNr>(b + (pc * ldb) + col, ldb, std::min(kNr, n - col), kc,
+                           packed_b + ((panel - m_panels) * kNr * kc));
+      }
+    });
+
+    parallel_for(row_blocks * col_blocks, [&](std::size_t block) {
+      const std::size_t row_end = std::min(m, ((block / col_blocks) + 1) * kGemmMc);
+      const std::size_t col_end = std::min(n, ((block % col_blocks) + 1) * kGemmNc);
+      T edge[kMr * kNr];
+      for (std::size_t col = (block % col_blocks) * kGemmNc; col < col_end; col += kNr) {
+        const T *b_panel = packed_b + ((col / kNr) * kNr * kc);
+        for (std::size_t row = (block / col_blocks) * kGemmMc; row < row_end; row += kMr) {
+          const T *a_panel = packed_a + ((row / kMr) * kMr * kc);
+          T *tile = c + (row * ldc) + col;
+          const std::size_t rows = std::min(kMr, m - row);
+          const std::size_t cols = std::min(kNr, n - col);
+          if (rows == kMr && cols == kNr) {
+            Kernel::Run(kc, a_panel, b_panel, tile, ldc);
+            continue;
+          }
+          std::fill(edge, edge + (kMr * kNr), T{});
+          Kernel::Run(kc, a_panel, b_panel, edge, kNr);
+          for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t j = 0; j < cols; ++j) {
+              tile[(r * ldc) + j] += edge[(r * kNr) + j];
+            }
+          }
+        }
+      }
+    });
+  }
+}
+
+}  // namespace detail
+
+// C = alpha * A * B + beta * C for row-major A (m x k), B (k x n) and C (m x n) with row strides lda, ldb
+// and ldc. parallel_for(count, body) must call body(i) once for every i in [0, count), in any order and
+// on any threads; this is how each backend parallelizes the packing and the (ic, jc) block loops.
+template <typename T, typename ParallelFor = SerialFor>
+void Gemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda, const T *b,
+          std::size_t ldb, T beta, T *c, std::size_t ldc, GemmWorkspace<T> &workspace,
+          const ParallelFor &parallel_for = {}) {
+  detail::GemmPacked(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, workspace, parallel_for);
+}
+
+// Mixed precision: A and B are stored as In, for instance float, and widened to T, for instance double,
+// when they are packed, so that the products are summed in T. Reading A and B costs half as much memory
+// traffic as a plain double Gemm; the arithmetic is the same.
+template <typename T, typename In, typename ParallelFor = SerialFor>
+  requires(!std::is_same_v<T, In>)
+void Gemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const In *a, std::size_t lda, const In *b,
+          std::size_t ldb, T beta, T *c, std::size_t ldc, GemmWorkspace<T> &workspace,
+          const ParallelFor &parallel_for = {}) {
+  detail::GemmPacked(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, workspace, parallel_for);
+}
+
+// Same as the first overload with a workspace of its own
+template <typename T, typename ParallelFor = SerialFor>
+void Gemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda, const T *b,
+          std::size_t ldb, T beta, T *c, std::size_t ldc, const ParallelFor &parallel_for = {}) {
+  GemmWorkspace<T> workspace;
+  Gemm(m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, workspace, parallel_for);
+}
+
+}  // namespace ppc::linalg
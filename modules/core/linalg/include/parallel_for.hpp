@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if __has_include(<oneapi/tbb/parallel_for.h>)
+#include <oneapi/tbb/parallel_for.h>
+#endif
+
+// The parallel_for arguments of the kernels in ppc::linalg, ppc::sparse and ppc::sort. Each one runs body(i)
+// for every i in [0, count): SerialFor on the calling thread, the others on the threads of their runtime.
+// The OpenMP and TBB functors are there only when their runtime is, so that a task that does not use them
+// does not need it.
+
+namespace ppc::linalg {
+
+// Runs body(i) for every i in [0, count) on the calling thread
+struct SerialFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = 0; i < count; ++i) {
+      body(i);
+    }
+  }
+};
+
+#ifdef _OPENMP
+
+// Parallel loop over the OpenMP threads. Iterations are independent units of work of similar cost,
+// such as blocks of Gemm or column chunks of SpGemm, but the edge ones are smaller and the memory
+// traffic is not the same for all, hence the dynamic schedule.
+struct OmpFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+#pragma omp parallel for schedule(dynamic)
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(count); ++i) {
+      body(static_cast<std::size_t>(i));
+    }
+  }
+};
+
+// Fork-join over OpenMP tasks for recursive algorithms such as StrassenWinogradTasks: unlike OmpFor
+// it may be called again from inside body, and the inner loops become tasks of the same thread team
+// instead of serialized nested parallel regions. taskloop picks the chunking.
+struct OmpTaskFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    if (omp_in_parallel() != 0) {
+      Spawn(count, &body);
+      return;
+    }
+#pragma omp parallel
+#pragma omp single
+    Spawn(count, &body);
+  }
+
+ private:
+  // body goes by pointer: a reference argument would be copied into each task as firstprivate
+  template <typename Body>
+  static void Spawn(std::size_t count, const Body *body) {
+#pragma omp taskloop
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(count); ++i) {
+      (*body)(static_cast<std::size_t>(i));
+    }
+  }
+};
+
+#endif
+
+#if __has_include(<oneapi/tbb/parallel_for.h>)
+
+// Parallel loop over the worker threads of the current arena. It nests, so it serves recursive
+// algorithms as well.
+struct TbbFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    oneapi::tbb::parallel_for(std::size_t{0}, count, [&body](std::size_t i) { body(i); });
+  }
+};
+
+#endif
+
+}  // namespace ppc::linalg
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace ppc::linalg {
+
+// How far a result computed in some lower precision is from the same result computed in double
+struct ErrorStats {
+  // Largest |value - reference|
+  double max_abs = 0.0;
+  // max_abs relative to the largest |reference|, i.e. a normwise relative error
+  double max_rel = 0.0;
+};
+
+template <typename T>
+ErrorStats CompareToReference(const T *values, const double *reference, std::size_t count) {
+  double max_reference = 0.0;
+  ErrorStats stats;
+  for (std::size_t i = 0; i < count; ++i) {
+    stats.max_abs = std::max(stats.max_abs, std::abs(static_cast<double>(values[i]) - reference[i]));
+    max_reference = std::max(max_reference, std::abs(reference[i]));
+  }
+  stats.max_rel = max_reference > 0.0 ? stats.max_abs / max_reference : stats.max_abs;
+  return stats;
+}
+
+}  // namespace ppc::linalg
@@ -0,0 +1,343 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+
+namespace ppc::linalg {
+
+// Products with a dimension this small or smaller go straight to Gemm: below it a Strassen
+// level costs more in additions than the eighth of the multiplications it saves
+inline constexpr std::size_t kStrassenLeafSize = 256;
+
+inline bool IsStrassenLeaf(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size) {
+  return std::min({m, n, k}) <= std::max<std::size_t>(leaf_size, 1);
+}
+
+// Scratch elements StrassenWinograd needs for an m x k by k x n product: two temporaries per level
+inline std::size_t StrassenScratchSize(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size) {
+  std::size_t size = 0;
+  for (; !IsStrassenLeaf(m, n, k, leaf_size); m /= 2, n /= 2, k /= 2) {
+    size += ((m / 2) * std::max(k / 2, n / 2)) + ((k / 2) * (n / 2));
+  }
+  return size;
+}
+
+// Levels of StrassenWinogradTasks that run their seven products as concurrent tasks
+inline constexpr std::size_t kStrassenTaskDepth = 1;
+
+// Number of products in flight below task_depth task levels: 7^task_depth
+inline std::size_t StrassenTaskCount(std::size_t task_depth) {
+  std::size_t count = 1;
+  for (std::size_t level = 0; level < task_depth; ++level) {
+    count *= 7;
+  }
+  return count;
+}
+
+// Scratch elements StrassenWinogradTasks needs. A task level keeps all eight operand sums and the
+// three products that have no quadrant of C to live in, plus a region for each of its seven products.
+inline std::size_t StrassenTaskScratchSize(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size,
+                                           std::size_t task_depth) {
+  if (task_depth == 0 || IsStrassenLeaf(m, n, k, leaf_size)) {
+    return StrassenScratchSize(m, n, k, leaf_size);
+  }
+  const std::size_t hm = m / 2;
+  const std::size_t hn = n / 2;
+  const std::size_t hk = k / 2;
+  return (4 * hm * hk) + (4 * hk * hn) + (3 * hm * hn) +
+         (7 * StrassenTaskScratchSize(hm, hn, hk, leaf_size, task_depth - 1));
+}
+
+// Everything StrassenWinograd and StrassenWinogradTasks allocate: the recursion scratch and one Gemm
+// workspace per concurrent product. Reserve it in PreProcessing and Run is allocation-free.
+template <typename T>
+class StrassenWorkspace {
+ public:
+  void Reserve(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size = kStrassenLeafSize,
+               std::size_t task_depth = 0) {
+    const std::size_t size = StrassenTaskScratchSize(m, n, k, leaf_size, task_depth);
+    if (scratch_.size() < size) {
+      scratch_.resize(size);
+    }
+    const std::size_t count = StrassenTaskCount(task_depth);
+    if (gemm_.size() < count) {
+      gemm_.resize(count);
+    }
+    ReserveGemm(m, n, k, leaf_size, task_depth, 0);
+  }
+  T *Scratch() { return scratch_.data(); }
+  GemmWorkspace<T> &Gemm(std::size_t product = 0) { return gemm_[product]; }
+
+ private:
+  // The subtree of products starting at first uses Gemm workspaces [first, first + 7^task_depth)
+  void ReserveGemm(std::size_t m, std::size_t n, std::size_t k, std::size_t leaf_size, std::size_t task_depth,
+                   std::size_t first) {
+    gemm_[first].Reserve(m, n, k);
+    if (task_depth == 0 || IsStrassenLeaf(m, n, k, leaf_size)) {
+      return;
+    }
+    const std::size_t stride = StrassenTaskCount(task_depth - 1);
+    for (std::size_t product = 0; product < 7; ++product) {
+      ReserveGemm(m / 2, n / 2, k / 2, leaf_size, task_depth - 1, first + (product * stride));
+    }
+  }
+
+  std::vector<T> scratch_;
+  std::vector<GemmWorkspace<T>> gemm_ = std::vector<GemmWorkspace<T>>(1);
+};
+
+namespace detail {
+
+// out = x + y or out = x - y elementwise; out may be x or y
+template <bool kSubtract, typename T, typename ParallelFor>
+void Combine(std::size_t rows, std::size_t cols, const T *x, std::size_t ldx, const T *y, std::size_t ldy, T *out,
+             std::size_t ldo, const ParallelFor &parallel_for) {
+  parallel_for(rows, [&](std::size_t i) {
+    const T *x_row = x + (i * ldx);
+    const T *y_row = y + (i * ldy);
+    T *out_row = out + (i * ldo);
+    for (std::size_t j = 0; j < cols; ++j) {
+      out_row[j] = kSubtract ? x_row[j] - y_row[j] : x_row[j] + y_row[j];
+    }
+  });
+}
+
+// Dynamic peeling: odd dimensions leave one row, column or inner index outside the even core
+// that the Strassen step multiplied; this adds it with Gemm
+template <typename T, typename ParallelFor>
+void PeelOddEdges(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b,
+                  std::size_t ldb, T *c, std::size_t ldc, GemmWorkspace<T> &gemm, const ParallelFor &parallel_for) {
+  const std::size_t m2 = m - (m % 2);
+  const std::size_t n2 = n - (n % 2);
+  const std::size_t k2 = k - (k % 2);
+  if (k2 != k) {
+    Gemm(m2, n2, std::size_t{1}, T{1}, a + k2, lda, b + (k2 * ldb), ldb, T{1}, c, ldc, gemm, parallel_for);
+  }
+  if (n2 != n) {
+    Gemm(m2, std::size_t{1}, k, T{1}, a, lda, b + n2, ldb, T{}, c + n2, ldc, gemm, parallel_for);
+  }
+  if (m2 != m) {
+    Gemm(std::size_t{1}, n, k, T{1}, a + (m2 * lda), lda, b, ldb, T{}, c + (m2 * ldc), ldc, gemm, parallel_for);
+  }
+}
+
+template <typename T, typename ParallelFor>
+void StrassenWinogradStep(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b,
+                          std::size_t ldb, T *c, std::size_t ldc, T *scratch, GemmWorkspace<T> &gemm,
+                          std::size_t leaf_size, const ParallelFor &parallel_for) {
+  if (IsStrassenLeaf(m, n, k, leaf_size)) {
+    Gemm(m, n, k, T{1}, a, lda, b, ldb, T{}, c, ldc, gemm, parallel_for);
+    return;
+  }
+  const std::size_t hm = m / 2;
+  const std::size_t hn = n / 2;
+  const std::size_t hk = k / 2;
+  const T *a11 = a;
+  const T *a12 = a + hk;
+  const T *a21 = a + (hm * lda);
+  const T *a22 = a21 + hk;
+  const T *b11 = b;
+  const T *b12 = b + hn;
+  const T *b21 = b + (hk * ldb);
+  const T *b22 = b21 + hn;
+  T *c11 = c;
+  T *c12 = c + hn;
+  T *c21 = c + (hm * ldc);
+  T *c22 = c21 + hn;
+
+  // x holds a hm x hk sum of A blocks and later the hm x hn product P1; y a hk x hn sum of B blocks
+  T *x = scratch;
+  T *y = scratch + (hm * std::max(hk, hn));
+  T *deeper = y + (hk * hn);
+  auto add = [&](std::size_t rows, std::size_t cols, const T *p, std::size_t ldp, const T *q, std::size_t ldq, T *out,
+                 std::size_t ldo) { Combine<false>(rows, cols, p, ldp, q, ldq, out, ldo, parallel_for); };
+  auto sub = [&](std::size_t rows, std::size_t cols, const T *p, std::size_t ldp, const T *q, std::size_t ldq, T *out,
+                 std::size_t ldo) { Combine<true>(rows, cols, p, ldp, q, ldq, out, ldo, parallel_for); };
+  auto mul = [&](const T *p, std::size_t ldp, const T *q, std::size_t ldq, T *out, std::size_t ldo) {
+    StrassenWinogradStep(hm, hn, hk, p, ldp, q, ldq, out, ldo, deeper, gemm, leaf_size, parallel_for);
+  };
+
+  // Winograd's form with 7 products and 15 additions, scheduled so that two temporaries suffice
+  // (Douglas et al., GEMMW). Comments name the intermediates S1..S4, T1..T4, P1..P7, U1..U7.
+  sub(hm, hk, a11, lda, a21, lda, x, hk);     // S3
+  sub(hk, hn, b22, ldb, b12, ldb, y, hn);     // T3
+  mul(x, hk, y, hn, c21, ldc);                // P7
+  add(hm, hk, a21, lda, a22, lda, x, hk);     // S1
+  sub(hk, hn, b12, ldb, b11, ldb, y, hn);     // T1
+  mul(x, hk, y, hn, c22, ldc);                // P5
+  sub(hm, hk, x, hk, a11, lda, x, hk);        // S2 = S1 - A11
+  sub(hk, hn, b22, ldb, y, hn, y, hn);        // T2 = B22 - T1
+  mul(x, hk, y, hn, c12, ldc);                // P6
+  sub(hm, hk, a12, lda, x, hk, x, hk);        // S4 = A12 - S2
+  mul(x, hk, b22, ldb, c11, ldc);             // P3
+  mul(a11, lda, b11, ldb, x, hn);             // P1
+  add(hm, hn, x, hn, c12, ldc, c12, ldc);     // U2 = P1 + P6
+  add(hm, hn, c12, ldc, c21, ldc, c21, ldc);  // U3 = U2 + P7
+  add(hm, hn, c12, ldc, c22, ldc, c12, ldc);  // U4 = U2 + P5
+  add(hm, hn, c21, ldc, c22, ldc, c22, ldc);  // U7 = U3 + P5 = C22
+  add(hm, hn, c12, ldc, c11, ldc, c12, ldc);  // U5 = U4 + P3 = C12
+  sub(hk, hn, y, hn, b21, ldb, y, hn);        // T4 = T2 - B21
+  mul(a22, lda, y, hn, c11, ldc);             // P4
+  sub(hm, hn, c21, ldc, c11, ldc, c21, ldc);  // U6 = U3 - P4 = C21
+  mul(a12, lda, b21, ldb, c11, ldc);          // P2
+  add(hm, hn, x, hn, c11, ldc, c11, ldc);     // U1 = P1 + P2 = C11
+
+  PeelOddEdges(m, n, k, a, lda, b, ldb, c, ldc, gemm, parallel_for);
+}
+
+// One level of StrassenWinogradTasks; see there. gemm points to the 7^task_depth Gemm workspaces of
+// this subtree.
+template <typename T, typename ForkJoin>
+void StrassenWinogradTaskStep(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b,
+                              std::size_t ldb, T *c, std::size_t ldc, T *scratch, GemmWorkspace<T> *gemm,
+                              std::size_t leaf_size, std::size_t task_depth, const ForkJoin &fork) {
+  if (task_depth == 0 || IsStrassenLeaf(m, n, k, leaf_size)) {
+    StrassenWinogradStep(m, n, k, a, lda, b, ldb, c, ldc, scratch, *gemm, leaf_size, fork);
+    return;
+  }
+  const std::size_t hm = m / 2;
+  const std::size_t hn = n / 2;
+  const std::size_t hk = k / 2;
+  const T *a11 = a;
+  const T *a12 = a + hk;
+  const T *a21 = a + (hm * lda);
+  const T *a22 = a21 + hk;
+  const T *b11 = b;
+  const T *b12 = b + hn;
+  const T *b21 = b + (hk * ldb);
+  const T *b22 = b21 + hn;
+  T *c11 = c;
+  T *c12 = c + hn;
+  T *c21 = c + (hm * ldc);
+  T *c22 = c21 + hn;
+
+  // Same intermediates as StrassenWinogradStep, but each in its own buffer so that the products
+  // are independent. P2..P5 are written to the quadrants of C, P1, P6 and P7 to scratch.
+  T *s1 = scratch;
+  T *s2 = s1 + (hm * hk);
+  T *s3 = s2 + (hm * hk);
+  T *s4 = s3 + (hm * hk);
+  T *t1 = s4 + (hm * hk);
+  T *t2 = t1 + (hk * hn);
+  T *t3 = t2 + (hk * hn);
+  T *t4 = t3 + (hk * hn);
+  T *p1 = t4 + (hk * hn);
+  T *p6 = p1 + (hm * hn);
+  T *p7 = p6 + (hm * hn);
+  T *deeper = p7 + (hm * hn);
+  const std::size_t deeper_size = StrassenTaskScratchSize(hm, hn, hk, leaf_size, task_depth - 1);
+  const std::size_t deeper_gemm = StrassenTaskCount(task_depth - 1);
+  auto mul = [&](std::size_t product, const T *p, std::size_t ldp, const T *q, std::size_t ldq, T *out,
+                 std::size_t ldo) {
+    StrassenWinogradTaskStep(hm, hn, hk, p, ldp, q, ldq, out, ldo, deeper + (product * deeper_size),
+                             gemm + (product * deeper_gemm), leaf_size, task_depth - 1, fork);
+  };
+
+  // P1 and P2 need no sums and start at once; the other five wait for the sums, which are built a
+  // row at a time, all four of a side in one pass
+  fork(3, [&](std::size_t task) {
+    if (task == 0) {
+      mul(0, a11, lda, b11, ldb, p1, hn);
+      return;
+    }
+    if (task == 1) {
+      mul(1, a12, lda, b21, ldb, c11, ldc);
+      return;
+    }
+    fork(hm + hk, [&](std::size_t row) {
+      if (row < hm) {
+        const std::size_t i = row;
+        for (std::size_t j = 0; j < hk; ++j) {
+          const std::size_t at = (i * hk) + j;
+          const std::size_t ij = (i * lda) + j;
+          s1[at] = a21[ij] + a22[ij];
+          s2[at] = s1[at] - a11[ij];
+          s3[at] = a11[ij] - a21[ij];
+          s4[at] = a12[ij] - s2[at];
+        }
+      } else {
+        const std::size_t i = row - hm;
+        for (std::size_t j = 0; j < hn; ++j) {
+          const std::size_t at = (i * hn) + j;
+          const std::size_t ij = (i * ldb) + j;
+          t1[at] = b12[ij] - b11[ij];
+          t2[at] = b22[ij] - t1[at];
+          t3[at] = b22[ij] - b12[ij];
+          t4[at] = t2[at] - b21[ij];
+        }
+      }
+    });
+    fork(5, [&](std::size_t product) {
+      switch (product) {
+        case 0:
+          mul(2, s4, hk, b22, ldb, c12, ldc);
+          break;
+        case 1:
+          mul(3, a22, lda, t4, hn, c21, ldc);
+          break;
+        case 2:
+          mul(4, s1, hk, t1, hn, c22, ldc);
+          break;
+        case 3:
+          mul(5, s2, hk, t2, hn, p6, hn);
+          break;
+        default:
+          mul(6, s3, hk, t3, hn, p7, hn);
+          break;
+      }
+    });
+  });
+
+  // All seven U sums of the schedule fused into a single pass over C
+  fork(hm, [&](std::size_t i) {
+    for (std::size_t j = 0; j < hn; ++j) {
+      const std::size_t at = (i * hn) + j;
+      const std::size_t ij = (i * ldc) + j;
+      const T u2 = p1[at] + p6[at];
+      const T u3 = u2 + p7[at];
+      c11[ij] += p1[at];
+      c12[ij] += u2 + c22[ij];
+      c21[ij] = u3 - c21[ij];
+      c22[ij] += u3;
+    }
+  });
+
+  PeelOddEdges(m, n, k, a, lda, b, ldb, c, ldc, *gemm, fork);
+}
+
+}  // namespace detail
+
+// C = A * B for row-major A (m x k), B (k x n) and C (m x n) with row strides lda, ldb and ldc.
+// Strassen-Winograd recursion on views of the operands: every level works on the even-sized core
+// of the product and fixes up an odd row, column or inner index with Gemm, so nothing is padded.
+// Products with a dimension of at most leaf_size are left to Gemm. parallel_for is used by the
+// additions and by Gemm, see Gemm for its contract.
+template <typename T, typename ParallelFor = SerialFor>
+void StrassenWinograd(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b,
+                      std::size_t ldb, T *c, std::size_t ldc, StrassenWorkspace<T> &workspace,
+                      std::size_t leaf_size = kStrassenLeafSize, const ParallelFor &parallel_for = {}) {
+  workspace.Reserve(m, n, k, leaf_size);
+  detail::StrassenWinogradStep(m, n, k, a, lda, b, ldb, c, ldc, workspace.Scratch(), workspace.Gemm(), leaf_size,
+                               parallel_for);
+}
+
+// Task-parallel form of StrassenWinograd. In the top task_depth levels the seven products run as
+// concurrent tasks, with operands and results in separate buffers and the additions fused into one
+// pass per side and one over C; below that each product runs StrassenWinograd. The memory needed
+// grows with task_depth (StrassenTaskScratchSize). fork(count, body) has the contract of Gemm's
+// parallel_for and must also be callable from inside body, waiting only for its own iterations;
+// it drives the products, the additions and Gemm alike, so idle threads pick up work at any level.
+template <typename T, typename ForkJoin = SerialFor>
+void StrassenWinogradTasks(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b,
+                           std::size_t ldb, T *c, std::size_t ldc, StrassenWorkspace<T> &workspace,
+                           std::size_t leaf_size = kStrassenLeafSize, std::size_t task_depth = kStrassenTaskDepth,
+                           const ForkJoin &fork = {}) {
+  workspace.Reserve(m, n, k, leaf_size, task_depth);
+  detail::StrassenWinogradTaskStep(m, n, k, a, lda, b, ldb, c, ldc, workspace.Scratch(), &workspace.Gemm(), leaf_size,
+                                   task_depth, fork);
+}
+
+}  // namespace ppc::linalg
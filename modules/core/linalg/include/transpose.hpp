@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace ppc::linalg {
+
+// Side of the square tiles the transposes work on: a tile of the source and one of the destination
+// stay in L1 together, so every cache line is read and written once
+inline constexpr std::size_t kTransposeTile = 32;
+
+// Transposes a kSize x kSize block in registers: dst[j][i] = src[i][j], with row strides lds and ldd.
+// The generic version leaves the vectorization to the compiler.
+template <typename T>
+struct TransposeKernel {
+  static constexpr std::size_t kSize = 4;
+
+  static void Run(const T *src, std::size_t lds, T *dst, std::size_t ldd) {
+    for (std::size_t i = 0; i < kSize; ++i) {
+      for (std::size_t j = 0; j < kSize; ++j) {
+        dst[(j * ldd) + i] = src[(i * lds) + j];
+      }
+    }
+  }
+};
+
+#if defined(__AVX__)
+
+template <>
+struct TransposeKernel<double> {
+  static constexpr std::size_t kSize = 4;
+
+  static void Run(const double *src, std::size_t lds, double *dst, std::size_t ldd) {
+    const __m256d r0 = _mm256_loadu_pd(src);
+    const __m256d r1 = _mm256_loadu_pd(src + lds);
+    const __m256d r2 = _mm256_loadu_pd(src + (2 * lds));
+    const __m256d r3 = _mm256_loadu_pd(src + (3 * lds));
+    // Pairs of rows interleaved within the 128-bit lanes, then the lanes exchanged
+    const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+    _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(dst + ldd, _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(dst + (2 * ldd), _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(dst + (3 * ldd), _mm256_permute2f128_pd(t1, t3, 0x31));
+  }
+};
+
+template <>
+struct TransposeKernel<float> {
+  static constexpr std::size_t kSize = 8;
+
+  static void Run(const float *src, std::size_t lds, float *dst, std::size_t ldd) {
+    __m256 r[8];
+    for (std::size_t i = 0; i < 8; ++i) {
+      r[i] = _mm256_loadu_ps(src + (i * lds));
+    }
+    // 2x2 blocks of single elements, then of pairs, then the 128-bit lanes, as for double
+    __m256 t[8];
+    for (std::size_t i = 0; i < 8; i += 2) {
+      t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+      t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+    }
+    for (std::size_t i = 0; i < 8; i += 4) {
+      r[i] = _mm256_shuffle_ps(t[i], t[i + 2], 0x44);
+      r[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], 0xEE);
+      r[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], 0x44);
+      r[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], 0xEE);
+    }
+    for (std::size_t i = 0; i < 4; ++i) {
+      _mm256_storeu_ps(dst + (i * ldd), _mm256_permute2f128_ps(r[i], r[i + 4], 0x20));
+      _mm256_storeu_ps(dst + ((i + 4) * ldd), _mm256_permute2f128_ps(r[i], r[i + 4], 0x31));
+    }
+  }
+};
+
+#endif
+
+namespace detail {
+
+// dst = src^T for a rows x cols block of at most a tile: whole kernel blocks first, the edges element by element
+template <typename T>
+void TransposeTile(std::size_t rows, std::size_t cols, const T *src, std::size_t lds, T *dst, std::size_t ldd) {
+  constexpr std::size_t kSize = TransposeKernel<T>::kSize;
+  const std::size_t full_rows = rows - (rows % kSize);
+  const std::size_t full_cols = cols - (cols % kSize);
+  for (std::size_t i = 0; i < full_rows; i += kSize) {
+    for (std::size_t j = 0; j < full_cols; j += kSize) {
+      TransposeKernel<T>::Run(src + (i * lds) + j, lds, dst + (j * ldd) + i, ldd);
+    }
+  }
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = (i < full_rows ? full_cols : 0); j < cols; ++j) {
+      dst[(j * ldd) + i] = src[(i * lds) + j];
+    }
+  }
+}
+
+}  // namespace detail
+
+// dst (cols x rows, row stride ldd) = src^T for a row-major rows x cols src with row stride lds.
+// The tiles are independent and go to parallel_for(count, body) as in Gemm.
+template <typename T, typename ParallelFor = SerialFor>
+void Transpose(std::size_t rows, std::size_t cols, const T *src, std::size_t lds, T *dst, std::size_t ldd,
+               const ParallelFor &parallel_for = {}) {
+  const BlockTiling row_tiles(rows, kTransposeTile);
+  const BlockTiling col_tiles(cols, kTransposeTile);
+  parallel_for(row_tiles.Count() * col_tiles.Count(), [&](std::size_t tile) {
+    const std::size_t bi = tile / col_tiles.Count();
+    const std::size_t bj = tile % col_tiles.Count();
+    const T *from = src + (row_tiles.Begin(bi) * lds) + col_tiles.Begin(bj);
+    T *to = dst + (col_tiles.Begin(bj) * ldd) + row_tiles.Begin(bi);
+    detail::TransposeTile(row_tiles.Size(bi), col_tiles.Size(bj), from, lds, to, ldd);
+  });
+}
+
+// Transposes the n x n matrix a with row stride lda in place. Each pair of tiles mirrored across the
+// diagonal is swapped by one body through a tile-sized buffer, so that no two bodies touch the same tile.
+template <typename T, typename ParallelFor = SerialFor>
+void TransposeInPlace(std::size_t n, T *a, std::size_t lda, const ParallelFor &parallel_for = {}) {
+  const BlockTiling tiles(n, kTransposeTile);
+  const std::size_t count = tiles.Count();
+  parallel_for(count * count, [&](std::size_t tile) {
+    const std::size_t bi = tile / count;
+    const std::size_t bj = tile % count;
+    if (bi > bj) {
+      return;
+    }
+    const std::size_t rows = tiles.Size(bi);
+    const std::size_t cols = tiles.Size(bj);
+    T *upper = a + (tiles.Begin(bi) * lda) + tiles.Begin(bj);
+    T *lower = a + (tiles.Begin(bj) * lda) + tiles.Begin(bi);
+    T buffer[kTransposeTile * kTransposeTile];
+    // buffer = upper^T, then upper = lower^T and lower = buffer; on the diagonal upper and lower coincide
+    detail::TransposeTile(rows, cols, upper, lda, buffer, kTransposeTile);
+    if (bi != bj) {
+      detail::TransposeTile(cols, rows, lower, lda, upper, lda);
+    }
+    for (std::size_t j = 0; j < cols; ++j) {
+      std::copy(buffer + (j * kTransposeTile), buffer + (j * kTransposeTile) + rows, lower + (j * lda));
+    }
+  });
+}
+
+// Block-major layout of a rows x cols matrix: its block x block tiles one after another in row-major
+// order of the tiles, each stored densely in row-major order. Edge tiles keep their smaller size, so the
+// layout takes rows * cols elements and a tile of a Fox or Cannon step is one contiguous range.
+// Offset of tile (bi, bj) in that layout; it has BlockTiling(rows, block).Size(bi) rows.
+inline std::size_t BlockMajorOffset(std::size_t rows, std::size_t cols, std::size_t block, std::size_t bi,
+                                    std::size_t bj) {
+  const BlockTiling row_tiles(rows, block);
+  const BlockTiling col_tiles(cols, block);
+  return (row_tiles.Begin(bi) * cols) + (col_tiles.Begin(bj) * row_tiles.Size(bi));
+}
+
+// dst (block-major, see BlockMajorOffset) = src (row-major with row stride lds)
+template <typename T, typename ParallelFor = SerialFor>
+void RowToBlockMajor(std::size_t rows, std::size_t cols, std::size_t block, const T *src, std::size_t lds, T *dst,
+                     const ParallelFor &parallel_for = {}) {
+  const BlockTiling row_tiles(rows, block);
+  const BlockTiling col_tiles(cols, block);
+  parallel_for(row_tiles.Count() * col_tiles.Count(), [&](std::size_t tile) {
+    const std::size_t bi = tile / col_tiles.Count();
+    const std::size_t bj = tile % col_tiles.Count();
+    const std::size_t width = col_tiles.Size(bj);
+    const T *from = src + (row_tiles.Begin(bi) * lds) + col_tiles.Begin(bj);
+    T *to = dst + BlockMajorOffset(rows, cols, block, bi, bj);
+    for (std::size_t i = 0; i < row_tiles.Size(bi); ++i) {
+      std::copy(from + (i * lds), from + (i * lds) + width, to + (i * width));
+    }
+  });
+}
+
+// dst (row-major with row stride ldd) = src (block-major, see BlockMajorOffset)
+template <typename T, typename ParallelFor = SerialFor>
+void BlockToRowMajor(std::size_t rows, std::size_t cols, std::size_t block, const T *src, T *dst, std::size_t ldd,
+                     const ParallelFor &parallel_for = {}) {
+  const BlockTiling row_tiles(rows, block);
+  const BlockTiling col_tiles(cols, block);
+  parallel_for(row_tiles.Count() * col_tiles.Count(), [&](std::size_t tile) {
+    const std::size_t bi = tile / col_tiles.Count();
+    const std::size_t bj = tile % col_tiles.Count();
+    const std::size_t width = col_tiles.Size(bj);
+    const T *from = src + BlockMajorOffset(rows, cols, block, bi, bj);
+    T *to = dst + (row_tiles.Begin(bi) * ldd) + col_tiles.Begin(bj);
+    for (std::size_t i = 0; i < row_tiles.Size(bi); ++i) {
+      std::copy(from + (i * width), from + ((i + 1) * width), to + (i * ldd));
+    }
+  });
+}
+
+}  // namespace ppc::linalg
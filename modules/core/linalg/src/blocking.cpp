@@ -0,0 +1,122 @@
+#include "core/linalg/include/blocking.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+
+#include <cstdint>
+#elif defined(__linux__)
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#endif
+
+namespace {
+
+#if defined(__APPLE__)
+
+std::size_t QuerySysctl(const char *name) {
+  std::int64_t value = 0;
+  std::size_t size = sizeof(value);
+  if (sysctlbyname(name, &value, &size, nullptr, 0) != 0 || value <= 0) {
+    return 0;
+  }
+  return static_cast<std::size_t>(value);
+}
+
+ppc::linalg::CacheSizes QueryCacheSizes() {
+  return {.l1 = QuerySysctl("hw.l1dcachesize"), .l2 = QuerySysctl("hw.l2cachesize")};
+}
+
+#elif defined(__linux__)
+
+// Size of the data or unified cache of the given level of cpu0 as listed in sysfs, e.g. "48K"
+std::size_t QuerySysfs(int level) {
+  for (int index = 0;; ++index) {
+    const std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+    std::ifstream level_file(dir + "level");
+    int cache_level = 0;
+    if (!(level_file >> cache_level)) {
+      return 0;
+    }
+    std::string type;
+    std::ifstream(dir + "type") >> type;
+    if (cache_level != level || type == "Instruction") {
+      continue;
+    }
+    std::size_t size = 0;
+    char unit = 0;
+    std::ifstream(dir + "size") >> size >> unit;
+    if (unit == 'K') {
+      size *= 1024;
+    } else if (unit == 'M') {
+      size *= 1024 * 1024;
+    }
+    return size;
+  }
+}
+
+ppc::linalg::CacheSizes QueryCacheSizes() {
+  ppc::linalg::CacheSizes sizes{.l1 = 0, .l2 = 0};
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+  const long l1 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+  const long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+  sizes.l1 = l1 > 0 ? static_cast<std::size_t>(l1) : 0;
+  sizes.l2 = l2 > 0 ? static_cast<std::size_t>(l2) : 0;
+#endif
+  // Some C libraries do not know the caches of every CPU, the kernel does
+  if (sizes.l1 == 0) {
+    sizes.l1 = QuerySysfs(1);
+  }
+  if (sizes.l2 == 0) {
+    sizes.l2 = QuerySysfs(2);
+  }
+  return sizes;
+}
+
+#else
+
+ppc::linalg::CacheSizes QueryCacheSizes() { return {.l1 = 0, .l2 = 0}; }
+
+#endif
+
+}  // namespace
+
+const ppc::linalg::CacheSizes &ppc::linalg::GetCacheSizes() {
+  static const CacheSizes kSizes = [] {
+    const CacheSizes defaults;
+    CacheSizes sizes = QueryCacheSizes();
+    if (sizes.l1 == 0) {
+      sizes.l1 = defaults.l1;
+    }
+    if (sizes.l2 == 0) {
+      sizes.l2 = std::max(defaults.l2, sizes.l1);
+    }
+    return sizes;
+  }();
+  return kSizes;
+}
+
+std::size_t ppc::linalg::ChooseBlockSize(std::size_t n, std::size_t element_size, const CacheSizes &caches) {
+  if (n == 0 || 3 * n * n * element_size <= caches.l1) {
+    return std::max<std::size_t>(n, 1);
+  }
+  const std::size_t line = std::max<std::size_t>(64 / element_size, 1);
+  auto block = static_cast<std::size_t>(std::sqrt(static_cast<double>(caches.l2) / (2.0 * 3.0 * element_size)));
+  block = std::max(line, (block / line) * line);
+  return std::min(block, n);
+}
+
+std::size_t ppc::linalg::ChooseDividingBlockSize(std::size_t n, std::size_t element_size, const CacheSizes &caches) {
+  for (std::size_t block = ChooseBlockSize(n, element_size, caches); block > 1; --block) {
+    if (n % block == 0) {
+      return block;
+    }
+  }
+  return 1;
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/sort_benchmark.hpp"
+#include "core/util/include/sort_inputs.hpp"
+
+namespace {
+
+using ppc::core::SortBenchmarkResult;
+
+// Sums in an OpenMP parallel region, which a forked child of a process with a running thread pool
+// would hang on
+int ParallelSum(std::size_t size) {
+  int sum = 0;
+#pragma omp parallel for reduction(+ : sum)
+  for (int i = 0; i < static_cast<int>(size); ++i) {
+    sum += 1;
+  }
+  return sum;
+}
+
+}  // namespace
+
+// The only test of the suite that calls RunSortBenchmark: the re-executed binary runs the whole suite
+TEST(sort_benchmark, runs_every_case_in_a_process_of_its_own) {
+  ASSERT_EQ(ParallelSum(1000), 1000);
+  const std::vector<ppc::core::SortBenchmarkCase> cases = {
+      {"sorts",
+       [](ppc::util::Distribution, std::size_t size) {
+         SortBenchmarkResult result;
+         result.status = ParallelSum(size) == static_cast<int>(size) ? SortBenchmarkResult::Status::kSorted
+                                                                     : SortBenchmarkResult::Status::kWrong;
+         return result;
+       }},
+      {"crashes",
+       [](ppc::util::Distribution, std::size_t) -> SortBenchmarkResult { std::abort(); }},
+      {"missorts",
+       [](ppc::util::Distribution, std::size_t) {
+         SortBenchmarkResult result;
+         result.status = SortBenchmarkResult::Status::kWrong;
+         return result;
+       }},
+  };
+
+  const std::vector<std::string> problems = ppc::core::RunSortBenchmark("sort_benchmark", cases);
+  // A failing case stops at the first size of every distribution
+  const std::size_t distributions = ppc::util::kComparableDistributions.size();
+  ASSERT_EQ(problems.size(), 2 * distributions);
+  EXPECT_EQ(problems.front(), "crashes: CRASHED on uniform, n=10000");
+  EXPECT_EQ(problems.back(), "missorts: WRONG on extremes, n=10000");
+
+  const std::vector<std::string> unexpected =
+      ppc::core::UnexpectedSortProblems(problems, std::set<std::string>{"crashes"});
+  ASSERT_EQ(unexpected.size(), distributions);
+  EXPECT_EQ(unexpected.front(), "missorts: WRONG on uniform, n=10000");
+}
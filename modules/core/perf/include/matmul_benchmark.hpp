@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/precision.hpp"
+
+namespace ppc::core {
+
+// Computes the row-major n x n product c = a * b
+using MatmulRun = std::function<void(const double *a, const double *b, double *c)>;
+
+struct MatmulBenchmarkCase {
+  std::string name;
+  // Called untimed for every size; does the allocations and returns the timed run
+  std::function<MatmulRun(std::size_t)> prepare;
+  // Larger sizes are skipped, for cases whose memory grows faster than the matrices
+  std::size_t max_size = std::numeric_limits<std::size_t>::max();
+  // Replaces the tolerance of RunMatmulBenchmark when nonzero, for cases in a lower precision
+  double tolerance = 0.0;
+};
+
+// Product of row-major n x n matrices of In into Out
+template <typename In, typename Out = In>
+using TypedMatmulRun = std::function<void(const In *a, const In *b, Out *c)>;
+
+// Runs a product in another element type on converted copies of the double inputs, and widens the result
+// back for the comparison with the other cases. The conversions are timed with the product, but they are
+// O(n^2) memory passes against its O(n^3) arithmetic.
+template <typename In, typename Out = In>
+MatmulRun ConvertingRun(std::size_t size, std::type_identity_t<TypedMatmulRun<In, Out>> run) {
+  auto a_in = std::make_shared<std::vector<In>>(size * size);
+  auto b_in = std::make_shared<std::vector<In>>(size * size);
+  auto c_out = std::make_shared<std::vector<Out>>(size * size);
+  return [a_in, b_in, c_out, run = std::move(run)](const double *a, const double *b, double *c) {
+    std::copy(a, a + a_in->size(), a_in->begin());
+    std::copy(b, b + b_in->size(), b_in->begin());
+    run(a_in->data(), b_in->data(), c_out->data());
+    std::ranges::copy(*c_out, c);
+  };
+}
+
+// Sizes of the matmul benchmark; PPC_MATMUL_BENCHMARK_FULL=1 adds the large ones
+inline std::vector<std::size_t> MatmulBenchmarkSizes() {
+  std::vector<std::size_t> sizes = {1024, 2048};
+  const char *full = std::getenv("PPC_MATMUL_BENCHMARK_FULL");  // NOLINT(concurrency-mt-unsafe)
+  if (full != nullptr && std::string(full) == "1") {
+    sizes.insert(sizes.end(), {4096, 8192});
+  }
+  return sizes;
+}
+
+// Runs every case on every size, printing one line per run:
+//   <suite>: case=<name> n=<size> time=<seconds> max_diff=<largest difference from the first case>
+//            rel_error=<max_diff relative to the largest element of the first case>
+// Returns a description of every run whose result differs from the first case by more than
+// tolerance * n, the rounding error that Strassen-type algorithms are allowed to accumulate.
+inline std::vector<std::string> RunMatmulBenchmark(const std::string &suite,
+                                                   const std::vector<MatmulBenchmarkCase> &cases,
+                                                   double tolerance = 1e-10) {
+  std::vector<std::string> problems;
+  for (std::size_t size : MatmulBenchmarkSizes()) {
+    std::mt19937 gen(static_cast<unsigned>(size));
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> a(size * size);
+    std::vector<double> b(size * size);
+    std::ranges::generate(a, [&] { return dist(gen); });
+    std::ranges::generate(b, [&] { return dist(gen); });
+    std::vector<double> reference;
+
+    for (const auto &matmul_case : cases) {
+      if (size > matmul_case.max_size) {
+        continue;
+      }
+      std::vector<double> c(size * size);
+      const MatmulRun run = matmul_case.prepare(size);
+      const auto start = std::chrono::high_resolution_clock::now();
+      run(a.data(), b.data(), c.data());
+      const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+      ppc::linalg::ErrorStats error;
+      if (reference.empty()) {
+        reference = std::move(c);
+      } else {
+        error = ppc::linalg::CompareToReference(c.data(), reference.data(), c.size());
+      }
+      const double max_diff = error.max_abs;
+      std::cout << suite << ": case=" << matmul_case.name << " n=" << size << " time=" << elapsed.count()
+                << " max_diff=" << max_diff << " rel_error=" << error.max_rel << '\n';
+      const double case_tolerance = matmul_case.tolerance != 0.0 ? matmul_case.tolerance : tolerance;
+      if (!(max_diff <= case_tolerance * static_cast<double>(size))) {
+        problems.push_back(matmul_case.name + ": max_diff " + std::to_string(max_diff) +
+                           ", n=" + std::to_string(size));
+      }
+    }
+  }
+  return problems;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <csignal>
+#endif
+
+#include "core/task/include/task.hpp"
+#include "core/util/include/sort_inputs.hpp"
+
+namespace ppc::core {
+
+struct SortBenchmarkResult {
+  enum class Status : uint8_t {
+    kSorted,
+    kWrong,     // the output is not the sorted input
+    kRejected,  // Validation() returned false
+    kCrashed,   // the run was killed by a signal
+    kTimeout,   // the run did not finish within the time limit
+  } status = Status::kRejected;
+  double time_sec = 0.0;  // time of Run() only
+};
+
+struct SortBenchmarkCase {
+  std::string name;
+  std::function<SortBenchmarkResult(util::Distribution, std::size_t)> run;
+};
+
+// Validates and runs a task once, timing Run(), and checks that out holds the sorted in
+template <typename T>
+SortBenchmarkResult RunSortBenchmarkTask(Task &task, std::vector<T> &in, const std::vector<T> &out) {
+  // Benchmark runs are not bound by the time limit of functional tests
+  task.GetData()->state_of_testing = TaskData::StateOfTesting::kPerf;
+
+  SortBenchmarkResult result;
+  if (!task.Validation()) {
+    return result;
+  }
+  task.PreProcessing();
+  const auto start = std::chrono::high_resolution_clock::now();
+  task.Run();
+  const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+  task.PostProcessing();
+
+  result.time_sec = elapsed.count();
+  std::ranges::sort(in);
+  result.status = out == in ? SortBenchmarkResult::Status::kSorted : SortBenchmarkResult::Status::kWrong;
+  return result;
+}
+
+// Case for a task that sorts inputs[0] into outputs[0], both arrays of T whose counts are the element
+// count. make_task receives task data with this layout and may append task-specific inputs to it.
+template <typename T>
+SortBenchmarkCase MakeSortBenchmarkCase(std::string name,
+                                        std::function<std::shared_ptr<Task>(TaskDataPtr)> make_task) {
+  return {std::move(name), [make_task = std::move(make_task)](util::Distribution distribution, std::size_t size) {
+            std::vector<T> in = util::GenerateSortInput<T>(distribution, size);
+            std::vector<T> out(size);
+
+            auto task_data = std::make_shared<TaskData>();
+            task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+            task_data->inputs_count.emplace_back(in.size());
+            task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+            task_data->outputs_count.emplace_back(out.size());
+
+            auto task = make_task(task_data);
+            return RunSortBenchmarkTask(*task, in, out);
+          }};
+}
+
+// Same as above for tasks whose inputs[0] and outputs[0] point to a std::vector<T> object
+template <typename T>
+SortBenchmarkCase MakeVectorSortBenchmarkCase(std::string name,
+                                              std::function<std::shared_ptr<Task>(TaskDataPtr)> make_task) {
+  return {std::move(name), [make_task = std::move(make_task)](util::Distribution distribution, std::size_t size) {
+            std::vector<T> in = util::GenerateSortInput<T>(distribution, size);
+            std::vector<T> out(size);
+
+            auto task_data = std::make_shared<TaskData>();
+            task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&in));
+            task_data->inputs_count.emplace_back(in.size());
+            task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(&out));
+            task_data->outputs_count.emplace_back(out.size());
+
+            auto task = make_task(task_data);
+            return RunSortBenchmarkTask(*task, in, out);
+          }};
+}
+
+template <typename TaskType, typename T>
+SortBenchmarkCase MakeSortBenchmarkCase(std::string name) {
+  return MakeSortBenchmarkCase<T>(
+      std::move(name), [](TaskDataPtr task_data) { return std::make_shared<TaskType>(std::move(task_data)); });
+}
+
+// Sizes of the sort benchmark matrix; PPC_SORT_BENCHMARK_FULL=1 adds the large ones
+inline std::vector<std::size_t> SortBenchmarkSizes() {
+  std::vector<std::size_t> sizes = {10000, 100000};
+  const char *full = std::getenv("PPC_SORT_BENCHMARK_FULL");  // NOLINT(concurrency-mt-unsafe)
+  if (full != nullptr && std::string(full) == "1") {
+    sizes.insert(sizes.end(), {1000000, 4000000});
+  }
+  return sizes;
+}
+
+#ifdef __linux__
+
+// Set in the environment of a re-executed benchmark binary, which then runs a single case and writes
+// its result to a pipe: "<pipe fd> <distribution> <size> <case name>"
+inline constexpr const char *kSortBenchmarkChildVar = "PPC_SORT_BENCHMARK_CHILD";
+
+// Child side of RunSortBenchmarkIsolated; does not return
+[[noreturn]] inline void RunSortBenchmarkChild(const std::string &request,
+                                               const std::vector<SortBenchmarkCase> &cases) {
+  std::istringstream parse(request);
+  int fd = -1;
+  int distribution = 0;
+  std::size_t size = 0;
+  std::string name;
+  parse >> fd >> distribution >> size >> name;
+  const auto it = std::ranges::find(cases, name, &SortBenchmarkCase::name);
+  if (!parse || it == cases.end()) {
+    _exit(1);
+  }
+  const SortBenchmarkResult result = it->run(static_cast<util::Distribution>(distribution), size);
+  const bool written = write(fd, &result, sizeof(result)) == static_cast<ssize_t>(sizeof(result));
+  _exit(written ? 0 : 1);
+}
+
+#endif
+
+// Runs one case in a fresh process, so that a task which crashes or hangs on some input only fails
+// its own run. The benchmark binary re-executes itself instead of only forking: a forked child of a
+// process with running OpenMP or TBB thread pools inherits the pools without their threads, and
+// hangs on its first parallel region. suite has to be the gtest suite that calls RunSortBenchmark.
+// Outside of Linux the case runs in-process.
+inline SortBenchmarkResult RunSortBenchmarkIsolated(const std::string &suite, const SortBenchmarkCase &sort_case,
+                                                    util::Distribution distribution, std::size_t size,
+                                                    unsigned timeout_sec) {
+#ifndef __linux__
+  return sort_case.run(distribution, size);
+#else
+  std::array<int, 2> channel{};
+  if (pipe(channel.data()) != 0) {
+    return sort_case.run(distribution, size);
+  }
+
+  // Only async-signal-safe calls may follow fork(), so the arguments of execve() are built here
+  std::string exe = "/proc/self/exe";
+  std::string filter = "--gtest_filter=" + suite + ".*";
+  std::array<char *, 3> argv = {exe.data(), filter.data(), nullptr};
+  std::string request = std::string(kSortBenchmarkChildVar) + '=' + std::to_string(channel[1]) + ' ' +
+                        std::to_string(static_cast<int>(distribution)) + ' ' + std::to_string(size) + ' ' +
+                        sort_case.name;
+  std::vector<char *> envp;
+  for (char **var = environ; *var != nullptr; ++var) {
+    envp.push_back(*var);
+  }
+  envp.push_back(request.data());
+  envp.push_back(nullptr);
+  const int null_fd = open("/dev/null", O_WRONLY);
+
+  std::cout.flush();
+  const pid_t child = fork();
+  if (child == 0) {
+    close(channel[0]);
+    if (null_fd >= 0) {
+      // The gtest report of the child is noise
+      dup2(null_fd, STDOUT_FILENO);
+    }
+    // The timer survives execve()
+    alarm(timeout_sec);
+    execve(exe.c_str(), argv.data(), envp.data());
+    _exit(1);
+  }
+  if (null_fd >= 0) {
+    close(null_fd);
+  }
+  close(channel[1]);
+  SortBenchmarkResult result;
+  const bool received = child > 0 && read(channel[0], &result, sizeof(result)) == static_cast<ssize_t>(sizeof(result));
+  close(channel[0]);
+  int wait_status = 0;
+  if (child > 0) {
+    waitpid(child, &wait_status, 0);
+  }
+  if (!received) {
+    result = {};
+    const bool timed_out = WIFSIGNALED(wait_status) && WTERMSIG(wait_status) == SIGALRM;
+    result.status = timed_out ? SortBenchmarkResult::Status::kTimeout : SortBenchmarkResult::Status::kCrashed;
+    result.time_sec = timed_out ? static_cast<double>(timeout_sec) : 0.0;
+  }
+  return result;
+#endif
+}
+
+inline std::string StatusName(SortBenchmarkResult::Status status) {
+  switch (status) {
+    case SortBenchmarkResult::Status::kSorted:
+      return "ok";
+    case SortBenchmarkResult::Status::kWrong:
+      return "WRONG";
+    case SortBenchmarkResult::Status::kRejected:
+      return "REJECTED";
+    case SortBenchmarkResult::Status::kCrashed:
+      return "CRASHED";
+    case SortBenchmarkResult::Status::kTimeout:
+      return "TIMEOUT";
+  }
+  return "unknown";
+}
+
+// Runs every case against every comparable distribution and size, printing one line per run:
+//   <suite>: task=<name> dist=<distribution> n=<size> time=<seconds> <ok|WRONG|REJECTED|CRASHED|TIMEOUT>
+// Once a case needs more than slow_sec on a distribution, its larger sizes for that distribution are
+// skipped. suite has to be the name of the calling gtest suite, whose binary runs each case in a
+// process of its own. Returns a description of every run that did not produce a sorted output.
+inline std::vector<std::string> RunSortBenchmark(const std::string &suite, const std::vector<SortBenchmarkCase> &cases,
+                                                 double slow_sec = 2.0, unsigned timeout_sec = 60) {
+#ifdef __linux__
+  const char *request = std::getenv(kSortBenchmarkChildVar);  // NOLINT(concurrency-mt-unsafe)
+  if (request != nullptr) {
+    RunSortBenchmarkChild(request, cases);
+  }
+#endif
+  std::vector<std::string> problems;
+  const std::vector<std::size_t> sizes = SortBenchmarkSizes();
+  for (const auto &sort_case : cases) {
+    for (auto distribution : util::kComparableDistributions) {
+      const std::string dist_name = util::DistributionName(distribution);
+      for (std::size_t size : sizes) {
+        const SortBenchmarkResult result = RunSortBenchmarkIsolated(suite, sort_case, distribution, size, timeout_sec);
+        const std::string status = StatusName(result.status);
+        std::cout << suite << ": task=" << sort_case.name << " dist=" << dist_name << " n=" << size
+                  << " time=" << result.time_sec << ' ' << status << '\n';
+        if (result.status != SortBenchmarkResult::Status::kSorted) {
+          problems.push_back(sort_case.name + ": " + status + " on " + dist_name + ", n=" + std::to_string(size));
+        }
+        if (result.status != SortBenchmarkResult::Status::kSorted || result.time_sec > slow_sec) {
+          break;
+        }
+      }
+    }
+  }
+  return problems;
+}
+
+// The problems that RunSortBenchmark found in the cases not listed in expected_failures, i.e. the
+// ones a benchmark driver fails on
+inline std::vector<std::string> UnexpectedSortProblems(const std::vector<std::string> &problems,
+                                                       const std::set<std::string> &expected_failures) {
+  std::vector<std::string> unexpected;
+  for (const auto &problem : problems) {
+    if (!expected_failures.contains(problem.substr(0, problem.find(':')))) {
+      unexpected.push_back(problem);
+    }
+  }
+  return unexpected;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sort/include/quick_sort.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+std::vector<int> RandomInts(std::size_t size, int min_value, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dis(min_value, max_value);
+  std::vector<int> vec(size);
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+template <typename ParallelFor>
+void ExpectSorts(std::vector<int> data, const ParallelFor &parallel_for) {
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+  ppc::sort::ParallelHoareSort(data.data(), data.size(), std::less<>(), parallel_for);
+  EXPECT_EQ(data, expected);
+}
+
+}  // namespace
+
+TEST(quick_sort, sorts_small_and_empty) {
+  ExpectSorts({}, ReverseFor{});
+  ExpectSorts({1}, ReverseFor{});
+  ExpectSorts({1, 5, -7, 3, 7, -3, 8, 4, -1, 6, 0, -7}, ReverseFor{});
+}
+
+// Large enough that the blocked partition and the forks of the halves are exercised
+TEST(quick_sort, sorts_large) {
+  ExpectSorts(RandomInts((3 * ppc::sort::kParallelPartitionSize) + 17, -1000000, 1000000, 1), ReverseFor{});
+  ExpectSorts(RandomInts((2 * ppc::sort::kParallelPartitionSize) + 5, 0, 3, 2), ReverseFor{});
+}
+
+TEST(quick_sort, sorts_sorted_reversed_and_equal) {
+  std::vector<int> data(ppc::sort::kParallelPartitionSize + 3);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int>(i);
+  }
+  ExpectSorts(data, ReverseFor{});
+  std::ranges::reverse(data);
+  ExpectSorts(data, ReverseFor{});
+  ExpectSorts(std::vector<int>(data.size(), 7), ReverseFor{});
+}
+
+TEST(quick_sort, follows_the_comparator) {
+  std::vector<int> data = RandomInts(10000, -50, 50, 3);
+  std::vector<int> expected = data;
+  std::ranges::sort(expected, std::greater<>());
+  ppc::sort::ParallelHoareSort(data.data(), data.size(), std::greater<>());
+  EXPECT_EQ(data, expected);
+}
+
+// A NaN pivot is unordered against every element and used to stop the partitions, leaving the rest unsorted
+TEST(quick_sort, moves_nans_to_the_end) {
+  std::mt19937 gen(4);
+  std::uniform_real_distribution<double> dis(-1.0, 1.0);
+  std::vector<double> data(ppc::sort::kParallelPartitionSize + 1000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = i % 3 == 0 ? std::numeric_limits<double>::quiet_NaN() : dis(gen);
+  }
+  const auto nans = static_cast<std::size_t>(std::ranges::count_if(data, [](double v) { return std::isnan(v); }));
+  ppc::sort::ParallelHoareSort(data.data(), data.size(), std::less<>(), ReverseFor{});
+  const auto numbers = static_cast<std::ptrdiff_t>(data.size() - nans);
+  EXPECT_TRUE(std::is_sorted(data.begin(), data.begin() + numbers));
+  EXPECT_TRUE(std::all_of(data.begin(), data.begin() + numbers, [](double v) { return !std::isnan(v); }));
+  EXPECT_TRUE(std::all_of(data.begin() + numbers, data.end(), [](double v) { return std::isnan(v); }));
+}
+
+#ifdef _OPENMP
+
+TEST(quick_sort, sorts_with_omp_tasks) {
+  ExpectSorts(RandomInts((4 * ppc::sort::kParallelPartitionSize) + 9, -1000000, 1000000, 5),
+              ppc::linalg::OmpTaskFor{});
+}
+
+#endif
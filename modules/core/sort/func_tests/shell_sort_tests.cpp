@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "core/sort/include/shell_sort.hpp"
+
+namespace {
+
+using ppc::sort::GapSequence;
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+std::vector<int> RandomInts(std::size_t size, int min_value, int max_value, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dis(min_value, max_value);
+  std::vector<int> vec(size);
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+void ExpectParallelSorts(std::vector<int> data) {
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+  for (auto sequence : {GapSequence::kCiura, GapSequence::kSedgewick, GapSequence::kTokuda}) {
+    std::vector<int> sorted = data;
+    ppc::sort::ParallelShellSort(sorted.data(), sorted.size(), ppc::sort::MakeGaps(sequence, sorted.size()),
+                                 ReverseFor{});
+    EXPECT_EQ(sorted, expected) << "sequence " << static_cast<int>(sequence);
+  }
+}
+
+}  // namespace
+
+TEST(shell_sort, ciura_gaps) {
+  const std::vector<std::size_t> expected = {1, 4, 10, 23, 57, 132, 301, 701, 1750, 3937, 8858};
+  EXPECT_EQ(ppc::sort::MakeGaps(GapSequence::kCiura, 10000), expected);
+}
+
+TEST(shell_sort, sedgewick_gaps) {
+  const std::vector<std::size_t> expected = {1, 5, 19, 41, 109, 209, 505, 929};
+  EXPECT_EQ(ppc::sort::MakeGaps(GapSequence::kSedgewick, 1000), expected);
+}
+
+TEST(shell_sort, tokuda_gaps) {
+  const std::vector<std::size_t> expected = {1, 4, 9, 20, 46, 103, 233, 525};
+  EXPECT_EQ(ppc::sort::MakeGaps(GapSequence::kTokuda, 1000), expected);
+}
+
+TEST(shell_sort, gaps_of_tiny_array) {
+  const std::vector<std::size_t> expected = {1};
+  for (auto sequence : {GapSequence::kCiura, GapSequence::kSedgewick, GapSequence::kTokuda}) {
+    EXPECT_EQ(ppc::sort::MakeGaps(sequence, 0), expected);
+    EXPECT_EQ(ppc::sort::MakeGaps(sequence, 4), expected);
+  }
+}
+
+TEST(shell_sort, serial_sorts_doubles) {
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> dis(-1.0, 1.0);
+  std::vector<double> data(777);
+  for (auto &elem : data) {
+    elem = dis(gen);
+  }
+  std::vector<double> expected = data;
+  std::ranges::sort(expected);
+  ppc::sort::ShellSort(data.data(), data.size(), ppc::sort::MakeGaps(GapSequence::kTokuda, data.size()));
+  EXPECT_EQ(data, expected);
+}
+
+TEST(shell_sort, parallel_sorts_small) { ExpectParallelSorts({1, 5, -7, 3, 7, -3, 8, 4, -1, 6, 0, -7}); }
+
+// Larger than one block, so the blocked small-gap passes and the seam repair are exercised
+TEST(shell_sort, parallel_sorts_multi_block) {
+  ExpectParallelSorts(RandomInts((3 * ppc::sort::kShellBlock) + 17, -100000, 100000, 1));
+  ExpectParallelSorts(RandomInts((2 * ppc::sort::kShellBlock) + 5, 0, 3, 2));
+}
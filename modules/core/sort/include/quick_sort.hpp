@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+
+namespace ppc::sort {
+
+using ppc::linalg::SerialFor;
+
+// Ranges this short are finished by insertion sort
+inline constexpr std::size_t kQuickSortCutoff = 32;
+// Ranges at least this long sort their two halves as separate units of parallel work
+inline constexpr std::size_t kQuickSortForkSize = std::size_t{1} << 12;
+// Ranges at least this long are partitioned block by block in parallel
+inline constexpr std::size_t kParallelPartitionSize = std::size_t{1} << 16;
+
+namespace detail {
+
+// Positions [begin, end) that hold elements belonging to the other side of a split
+struct Interval {
+  std::size_t begin;
+  std::size_t end;
+};
+
+// Walks the k-th, (k+1)-th, ... position of a list of intervals
+class IntervalCursor {
+ public:
+  IntervalCursor(const std::vector<Interval> &intervals, std::size_t k) : intervals_(intervals) {
+    while (k >= intervals_[index_].end - intervals_[index_].begin) {
+      k -= intervals_[index_].end - intervals_[index_].begin;
+      ++index_;
+    }
+    pos_ = intervals_[index_].begin + k;
+  }
+
+  [[nodiscard]] std::size_t Pos() const { return pos_; }
+
+  void Next() {
+    if (++pos_ == intervals_[index_].end && index_ + 1 < intervals_.size()) {
+      pos_ = intervals_[++index_].begin;
+    }
+  }
+
+ private:
+  const std::vector<Interval> &intervals_;
+  std::size_t index_ = 0;
+  std::size_t pos_ = 0;
+};
+
+template <typename T, typename Comparator>
+void InsertionSort(T *a, std::size_t n, Comparator cmp) {
+  for (std::size_t i = 1; i < n; ++i) {
+    T v = std::move(a[i]);
+    std::size_t j = i;
+    for (; j > 0 && cmp(v, a[j - 1]); --j) {
+      a[j] = std::move(a[j - 1]);
+    }
+    a[j] = std::move(v);
+  }
+}
+
+template <typename T, typename Comparator>
+T Median3(const T &a, const T &b, const T &c, Comparator cmp) {
+  if (cmp(a, b)) {
+    return cmp(b, c) ? b : (cmp(a, c) ? c : a);
+  }
+  return cmp(a, c) ? a : (cmp(b, c) ? c : b);
+}
+
+// Tukey's ninther: median of the medians of three evenly spaced triples
+template <typename T, typename Comparator>
+T ChoosePivot(const T *a, std::size_t n, Comparator cmp) {
+  if (n < 128) {
+    return Median3(a[0], a[n / 2], a[n - 1], cmp);
+  }
+  const std::size_t s = n / 8;
+  const std::size_t m = n / 2;
+  return Median3(Median3(a[0], a[s], a[2 * s], cmp), Median3(a[m - s], a[m], a[m + s], cmp),
+                 Median3(a[n - 1 - (2 * s)], a[n - 1 - s], a[n - 1], cmp), cmp);
+}
+
+// Hoare partition of [first, last): elements satisfying pred go first, returns the split point
+template <typename T, typename Pred>
+std::size_t HoarePartition(T *a, std::size_t first, std::size_t last, Pred pred) {
+  while (true) {
+    while (first < last && pred(a[first])) {
+      ++first;
+    }
+    while (first < last && !pred(a[last - 1])) {
+      --last;
+    }
+    if (first >= last) {
+      return first;
+    }
+    std::swap(a[first++], a[--last]);
+  }
+}
+
+// Block-based in-place partition: every block is partitioned on its own, then the elements that
+// ended up on the wrong side of the global split point are exchanged pairwise
+template <typename T, typename Pred, typename ParallelFor>
+std::size_t ParallelPartition(T *a, std::size_t n, Pred pred, const ParallelFor &parallel_for) {
+  const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  const std::size_t blocks = std::clamp<std::size_t>(n / kQuickSortForkSize, 1, threads);
+  std::vector<std::size_t> split(blocks);
+  parallel_for(blocks,
+               [&](std::size_t b) { split[b] = HoarePartition(a, n * b / blocks, n * (b + 1) / blocks, pred); });
+
+  std::size_t mid = 0;
+  for (std::size_t b = 0; b < blocks; ++b) {
+    mid += split[b] - (n * b / blocks);
+  }
+
+  std::vector<Interval> wrong_left;
+  std::vector<Interval> wrong_right;
+  std::size_t misplaced = 0;
+  for (std::size_t b = 0; b < blocks; ++b) {
+    const std::size_t begin = n * b / blocks;
+    const std::size_t end = n * (b + 1) / blocks;
+    if (split[b] < std::min(end, mid)) {
+      wrong_left.push_back({split[b], std::min(end, mid)});
+      misplaced += std::min(end, mid) - split[b];
+    }
+    if (std::max(begin, mid) < split[b]) {
+      wrong_right.push_back({std::max(begin, mid), split[b]});
+    }
+  }
+  if (misplaced == 0) {
+    return mid;
+  }
+
+  parallel_for(blocks, [&](std::size_t b) {
+    const std::size_t first = misplaced * b / blocks;
+    const std::size_t last = misplaced * (b + 1) / blocks;
+    if (first == last) {
+      return;
+    }
+    IntervalCursor left(wrong_left, first);
+    IntervalCursor right(wrong_right, first);
+    for (std::size_t k = first; k < last; ++k) {
+      std::swap(a[left.Pos()], a[right.Pos()]);
+      left.Next();
+      right.Next();
+    }
+  });
+  return mid;
+}
+
+template <typename T, typename Pred, typename ParallelFor>
+std::size_t Partition(T *a, std::size_t n, Pred pred, const ParallelFor &parallel_for) {
+  return n >= kParallelPartitionSize ? ParallelPartition(a, n, pred, parallel_for) : HoarePartition(a, 0, n, pred);
+}
+
+// Introsort: large halves are sorted as separate units of work, heapsort takes over once the depth budget is spent
+template <typename T, typename Comparator, typename ParallelFor>
+void QuickSort(T *a, std::size_t n, int depth, Comparator cmp, const ParallelFor &parallel_for) {
+  while (n > kQuickSortCutoff) {
+    if (depth-- == 0) {
+      std::make_heap(a, a + n, cmp);
+      std::sort_heap(a, a + n, cmp);
+      return;
+    }
+
+    const T pivot = ChoosePivot(a, n, cmp);
+    std::size_t mid = Partition(a, n, [&pivot, cmp](const T &v) { return cmp(v, pivot); }, parallel_for);
+    if (mid == 0) {
+      // Pivot is the minimum: the elements equivalent to it are already in place
+      mid = Partition(a, n, [&pivot, cmp](const T &v) { return !cmp(pivot, v); }, parallel_for);
+      a += mid;
+      n -= mid;
+      continue;
+    }
+
+    T *right = a + mid;
+    const std::size_t right_n = n - mid;
+    if (n >= kQuickSortForkSize) {
+      parallel_for(2, [&](std::size_t half) {
+        if (half == 0) {
+          QuickSort(a, mid, depth, cmp, parallel_for);
+        } else {
+          QuickSort(right, right_n, depth, cmp, parallel_for);
+        }
+      });
+      return;
+    }
+    if (mid < right_n) {
+      QuickSort(a, mid, depth, cmp, parallel_for);
+      a = right;
+      n = right_n;
+    } else {
+      QuickSort(right, right_n, depth, cmp, parallel_for);
+      n = mid;
+    }
+  }
+  InsertionSort(a, n, cmp);
+}
+
+}  // namespace detail
+
+// In-place parallel introsort of [data, data + size). cmp has to be a strict weak ordering of the
+// values; NaN is not ordered against anything, so floating-point NaNs are moved to the end first and
+// the rest is sorted. parallel_for has to nest, as OmpTaskFor and TbbFor do, since the halves of a
+// range fork again from inside its body.
+template <typename T, typename Comparator = std::less<>, typename ParallelFor = SerialFor>
+void ParallelHoareSort(T *data, std::size_t size, Comparator cmp = {}, const ParallelFor &parallel_for = {}) {
+  if constexpr (std::is_floating_point_v<T>) {
+    size = detail::Partition(data, size, [](T v) { return !std::isnan(v); }, parallel_for);
+  }
+  detail::QuickSort(data, size, 2 * static_cast<int>(std::bit_width(size)), cmp, parallel_for);
+}
+
+}  // namespace ppc::sort
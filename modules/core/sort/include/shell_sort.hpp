@@ -0,0 +1,139 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+
+namespace ppc::sort {
+
+using ppc::linalg::SerialFor;
+
+enum class GapSequence : std::uint8_t { kCiura, kSedgewick, kTokuda };
+
+// Gaps of the sequence that are smaller than size, in increasing order; always starts with 1
+inline std::vector<std::size_t> MakeGaps(GapSequence sequence, std::size_t size) {
+  std::vector<std::size_t> gaps{1};
+  auto push = [&gaps, size](std::size_t gap) {
+    if (gap >= size) {
+      return false;
+    }
+    gaps.push_back(gap);
+    return true;
+  };
+
+  switch (sequence) {
+    case GapSequence::kCiura: {
+      // Empirically best known prefix, extended geometrically by 2.25
+      constexpr std::array<std::size_t, 8> kCiura = {4, 10, 23, 57, 132, 301, 701, 1750};
+      for (std::size_t gap : kCiura) {
+        if (!push(gap)) {
+          return gaps;
+        }
+      }
+      for (std::size_t gap = gaps.back() * 9 / 4; push(gap);) {
+        gap = gap * 9 / 4;
+      }
+      break;
+    }
+    case GapSequence::kSedgewick: {
+      // 9 * 4^k - 9 * 2^k + 1 and 4^k - 3 * 2^k + 1, interleaved: 1, 5, 19, 41, 109, 209, ...
+      for (std::size_t k = 1;; ++k) {
+        const std::size_t p = std::size_t{1} << k;
+        const std::size_t gap = (k % 2 != 0) ? (8 * p) - (6 * (std::size_t{1} << ((k + 1) / 2))) + 1
+                                             : (9 * p) - (9 * (std::size_t{1} << (k / 2))) + 1;
+        if (!push(gap)) {
+          break;
+        }
+      }
+      break;
+    }
+    case GapSequence::kTokuda: {
+      // ceil((9 * (9 / 4)^(k - 1) - 4) / 5): 1, 4, 9, 20, 46, 103, ...
+      for (double power = 9.0 * 2.25;; power *= 2.25) {
+        if (!push(static_cast<std::size_t>(std::ceil((power - 4.0) / 5.0)))) {
+          break;
+        }
+      }
+      break;
+    }
+  }
+  return gaps;
+}
+
+// Passes with a gap at least this large are split into units of parallel work by chains
+inline constexpr std::size_t kChainParallelGap = 64;
+// Adjacent chains sorted together, so that one row of a group is a contiguous run of memory
+inline constexpr std::size_t kChainGroup = 16;
+// Smaller gaps are applied block by block; 32K ints fit into a typical L2 cache
+inline constexpr std::size_t kShellBlock = std::size_t{1} << 15;
+
+// One gap pass over [data, data + size) that sweeps the array front to back
+template <typename T>
+void GapInsertionSort(T *data, std::size_t size, std::size_t gap) {
+  for (std::size_t j = gap; j < size; ++j) {
+    T value = std::move(data[j]);
+    std::size_t i = j;
+    for (; i >= gap && value < data[i - gap]; i -= gap) {
+      data[i] = std::move(data[i - gap]);
+    }
+    data[i] = std::move(value);
+  }
+}
+
+// Sorts chains [first, last) of the given gap, advancing all of them one row at a time
+template <typename T>
+void ChainGroupSort(T *data, std::size_t size, std::size_t gap, std::size_t first, std::size_t last) {
+  for (std::size_t row = gap; row + first < size; row += gap) {
+    const std::size_t end = std::min(row + last, size);
+    for (std::size_t j = row + first; j < end; ++j) {
+      T value = std::move(data[j]);
+      std::size_t i = j;
+      for (; i >= gap && value < data[i - gap]; i -= gap) {
+        data[i] = std::move(data[i - gap]);
+      }
+      data[i] = std::move(value);
+    }
+  }
+}
+
+// Shell sort of [data, data + size) with gaps as MakeGaps returns them
+template <typename T>
+void ShellSort(T *data, std::size_t size, const std::vector<std::size_t> &gaps) {
+  for (auto gap = gaps.rbegin(); gap != gaps.rend(); ++gap) {
+    GapInsertionSort(data, size, *gap);
+  }
+}
+
+// Large gaps: the chains are independent, so groups of them are units of parallel work.
+// Small gaps: every cache-sized block is gap-sorted on its own, and a final exact
+// insertion pass repairs the block seams.
+template <typename T, typename ParallelFor = SerialFor>
+void ParallelShellSort(T *data, std::size_t size, const std::vector<std::size_t> &gaps,
+                       const ParallelFor &parallel_for = {}) {
+  const std::size_t blocks = (size + kShellBlock - 1) / kShellBlock;
+  for (auto it = gaps.rbegin(); it != gaps.rend(); ++it) {
+    const std::size_t gap = *it;
+    if (gap >= kChainParallelGap) {
+      parallel_for((gap + kChainGroup - 1) / kChainGroup, [&](std::size_t g) {
+        const std::size_t first = g * kChainGroup;
+        ChainGroupSort(data, size, gap, first, std::min(first + kChainGroup, gap));
+      });
+    } else {
+      parallel_for(blocks, [&](std::size_t b) {
+        const std::size_t first = b * kShellBlock;
+        GapInsertionSort(data + first, std::min(kShellBlock, size - first), gap);
+      });
+    }
+  }
+  if (blocks > 1) {
+    GapInsertionSort(data, size, 1);
+  }
+}
+
+}  // namespace ppc::sort
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/bsr_spgemm.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+// CRS matrix made of cluster x cluster squares, about density of them present, each full of small
+// nonzero integers so that every sum is exact, plus single entries scattered at about noise
+template <typename T, typename Index>
+ppc::sparse::CrsMatrix<T, Index> ClusteredCrs(std::size_t rows, std::size_t cols, std::size_t cluster, double density,
+                                              double noise, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution square(density);
+  std::bernoulli_distribution single(noise);
+  std::uniform_int_distribution<int> value(1, 5);
+  std::vector<T> dense(rows * cols);
+  for (std::size_t bi = 0; bi < rows; bi += cluster) {
+    for (std::size_t bj = 0; bj < cols; bj += cluster) {
+      if (!square(gen)) {
+        continue;
+      }
+      for (std::size_t i = bi; i < std::min(rows, bi + cluster); ++i) {
+        for (std::size_t j = bj; j < std::min(cols, bj + cluster); ++j) {
+          dense[(i * cols) + j] = static_cast<T>(value(gen));
+        }
+      }
+    }
+  }
+  for (auto &x : dense) {
+    if (single(gen)) {
+      x = static_cast<T>(value(gen));
+    }
+  }
+  ppc::sparse::CooMatrix<T, Index> coo;
+  coo.rows = rows;
+  coo.cols = cols;
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < cols; ++j) {
+      if (dense[(i * cols) + j] != T{}) {
+        coo.row.push_back(static_cast<Index>(i));
+        coo.col.push_back(static_cast<Index>(j));
+        coo.values.push_back(dense[(i * cols) + j]);
+      }
+    }
+  }
+  return ppc::sparse::CooToCrs(coo);
+}
+
+// The CRS product of the CCS routine, the CRS arrays of A * B being the CCS arrays of B^T * A^T
+template <typename T, typename Index>
+ppc::sparse::CrsMatrix<T, Index> CrsProduct(const ppc::sparse::CrsMatrix<T, Index> &a,
+                                            const ppc::sparse::CrsMatrix<T, Index> &b) {
+  ppc::sparse::CcsMatrix<T, Index> c_t;
+  ppc::sparse::SpGemm(ppc::sparse::TransposedView(b.View()), ppc::sparse::TransposedView(a.View()), c_t);
+  ppc::sparse::Prune(c_t, [](const T &value) { return value != T{}; });
+  return {.rows = a.rows,
+          .cols = b.cols,
+          .row_ptr = c_t.col_ptr,
+          .col_index = c_t.row_index,
+          .values = c_t.values};
+}
+
+template <typename T, typename Index>
+void ExpectBsrProductMatches(std::size_t block, std::size_t m, std::size_t k, std::size_t n) {
+  const auto a = ClusteredCrs<T, Index>(m, k, 4, 0.1, 0.002, 1);
+  const auto b = ClusteredCrs<T, Index>(k, n, 4, 0.1, 0.002, 2);
+  const auto expected = CrsProduct(a, b);
+
+  ppc::sparse::BsrMatrix<T, Index> c;
+  ppc::sparse::SpGemm(ppc::sparse::CrsToBsr(a.View(), block).View(), ppc::sparse::CrsToBsr(b.View(), block).View(), c,
+                      ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(c, true)) << block;
+  EXPECT_EQ(c.block, block);
+  const auto product = ppc::sparse::BsrToCrs(c.View());
+  EXPECT_EQ(product.rows, m);
+  EXPECT_EQ(product.cols, n);
+  EXPECT_EQ(product.row_ptr, expected.row_ptr) << block;
+  EXPECT_EQ(product.col_index, expected.col_index) << block;
+  EXPECT_EQ(product.values, expected.values) << block;
+}
+
+}  // namespace
+
+// Every block size with a kernel, on sizes that leave padded tiles on the edges
+TEST(bsr_spgemm, multiplies_with_every_kernel) {
+  for (std::size_t block = 1; block <= ppc::sparse::kBsrMaxBlock; ++block) {
+    ExpectBsrProductMatches<double, int>(block, 203, 150, 97);
+  }
+}
+
+TEST(bsr_spgemm, multiplies_float_with_64_bit_indices) {
+  ExpectBsrProductMatches<float, std::int64_t>(4, 120, 90, 64);
+  ExpectBsrProductMatches<float, std::int64_t>(3, 120, 90, 64);
+}
+
+TEST(bsr_spgemm, multiplies_tiles_beyond_the_kernels) { ExpectBsrProductMatches<double, int>(12, 100, 70, 50); }
+
+TEST(bsr_spgemm, multiplies_empty_matrix) {
+  ppc::sparse::CrsMatrix<double, int> a;
+  a.rows = 5;
+  a.cols = 6;
+  a.row_ptr.assign(6, 0);
+  ppc::sparse::BsrMatrix<double, int> c;
+  ppc::sparse::SpGemm(ppc::sparse::CrsToBsr(a.View(), 4).View(), ppc::sparse::CrsToBsr(a.View(), 4).View(), c);
+  EXPECT_EQ(c.block_row_ptr, (std::vector<int>{0, 0, 0}));
+  EXPECT_TRUE(c.values.empty());
+}
+
+TEST(bsr_spgemm, chooses_block_of_the_clusters) {
+  const auto clustered = ClusteredCrs<double, int>(400, 400, 4, 0.05, 0.0, 3);
+  EXPECT_EQ(ppc::sparse::BsrFill(clustered.View(), 4), 1.0);
+  EXPECT_EQ(ppc::sparse::ChooseBsrBlock(clustered.View(), ppc::sparse::kBsrMaxFill, ReverseFor{}), 4);
+  // The tiles of the transpose are the transposed tiles
+  const auto ccs = ppc::sparse::CrsToCcs(clustered.View());
+  EXPECT_EQ(ppc::sparse::ChooseBsrBlock(ppc::sparse::TransposedView(ccs.View())), 4);
+
+  const auto scattered = ClusteredCrs<double, int>(400, 400, 4, 0.0, 0.01, 4);
+  EXPECT_GT(ppc::sparse::BsrFill(scattered.View(), 2), 3.0);
+  EXPECT_EQ(ppc::sparse::ChooseBsrBlock(scattered.View()), 1);
+}
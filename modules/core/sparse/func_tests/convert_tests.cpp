@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+// Row-major dense matrix with about density of its entries set to small nonzero integers
+template <typename T>
+std::vector<T> RandomDense(std::size_t rows, std::size_t cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution coin(density);
+  std::uniform_int_distribution<int> value(1, 9);
+  std::vector<T> dense(rows * cols);
+  for (auto &x : dense) {
+    if (coin(gen)) {
+      x = static_cast<T>(value(gen));
+    }
+  }
+  return dense;
+}
+
+template <typename T, typename Index>
+ppc::sparse::CrsMatrix<T, Index> DenseToCrs(const std::vector<T> &dense, std::size_t rows, std::size_t cols) {
+  ppc::sparse::CrsMatrix<T, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.row_ptr.push_back(0);
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < cols; ++j) {
+      if (dense[(i * cols) + j] != T{}) {
+        m.col_index.push_back(static_cast<Index>(j));
+        m.values.push_back(dense[(i * cols) + j]);
+      }
+    }
+    m.row_ptr.push_back(static_cast<Index>(m.values.size()));
+  }
+  return m;
+}
+
+template <typename T, typename Index>
+std::vector<T> CcsToDense(const ppc::sparse::CcsMatrix<T, Index> &m) {
+  std::vector<T> dense(m.rows * m.cols);
+  for (std::size_t j = 0; j < m.cols; ++j) {
+    for (auto p = static_cast<std::size_t>(m.col_ptr[j]); p < static_cast<std::size_t>(m.col_ptr[j + 1]); ++p) {
+      dense[(static_cast<std::size_t>(m.row_index[p]) * m.cols) + j] += m.values[p];
+    }
+  }
+  return dense;
+}
+
+template <typename T, typename Index>
+void ExpectSameCrs(const ppc::sparse::CrsMatrix<T, Index> &a, const ppc::sparse::CrsMatrix<T, Index> &b) {
+  EXPECT_EQ(a.rows, b.rows);
+  EXPECT_EQ(a.cols, b.cols);
+  EXPECT_EQ(a.row_ptr, b.row_ptr);
+  EXPECT_EQ(a.col_index, b.col_index);
+  EXPECT_EQ(a.values, b.values);
+}
+
+template <typename T, typename Index>
+void ExpectTransposeRoundTrips(std::size_t rows, std::size_t cols, double density) {
+  const auto dense = RandomDense<T>(rows, cols, density, 1);
+  const auto crs = DenseToCrs<T, Index>(dense, rows, cols);
+  const auto ccs = ppc::sparse::CrsToCcs(crs.View(), ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(ccs, true));
+  EXPECT_EQ(CcsToDense(ccs), dense);
+  ExpectSameCrs(ppc::sparse::CcsToCrs(ccs.View(), ReverseFor{}), crs);
+}
+
+}  // namespace
+
+TEST(sparse_convert, crs_to_ccs_round_trips) { ExpectTransposeRoundTrips<double, int>(100, 70, 0.1); }
+
+// Enough entries for the counting sort to split them into several units with their own histograms
+TEST(sparse_convert, crs_to_ccs_round_trips_in_several_units) {
+  ExpectTransposeRoundTrips<double, int>(600, 500, 0.3);
+}
+
+TEST(sparse_convert, crs_to_ccs_round_trips_with_64_bit_indices) {
+  ExpectTransposeRoundTrips<float, std::int64_t>(50, 90, 0.2);
+}
+
+TEST(sparse_convert, crs_to_ccs_round_trips_complex) {
+  ExpectTransposeRoundTrips<std::complex<double>, int>(40, 30, 0.2);
+}
+
+TEST(sparse_convert, transposes_crs_with_unsigned_indices) {
+  constexpr std::size_t kRows = 300;
+  constexpr std::size_t kCols = 90;
+  const auto dense = RandomDense<double>(kRows, kCols, 0.3, 4);
+  std::vector<double> dense_t(kCols * kRows);
+  for (std::size_t i = 0; i < kRows; ++i) {
+    for (std::size_t j = 0; j < kCols; ++j) {
+      dense_t[(j * kRows) + i] = dense[(i * kCols) + j];
+    }
+  }
+  const auto crs = DenseToCrs<double, unsigned int>(dense, kRows, kCols);
+  const auto expected = DenseToCrs<double, unsigned int>(dense_t, kCols, kRows);
+  ExpectSameCrs(ppc::sparse::Transpose(crs.View(), ReverseFor{}), expected);
+}
+
+TEST(sparse_convert, converts_empty_matrix) {
+  ppc::sparse::CrsMatrix<double, int> empty;
+  empty.rows = 3;
+  empty.cols = 4;
+  empty.row_ptr = {0, 0, 0, 0};
+  const auto ccs = ppc::sparse::CrsToCcs(empty.View());
+  EXPECT_EQ(ccs.col_ptr, (std::vector<int>{0, 0, 0, 0, 0}));
+  EXPECT_TRUE(ppc::sparse::IsValid(ccs, true));
+}
+
+TEST(sparse_convert, coo_to_crs_sorts_and_sums_repeats) {
+  ppc::sparse::CooMatrix<double, int> coo;
+  coo.rows = 3;
+  coo.cols = 4;
+  coo.row = {2, 0, 2, 1, 0, 2};
+  coo.col = {3, 1, 0, 2, 1, 3};
+  coo.values = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  ASSERT_TRUE(ppc::sparse::IsValid(coo));
+
+  const auto crs = ppc::sparse::CooToCrs(coo, ReverseFor{});
+  EXPECT_TRUE(ppc::sparse::IsValid(crs, true));
+  EXPECT_EQ(crs.row_ptr, (std::vector<int>{0, 1, 2, 4}));
+  EXPECT_EQ(crs.col_index, (std::vector<int>{1, 2, 0, 3}));
+  EXPECT_EQ(crs.values, (std::vector<double>{7.0, 4.0, 3.0, 7.0}));
+
+  const auto ccs = ppc::sparse::CooToCcs(coo, ReverseFor{});
+  EXPECT_TRUE(ppc::sparse::IsValid(ccs, true));
+  EXPECT_EQ(ccs.col_ptr, (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(ccs.row_index, (std::vector<int>{2, 0, 1, 2}));
+  EXPECT_EQ(ccs.values, (std::vector<double>{3.0, 7.0, 4.0, 7.0}));
+}
+
+TEST(sparse_convert, large_coo_to_crs_matches_dense) {
+  constexpr std::size_t kRows = 300;
+  constexpr std::size_t kCols = 200;
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<int> row(0, kRows - 1);
+  std::uniform_int_distribution<int> col(0, kCols - 1);
+  ppc::sparse::CooMatrix<double, int> coo;
+  coo.rows = kRows;
+  coo.cols = kCols;
+  std::vector<double> dense(kRows * kCols);
+  for (int p = 0; p < 40000; ++p) {
+    coo.row.push_back(row(gen));
+    coo.col.push_back(col(gen));
+    coo.values.push_back(1.0);
+    dense[(static_cast<std::size_t>(coo.row.back()) * kCols) + static_cast<std::size_t>(coo.col.back())] += 1.0;
+  }
+  ExpectSameCrs(ppc::sparse::CooToCrs(coo, ReverseFor{}), DenseToCrs<double, int>(dense, kRows, kCols));
+}
+
+TEST(sparse_convert, crs_to_bsr_round_trips) {
+  // 4 does not divide the sizes, so the tiles on the edges are padded
+  constexpr std::size_t kRows = 30;
+  constexpr std::size_t kCols = 21;
+  const auto dense = RandomDense<double>(kRows, kCols, 0.05, 3);
+  const auto crs = DenseToCrs<double, int>(dense, kRows, kCols);
+  const auto bsr = ppc::sparse::CrsToBsr(crs.View(), 4, ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(bsr, true));
+  for (std::size_t br = 0; br < bsr.View().BlockRows(); ++br) {
+    for (std::size_t p = bsr.View().Begin(br); p < bsr.View().End(br); ++p) {
+      const auto bc = static_cast<std::size_t>(bsr.block_col_index[p]);
+      for (std::size_t i = 0; i < 4; ++i) {
+        for (std::size_t j = 0; j < 4; ++j) {
+          const std::size_t r = (br * 4) + i;
+          const std::size_t c = (bc * 4) + j;
+          const double expected = r < kRows && c < kCols ? dense[(r * kCols) + c] : 0.0;
+          ASSERT_EQ(bsr.View().Tile(p)[(i * 4) + j], expected) << r << ", " << c;
+        }
+      }
+    }
+  }
+  ExpectSameCrs(ppc::sparse::BsrToCrs(bsr.View(), ReverseFor{}), crs);
+}
+
+TEST(sparse_matrix, transposed_view_shares_the_arrays) {
+  const auto crs = DenseToCrs<double, int>({1.0, 0.0, 2.0, 0.0, 3.0, 0.0}, 2, 3);
+  const auto view = ppc::sparse::TransposedView(crs.View());
+  EXPECT_EQ(view.rows, std::size_t{3});
+  EXPECT_EQ(view.cols, std::size_t{2});
+  EXPECT_EQ(view.col_ptr, crs.row_ptr.data());
+  EXPECT_EQ(view.values, crs.values.data());
+  EXPECT_EQ(ppc::sparse::TransposedView(view).row_ptr, crs.row_ptr.data());
+}
+
+TEST(sparse_matrix, rejects_malformed_arrays) {
+  auto crs = DenseToCrs<double, int>({1.0, 0.0, 2.0, 0.0, 3.0, 0.0}, 2, 3);
+  ASSERT_TRUE(ppc::sparse::IsValid(crs, true));
+
+  auto swapped = crs;
+  std::swap(swapped.col_index[0], swapped.col_index[1]);
+  EXPECT_TRUE(ppc::sparse::IsValid(swapped));
+  EXPECT_FALSE(ppc::sparse::IsValid(swapped, true));
+
+  auto out_of_range = crs;
+  out_of_range.col_index[2] = 3;
+  EXPECT_FALSE(ppc::sparse::IsValid(out_of_range));
+
+  auto decreasing = crs;
+  decreasing.row_ptr = {0, 3, 2};
+  EXPECT_FALSE(ppc::sparse::IsValid(decreasing));
+
+  auto short_values = crs;
+  short_values.values.pop_back();
+  EXPECT_FALSE(ppc::sparse::IsValid(short_values));
+
+  // Pointers past the index array are caught before any index is read
+  ppc::sparse::CcsMatrix<double, int> short_index;
+  short_index.rows = 2;
+  short_index.cols = 1;
+  short_index.col_ptr = {0, 1000};
+  short_index.row_index = {0};
+  short_index.values = {1.0};
+  EXPECT_FALSE(ppc::sparse::IsValid(short_index));
+  auto short_col_index = crs;
+  short_col_index.col_index.pop_back();
+  short_col_index.values.pop_back();
+  EXPECT_FALSE(ppc::sparse::IsValid(short_col_index));
+  auto overshooting = crs;
+  overshooting.row_ptr = {0, 1000, 3};
+  EXPECT_FALSE(ppc::sparse::IsValid(overshooting));
+
+  ppc::sparse::CooMatrix<double, int> coo;
+  coo.rows = 2;
+  coo.cols = 2;
+  coo.row = {0, -1};
+  coo.col = {1, 1};
+  coo.values = {1.0, 2.0};
+  EXPECT_FALSE(ppc::sparse::IsValid(coo));
+}
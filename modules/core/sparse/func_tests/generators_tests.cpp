@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/generators.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+template <typename T, typename Index>
+void ExpectSameMatrix(const ppc::sparse::CcsMatrix<T, Index> &a, const ppc::sparse::CcsMatrix<T, Index> &b) {
+  EXPECT_EQ(a.rows, b.rows);
+  EXPECT_EQ(a.cols, b.cols);
+  EXPECT_EQ(a.col_ptr, b.col_ptr);
+  EXPECT_EQ(a.row_index, b.row_index);
+  EXPECT_EQ(a.values, b.values);
+}
+
+}  // namespace
+
+// The units of work have engines of their own, so the order they run in changes nothing
+TEST(sparse_generators, depend_on_the_seed_only) {
+  const auto er = ppc::sparse::ErdosRenyi(10000, 9000, 0.001, 7);
+  ASSERT_TRUE(ppc::sparse::IsValid(er, true));
+  ExpectSameMatrix(er, ppc::sparse::ErdosRenyi(10000, 9000, 0.001, 7, ReverseFor{}));
+  EXPECT_NE(er.row_index, ppc::sparse::ErdosRenyi(10000, 9000, 0.001, 8).row_index);
+
+  const auto rmat = ppc::sparse::Rmat<float, std::int64_t>(12, 8, 3);
+  ASSERT_TRUE(ppc::sparse::IsValid(rmat, true));
+  ExpectSameMatrix(rmat, ppc::sparse::Rmat<float, std::int64_t>(12, 8, 3, {}, ReverseFor{}));
+}
+
+TEST(sparse_generators, erdos_renyi_has_the_density) {
+  const auto a = ppc::sparse::ErdosRenyi(2000, 3000, 0.01, 1);
+  EXPECT_NEAR(static_cast<double>(a.values.size()), 60000.0, 1500.0);
+  for (const double x : a.values) {
+    ASSERT_GE(x, -1.0);
+    ASSERT_LT(x, 1.0);
+  }
+  EXPECT_TRUE(ppc::sparse::ErdosRenyi(50, 40, 0.0, 1).values.empty());
+  EXPECT_EQ(ppc::sparse::ErdosRenyi(50, 40, 1.0, 1).values.size(), 2000);
+}
+
+TEST(sparse_generators, banded_and_block_diagonal_stay_in_shape) {
+  const auto band = ppc::sparse::Banded(100, 2, 3, 1);
+  ASSERT_TRUE(ppc::sparse::IsValid(band, true));
+  // 6 entries per column, less what the corners cut off: 3 + 2 + 1 above and 2 + 1 below
+  EXPECT_EQ(band.values.size(), (100 * 6) - 6 - 3);
+  for (std::size_t j = 0; j < band.cols; ++j) {
+    for (auto p = static_cast<std::size_t>(band.col_ptr[j]); p < static_cast<std::size_t>(band.col_ptr[j + 1]);
+         ++p) {
+      const auto i = static_cast<std::size_t>(band.row_index[p]);
+      EXPECT_TRUE(i + 3 >= j && i <= j + 2) << i << " " << j;
+    }
+  }
+
+  const auto blocks = ppc::sparse::BlockDiagonal(100, 16, 0.5, 1, ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(blocks, true));
+  for (std::size_t j = 0; j < blocks.cols; ++j) {
+    for (auto p = static_cast<std::size_t>(blocks.col_ptr[j]); p < static_cast<std::size_t>(blocks.col_ptr[j + 1]);
+         ++p) {
+      EXPECT_EQ(static_cast<std::size_t>(blocks.row_index[p]) / 16, j / 16);
+    }
+  }
+  EXPECT_EQ(ppc::sparse::BlockDiagonal(100, 16, 1.0, 1).values.size(), (6 * 16 * 16) + (4 * 4));
+}
+
+// Every row of a Laplacian sums to zero but on the boundary, which loses a neighbour per side it is on
+TEST(sparse_generators, poisson_rows_sum_to_the_boundary) {
+  const auto two = ppc::sparse::Poisson2D(7, 5);
+  const auto three = ppc::sparse::Poisson3D(4, 5, 6, ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(two, true));
+  ASSERT_TRUE(ppc::sparse::IsValid(three, true));
+  EXPECT_EQ(two.rows, 35);
+  EXPECT_EQ(three.rows, 120);
+  auto row_sums = [](const ppc::sparse::CcsMatrix<double, int> &m) {
+    std::vector<double> sums(m.rows);
+    for (std::size_t p = 0; p < m.values.size(); ++p) {
+      sums[m.row_index[p]] += m.values[p];
+    }
+    return sums;
+  };
+  const auto sums_2d = row_sums(two);
+  for (std::size_t y = 0; y < 5; ++y) {
+    for (std::size_t x = 0; x < 7; ++x) {
+      const int sides = (x == 0 ? 1 : 0) + (x == 6 ? 1 : 0) + (y == 0 ? 1 : 0) + (y == 4 ? 1 : 0);
+      EXPECT_EQ(sums_2d[x + (7 * y)], sides) << x << " " << y;
+    }
+  }
+  const auto sums_3d = row_sums(three);
+  EXPECT_EQ(sums_3d[1 + (4 * (2 + (5 * 3)))], 0.0);
+  EXPECT_EQ(sums_3d[0], 3.0);
+}
+
+// A few vertices of an R-MAT graph have most of the edges, unlike a uniform random graph
+TEST(sparse_generators, rmat_is_skewed) {
+  const auto a = ppc::sparse::Rmat(14, 8, 1);
+  ASSERT_EQ(a.rows, 1 << 14);
+  EXPECT_LE(a.values.size(), 8 << 14);
+  EXPECT_GT(a.values.size(), 4 << 14);
+  std::size_t longest = 0;
+  for (std::size_t j = 0; j < a.cols; ++j) {
+    longest = std::max<std::size_t>(longest, a.col_ptr[j + 1] - a.col_ptr[j]);
+  }
+  EXPECT_GT(longest, 50 * a.values.size() / a.cols);
+}
+
+TEST(sparse_generators, benchmark_suite_covers_the_structures) {
+  const auto suite = ppc::sparse::SparseBenchmarkSuite(5000, 8, 1, ReverseFor{});
+  std::set<std::string> names;
+  for (const auto &c : suite) {
+    names.insert(c.name);
+    ASSERT_TRUE(ppc::sparse::IsValid(c.a, true)) << c.name;
+    ASSERT_TRUE(ppc::sparse::IsValid(c.b, true)) << c.name;
+    EXPECT_EQ(c.a.cols, c.b.rows) << c.name;
+    EXPECT_LE(c.a.rows, 5000) << c.name;
+    EXPECT_GT(c.a.rows, 2000) << c.name;
+    EXPECT_GT(ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View(), ReverseFor{}), c.a.rows) << c.name;
+  }
+  EXPECT_EQ(names, (std::set<std::string>{"erdos_renyi", "banded", "rmat", "block_diagonal", "poisson_2d",
+                                          "poisson_3d"}));
+}
+
+TEST(sparse_generators, counts_multiply_adds_and_formats_rates) {
+  // Column j of the 2D Laplacian squared: every entry k of column j meets the entries of column k
+  const auto a = ppc::sparse::Poisson2D(3, 3);
+  std::size_t expected = 0;
+  for (std::size_t j = 0; j < a.cols; ++j) {
+    for (auto p = static_cast<std::size_t>(a.col_ptr[j]); p < static_cast<std::size_t>(a.col_ptr[j + 1]); ++p) {
+      expected += a.col_ptr[a.row_index[p] + 1] - a.col_ptr[a.row_index[p]];
+    }
+  }
+  EXPECT_EQ(ppc::sparse::SpGemmMultiplyAdds(a.View(), a.View()), expected);
+  EXPECT_EQ(ppc::sparse::FormatSparseRate("task", "banded", 1000000000, 2000, 2.0),
+            "task: case=banded time=2 gflops=1 nnz_per_s=1000");
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/masked_spgemm.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+// Column-major dense matrix with about density of its entries set to small nonzero integers, density_of(j)
+// giving the density of column j
+template <typename T, typename Density>
+std::vector<T> RandomDense(std::size_t rows, std::size_t cols, const Density &density_of, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<int> value(1, 9);
+  std::vector<T> dense(rows * cols);
+  for (std::size_t j = 0; j < cols; ++j) {
+    for (std::size_t i = 0; i < rows; ++i) {
+      if (coin(gen) < density_of(j)) {
+        dense[(j * rows) + i] = static_cast<T>(value(gen));
+      }
+    }
+  }
+  return dense;
+}
+
+template <typename T, typename Index>
+ppc::sparse::CcsMatrix<T, Index> ToCcs(const std::vector<T> &dense, std::size_t rows, std::size_t cols) {
+  ppc::sparse::CcsMatrix<T, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.col_ptr.push_back(0);
+  for (std::size_t j = 0; j < cols; ++j) {
+    for (std::size_t i = 0; i < rows; ++i) {
+      if (dense[(j * rows) + i] != T{}) {
+        m.row_index.push_back(static_cast<Index>(i));
+        m.values.push_back(dense[(j * rows) + i]);
+      }
+    }
+    m.col_ptr.push_back(static_cast<Index>(m.values.size()));
+  }
+  return m;
+}
+
+// The masked product against the full one restricted to the mask. The mask has dense columns, which
+// go through Gustavson, and sparse ones, which go through dot products.
+template <typename T, typename Index>
+void ExpectMaskedProductMatches(std::size_t m, std::size_t k, std::size_t n) {
+  const auto a = ToCcs<T, Index>(RandomDense<T>(m, k, [](std::size_t) { return 0.05; }, 1), m, k);
+  const auto b = ToCcs<T, Index>(RandomDense<T>(k, n, [](std::size_t) { return 0.05; }, 2), k, n);
+  const auto dense_mask = RandomDense<T>(m, n, [](std::size_t j) { return j % 7 == 0 ? 0.9 : 0.01; }, 3);
+  const auto mask = ToCcs<T, Index>(dense_mask, m, n);
+  ppc::sparse::CcsMatrix<T, Index> full;
+  ppc::sparse::SpGemm(a.View(), b.View(), full);
+  ppc::sparse::CcsMatrix<T, Index> c;
+  ppc::sparse::MaskedSpGemm(a.View(), b.View(), mask.View(), c, ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(c.View(), true));
+  ASSERT_EQ(c.rows, m);
+  ASSERT_EQ(c.cols, n);
+
+  std::vector<T> expected(m * n);
+  std::vector<bool> present(m * n);
+  for (std::size_t j = 0; j < n; ++j) {
+    for (std::size_t p = full.View().Begin(j); p < full.View().End(j); ++p) {
+      expected[(j * m) + static_cast<std::size_t>(full.row_index[p])] = full.values[p];
+      present[(j * m) + static_cast<std::size_t>(full.row_index[p])] = true;
+    }
+  }
+  std::size_t count = 0;
+  for (std::size_t j = 0; j < n; ++j) {
+    for (std::size_t p = mask.View().Begin(j); p < mask.View().End(j); ++p) {
+      count += present[(j * m) + static_cast<std::size_t>(mask.row_index[p])] ? 1 : 0;
+    }
+    for (std::size_t p = c.View().Begin(j); p < c.View().End(j); ++p) {
+      const auto i = static_cast<std::size_t>(c.row_index[p]);
+      EXPECT_NE(dense_mask[(j * m) + i], T{}) << i << " " << j;
+      EXPECT_TRUE(present[(j * m) + i]) << i << " " << j;
+      EXPECT_EQ(c.values[p], expected[(j * m) + i]) << i << " " << j;
+    }
+  }
+  EXPECT_EQ(c.values.size(), count);
+}
+
+}  // namespace
+
+TEST(masked_spgemm, masks_product_of_random_matrices) { ExpectMaskedProductMatches<double, int>(300, 200, 150); }
+
+TEST(masked_spgemm, masks_product_with_64_bit_indices) {
+  ExpectMaskedProductMatches<float, std::int64_t>(120, 90, 70);
+}
+
+// The triangles of an undirected graph are sum((L * L) .* L) for L the strictly lower part of its adjacency
+TEST(masked_spgemm, counts_triangles) {
+  constexpr std::size_t kVertices = 200;
+  std::mt19937 gen(5);
+  std::bernoulli_distribution edge(0.05);
+  std::vector<std::vector<bool>> adjacent(kVertices, std::vector<bool>(kVertices));
+  std::vector<double> lower(kVertices * kVertices);
+  for (std::size_t j = 0; j < kVertices; ++j) {
+    for (std::size_t i = j + 1; i < kVertices; ++i) {
+      if (edge(gen)) {
+        adjacent[i][j] = adjacent[j][i] = true;
+        lower[(j * kVertices) + i] = 1.0;
+      }
+    }
+  }
+  std::size_t expected = 0;
+  for (std::size_t x = 0; x < kVertices; ++x) {
+    for (std::size_t y = x + 1; y < kVertices; ++y) {
+      for (std::size_t z = y + 1; z < kVertices; ++z) {
+        expected += adjacent[x][y] && adjacent[y][z] && adjacent[x][z] ? 1 : 0;
+      }
+    }
+  }
+  ASSERT_GT(expected, 0);
+
+  const auto l = ToCcs<double, int>(lower, kVertices, kVertices);
+  ppc::sparse::CcsMatrix<double, int> c;
+  ppc::sparse::MaskedSpGemm(l.View(), l.View(), l.View(), c, ReverseFor{});
+  double triangles = 0.0;
+  for (const double x : c.values) {
+    triangles += x;
+  }
+  EXPECT_EQ(triangles, static_cast<double>(expected));
+}
+
+TEST(masked_spgemm, empty_mask_gives_empty_product) {
+  const auto a = ToCcs<double, int>(RandomDense<double>(30, 30, [](std::size_t) { return 0.3; }, 1), 30, 30);
+  const auto mask = ToCcs<double, int>(std::vector<double>(30 * 30), 30, 30);
+  ppc::sparse::CcsMatrix<double, int> c;
+  ppc::sparse::MaskedSpGemm(a.View(), a.View(), mask.View(), c);
+  EXPECT_EQ(c.col_ptr, std::vector<int>(31, 0));
+  EXPECT_TRUE(c.values.empty());
+}
+
+TEST(masked_spgemm, accumulates_scaled_product) {
+  const std::size_t n = 80;
+  const auto dense_a = RandomDense<double>(n, n, [](std::size_t) { return 0.05; }, 1);
+  const auto dense_b = RandomDense<double>(n, n, [](std::size_t) { return 0.05; }, 2);
+  const auto dense_c = RandomDense<double>(n, n, [](std::size_t) { return 0.1; }, 3);
+  const auto a = ToCcs<double, int>(dense_a, n, n);
+  const auto b = ToCcs<double, int>(dense_b, n, n);
+
+  std::vector<double> expected(dense_c);
+  for (auto &x : expected) {
+    x *= -1.0;
+  }
+  for (std::size_t j = 0; j < n; ++j) {
+    for (std::size_t k = 0; k < n; ++k) {
+      for (std::size_t i = 0; i < n; ++i) {
+        expected[(j * n) + i] += 2.0 * dense_a[(k * n) + i] * dense_b[(j * n) + k];
+      }
+    }
+  }
+  auto c = ToCcs<double, int>(dense_c, n, n);
+  ppc::sparse::SpGemmAxpby(2.0, a.View(), b.View(), -1.0, c, ReverseFor{});
+  ppc::sparse::Prune(c, [](double value) { return value != 0.0; });
+  const auto expected_ccs = ToCcs<double, int>(expected, n, n);
+  EXPECT_EQ(c.col_ptr, expected_ccs.col_ptr);
+  EXPECT_EQ(c.row_index, expected_ccs.row_index);
+  EXPECT_EQ(c.values, expected_ccs.values);
+
+  // beta == 0 drops the old entries, even the ones the product does not reach
+  ppc::sparse::CcsMatrix<double, int> product;
+  ppc::sparse::SpGemm(a.View(), b.View(), product);
+  ppc::sparse::Axpby(3.0, product.View(), 0.0, c, ReverseFor{});
+  EXPECT_EQ(c.col_ptr, product.col_ptr);
+  EXPECT_EQ(c.row_index, product.row_index);
+  for (std::size_t p = 0; p < product.values.size(); ++p) {
+    EXPECT_EQ(c.values[p], 3.0 * product.values[p]);
+  }
+}
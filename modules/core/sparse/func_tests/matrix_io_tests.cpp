@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/matrix_io.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+std::string TempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / ("ppc_sparse_matrix_io_" + name)).string();
+}
+
+std::string WriteText(const std::string &name, const std::string &text) {
+  const std::string path = TempPath(name);
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+  return path;
+}
+
+}  // namespace
+
+TEST(sparse_matrix_io, reads_general_real_matrix) {
+  const std::string path = WriteText("general.mtx",
+                                     "%%MatrixMarket matrix coordinate real general\n"
+                                     "% a comment\n"
+                                     "\n"
+                                     "3 4 4\n"
+                                     "1 1 1.5\n"
+                                     "3 2 -2e1\n"
+                                     "% another comment\n"
+                                     "2 4   +3\r\n"
+                                     "1 3 0.25");
+  const auto a = ppc::sparse::ReadMatrixMarket<double>(path);
+  EXPECT_EQ(a.rows, 3);
+  EXPECT_EQ(a.cols, 4);
+  EXPECT_EQ(a.row, (std::vector<int>{0, 2, 1, 0}));
+  EXPECT_EQ(a.col, (std::vector<int>{0, 1, 3, 2}));
+  EXPECT_EQ(a.values, (std::vector<double>{1.5, -20.0, 3.0, 0.25}));
+  std::filesystem::remove(path);
+}
+
+TEST(sparse_matrix_io, mirrors_symmetric_entries) {
+  const std::string path = WriteText("symmetric.mtx",
+                                     "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+                                     "3 3 2\n"
+                                     "2 1 5\n"
+                                     "3 2 7\n");
+  const auto a = ppc::sparse::ReadMatrixMarket<float, std::int64_t>(path);
+  EXPECT_EQ(a.row, (std::vector<std::int64_t>{1, 2, 0, 1}));
+  EXPECT_EQ(a.col, (std::vector<std::int64_t>{0, 1, 1, 2}));
+  EXPECT_EQ(a.values, (std::vector<float>{5.0F, 7.0F, -5.0F, -7.0F}));
+  std::filesystem::remove(path);
+}
+
+TEST(sparse_matrix_io, reads_pattern_and_hermitian_matrices) {
+  const std::string pattern_path = WriteText("pattern.mtx",
+                                             "%%MatrixMarket matrix coordinate pattern symmetric\n"
+                                             "2 2 2\n"
+                                             "1 1\n"
+                                             "2 1\n");
+  const auto pattern = ppc::sparse::ReadMatrixMarket<double>(pattern_path);
+  EXPECT_EQ(pattern.row, (std::vector<int>{0, 1, 0}));
+  EXPECT_EQ(pattern.col, (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(pattern.values, (std::vector<double>{1.0, 1.0, 1.0}));
+
+  const std::string hermitian_path = WriteText("hermitian.mtx",
+                                               "%%MatrixMarket matrix coordinate complex hermitian\n"
+                                               "2 2 2\n"
+                                               "1 1 2 0\n"
+                                               "2 1 1 -3\n");
+  const auto hermitian = ppc::sparse::ReadMatrixMarket<std::complex<double>>(hermitian_path);
+  EXPECT_EQ(hermitian.values, (std::vector<std::complex<double>>{{2.0, 0.0}, {1.0, -3.0}, {1.0, 3.0}}));
+  // Complex entries do not fit real values
+  EXPECT_THROW(ppc::sparse::ReadMatrixMarket<double>(hermitian_path), std::runtime_error);
+  std::filesystem::remove(pattern_path);
+  std::filesystem::remove(hermitian_path);
+}
+
+TEST(sparse_matrix_io, rejects_malformed_files) {
+  const std::vector<std::string> texts = {
+      "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n",
+      "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 x\n",
+      "%%MatrixMarket matrix coordinate real symmetric\n2 3 0\n",
+      "2 2 1\n1 1 1\n",
+  };
+  for (std::size_t i = 0; i < texts.size(); ++i) {
+    const std::string path = WriteText("malformed.mtx", texts[i]);
+    EXPECT_THROW(ppc::sparse::ReadMatrixMarket<double>(path), std::runtime_error) << i;
+    std::filesystem::remove(path);
+  }
+  EXPECT_THROW(ppc::sparse::ReadMatrixMarket<double>(TempPath("does_not_exist.mtx")), std::runtime_error);
+}
+
+// A file of a few chunks, whose lines end up parsed in other orders than the file's
+TEST(sparse_matrix_io, parses_large_file_in_chunks) {
+  constexpr std::size_t kEntries = 200000;
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> index(1, 5000);
+  std::uniform_int_distribution<int> value(-100, 100);
+  std::string text = "%%MatrixMarket matrix coordinate real general\n5000 5000 " + std::to_string(kEntries) + "\n";
+  ppc::sparse::CooMatrix<double, int> expected;
+  for (std::size_t p = 0; p < kEntries; ++p) {
+    expected.row.push_back(index(gen));
+    expected.col.push_back(index(gen));
+    expected.values.push_back(value(gen) / 4.0);
+    text += std::to_string(expected.row.back()) + " " + std::to_string(expected.col.back()) + " " +
+            std::to_string(expected.values.back()) + "\n";
+    --expected.row.back();
+    --expected.col.back();
+  }
+  ASSERT_GT(text.size(), 2 * ppc::sparse::kMatrixMarketChunkBytes);
+  const std::string path = WriteText("large.mtx", text);
+  const auto a = ppc::sparse::ReadMatrixMarket<double>(path, ReverseFor{});
+  EXPECT_EQ(a.row, expected.row);
+  EXPECT_EQ(a.col, expected.col);
+  EXPECT_EQ(a.values, expected.values);
+  std::filesystem::remove(path);
+}
+
+TEST(sparse_matrix_io, maps_binary_crs_and_ccs_matrices) {
+  const ppc::sparse::CrsMatrix<double, int> a{.rows = 3,
+                                              .cols = 5,
+                                              .row_ptr = {0, 2, 2, 5},
+                                              .col_index = {1, 4, 0, 2, 3},
+                                              .values = {1.0, 2.0, 3.0, 4.0, 5.0}};
+  const std::string crs_path = TempPath("a.crs");
+  ppc::sparse::WriteBinary(crs_path, a.View());
+  {
+    const ppc::sparse::MappedCrsMatrix<double, int> mapped(crs_path);
+    const auto view = mapped.View();
+    ASSERT_EQ(view.rows, a.rows);
+    ASSERT_EQ(view.cols, a.cols);
+    ASSERT_TRUE(ppc::sparse::IsValid(view, true));
+    EXPECT_EQ(std::vector<int>(view.row_ptr, view.row_ptr + view.rows + 1), a.row_ptr);
+    EXPECT_EQ(std::vector<int>(view.col_index, view.col_index + view.Nnz()), a.col_index);
+    EXPECT_EQ(std::vector<double>(view.values, view.values + view.Nnz()), a.values);
+    // The view points into the mapping, aligned for the arrays
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.values) % 64, 0);
+  }
+  // Loading checks the layout and the types
+  EXPECT_THROW((ppc::sparse::MappedCcsMatrix<double, int>(crs_path)), std::runtime_error);
+  EXPECT_THROW((ppc::sparse::MappedCrsMatrix<float, int>(crs_path)), std::runtime_error);
+  EXPECT_THROW((ppc::sparse::MappedCrsMatrix<double, std::int64_t>(crs_path)), std::runtime_error);
+
+  const auto b = ppc::sparse::CrsToCcs(a.View());
+  const std::string ccs_path = TempPath("b.ccs");
+  ppc::sparse::WriteBinary(ccs_path, b.View());
+  const ppc::sparse::MappedCcsMatrix<double, int> mapped(ccs_path);
+  const auto back = ppc::sparse::CcsToCrs(mapped.View());
+  EXPECT_EQ(back.row_ptr, a.row_ptr);
+  EXPECT_EQ(back.col_index, a.col_index);
+  EXPECT_EQ(back.values, a.values);
+  std::filesystem::remove(crs_path);
+  std::filesystem::remove(ccs_path);
+}
+
+TEST(sparse_matrix_io, rejects_truncated_binary_file) {
+  const ppc::sparse::CcsMatrix<std::complex<double>, std::int64_t> a{
+      .rows = 2, .cols = 2, .col_ptr = {0, 1, 2}, .row_index = {1, 0}, .values = {{1.0, 2.0}, {3.0, 4.0}}};
+  const std::string path = TempPath("truncated.ccs");
+  ppc::sparse::WriteBinary(path, a.View());
+  EXPECT_EQ((ppc::sparse::MappedCcsMatrix<std::complex<double>, std::int64_t>(path).View().values[1]),
+            std::complex<double>(3.0, 4.0));
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  EXPECT_THROW((ppc::sparse::MappedCcsMatrix<std::complex<double>, std::int64_t>(path)), std::runtime_error);
+  const std::string text_path = WriteText("not_binary.ccs", "%%MatrixMarket matrix coordinate real general\n");
+  EXPECT_THROW((ppc::sparse::MappedCcsMatrix<double>(text_path)), std::runtime_error);
+  std::filesystem::remove(path);
+  std::filesystem::remove(text_path);
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/reorder.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+template <typename Index>
+bool IsPermutation(const std::vector<Index> &perm, std::size_t size) {
+  std::vector<Index> sorted = perm;
+  std::ranges::sort(sorted);
+  std::vector<Index> identity(size);
+  std::iota(identity.begin(), identity.end(), Index{0});
+  return sorted == identity;
+}
+
+// 5-point stencil on a side x side grid, the vertices numbered row by row, with its rows and columns
+// then shuffled, so that its band of 2 * side + 1 diagonals is scattered over the whole matrix
+template <typename Index>
+ppc::sparse::CrsMatrix<double, Index> ScrambledGrid(std::size_t side, unsigned seed) {
+  const std::size_t n = side * side;
+  std::vector<Index> shuffle(n);
+  std::iota(shuffle.begin(), shuffle.end(), Index{0});
+  std::mt19937 gen(seed);
+  std::ranges::shuffle(shuffle, gen);
+  ppc::sparse::CooMatrix<double, Index> coo;
+  coo.rows = n;
+  coo.cols = n;
+  auto add = [&](std::size_t i, std::size_t j, double value) {
+    coo.row.push_back(shuffle[i]);
+    coo.col.push_back(shuffle[j]);
+    coo.values.push_back(value);
+  };
+  for (std::size_t r = 0; r < side; ++r) {
+    for (std::size_t c = 0; c < side; ++c) {
+      const std::size_t v = (r * side) + c;
+      add(v, v, 4.0);
+      if (c + 1 < side) {
+        add(v, v + 1, -1.0);
+        add(v + 1, v, -1.0);
+      }
+      if (r + 1 < side) {
+        add(v, v + side, -1.0);
+        add(v + side, v, -1.0);
+      }
+    }
+  }
+  return ppc::sparse::CooToCrs(coo);
+}
+
+template <typename T, typename Index>
+std::vector<T> CrsToDense(const ppc::sparse::CrsMatrix<T, Index> &m) {
+  std::vector<T> dense(m.rows * m.cols);
+  for (std::size_t i = 0; i < m.rows; ++i) {
+    for (auto p = static_cast<std::size_t>(m.row_ptr[i]); p < static_cast<std::size_t>(m.row_ptr[i + 1]); ++p) {
+      dense[(i * m.cols) + static_cast<std::size_t>(m.col_index[p])] = m.values[p];
+    }
+  }
+  return dense;
+}
+
+}  // namespace
+
+TEST(sparse_reorder, reverse_cuthill_mckee_narrows_scrambled_grid) {
+  constexpr std::size_t kSide = 30;
+  const auto a = ScrambledGrid<int>(kSide, 1);
+  ASSERT_GT(ppc::sparse::Bandwidth(a.View()), 10 * kSide);
+
+  const auto perm = ppc::sparse::ReverseCuthillMcKee(a.View());
+  ASSERT_TRUE(IsPermutation(perm, a.rows));
+  const auto reordered = ppc::sparse::Permute(a.View(), perm, perm, ReverseFor{});
+  EXPECT_TRUE(ppc::sparse::IsValid(reordered, true));
+  // The level sets of a search from a corner are the antidiagonals of the grid, of at most kSide
+  // vertices, and an entry joins neighbouring levels
+  EXPECT_LE(ppc::sparse::Bandwidth(reordered.View()), 2 * kSide);
+  EXPECT_EQ(reordered.values.size(), a.values.size());
+}
+
+// Unsymmetric pattern, empty rows and several components: every row is still placed exactly once
+TEST(sparse_reorder, reverse_cuthill_mckee_orders_every_component) {
+  ppc::sparse::CooMatrix<double, std::int64_t> coo;
+  coo.rows = 9;
+  coo.cols = 9;
+  coo.row = {0, 1, 3, 5, 5, 7};
+  coo.col = {1, 2, 4, 6, 8, 5};
+  coo.values = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+  const auto a = ppc::sparse::CooToCcs(coo);
+  const auto perm = ppc::sparse::ReverseCuthillMcKee(a.View());
+  ASSERT_TRUE(IsPermutation(perm, 9));
+  // Connected rows stay together: 0-1-2, 3-4 and 5-6-7-8 each take consecutive positions
+  const auto position = ppc::sparse::InversePermutation(perm);
+  auto span = [&](std::vector<std::int64_t> rows) {
+    std::vector<std::int64_t> at;
+    for (const auto r : rows) {
+      at.push_back(position[static_cast<std::size_t>(r)]);
+    }
+    return *std::ranges::max_element(at) - *std::ranges::min_element(at) + 1;
+  };
+  EXPECT_EQ(span({0, 1, 2}), 3);
+  EXPECT_EQ(span({3, 4}), 2);
+  EXPECT_EQ(span({5, 6, 7, 8}), 4);
+}
+
+TEST(sparse_reorder, degree_order_is_stable) {
+  ppc::sparse::CrsMatrix<double, int> a;
+  a.rows = 5;
+  a.cols = 4;
+  a.row_ptr = {0, 2, 2, 5, 6, 8};
+  a.col_index = {0, 1, 0, 1, 2, 3, 2, 3};
+  a.values.assign(8, 1.0);
+  EXPECT_EQ(ppc::sparse::DegreeOrder(a.View()), (std::vector<int>{1, 3, 0, 4, 2}));
+  // The rows of a matrix in CCS have the same lengths
+  EXPECT_EQ(ppc::sparse::DegreeOrder(ppc::sparse::CrsToCcs(a.View()).View()), (std::vector<int>{1, 3, 0, 4, 2}));
+  EXPECT_TRUE(ppc::sparse::Reorder(a.View(), ppc::sparse::Reordering::kNone).empty());
+}
+
+TEST(sparse_reorder, permute_moves_rows_and_columns) {
+  const auto a = ScrambledGrid<int>(4, 2);
+  std::vector<int> row_perm(a.rows);
+  std::vector<int> col_perm(a.cols);
+  std::iota(row_perm.begin(), row_perm.end(), 0);
+  std::iota(col_perm.begin(), col_perm.end(), 0);
+  std::mt19937 gen(3);
+  std::ranges::shuffle(row_perm, gen);
+  std::ranges::shuffle(col_perm, gen);
+
+  const auto permuted = ppc::sparse::Permute(a.View(), row_perm, col_perm, ReverseFor{});
+  ASSERT_TRUE(ppc::sparse::IsValid(permuted, true));
+  const auto dense = CrsToDense(a);
+  const auto dense_permuted = CrsToDense(permuted);
+  for (std::size_t i = 0; i < a.rows; ++i) {
+    for (std::size_t j = 0; j < a.cols; ++j) {
+      ASSERT_EQ(dense_permuted[(i * a.cols) + j],
+                dense[(static_cast<std::size_t>(row_perm[i]) * a.cols) + static_cast<std::size_t>(col_perm[j])]);
+    }
+  }
+
+  const auto back = ppc::sparse::Permute(permuted.View(), ppc::sparse::InversePermutation(row_perm),
+                                         ppc::sparse::InversePermutation(col_perm));
+  EXPECT_EQ(back.row_ptr, a.row_ptr);
+  EXPECT_EQ(back.col_index, a.col_index);
+  EXPECT_EQ(back.values, a.values);
+}
+
+// (P A P^T)(P B P^T) = P (A B) P^T, so a product of reordered matrices permuted back is the product
+TEST(sparse_reorder, product_of_reordered_matrices_permutes_back) {
+  const auto a = ppc::sparse::CrsToCcs(ScrambledGrid<int>(12, 4).View());
+  const auto b = ppc::sparse::CrsToCcs(ScrambledGrid<int>(12, 5).View());
+  ppc::sparse::CcsMatrix<double, int> expected;
+  ppc::sparse::SpGemm(a.View(), b.View(), expected);
+
+  const auto perm = ppc::sparse::Reorder(a.View(), ppc::sparse::Reordering::kReverseCuthillMcKee);
+  ppc::sparse::CcsMatrix<double, int> c;
+  ppc::sparse::SpGemm(ppc::sparse::Permute(a.View(), perm, perm).View(),
+                      ppc::sparse::Permute(b.View(), perm, perm).View(), c);
+  const auto inverse = ppc::sparse::InversePermutation(perm);
+  const auto back = ppc::sparse::Permute(c.View(), inverse, inverse, ReverseFor{});
+  EXPECT_EQ(back.col_ptr, expected.col_ptr);
+  EXPECT_EQ(back.row_index, expected.row_index);
+  EXPECT_EQ(back.values, expected.values);
+}
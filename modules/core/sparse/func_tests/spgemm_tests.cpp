@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/spgemm.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+// Column-major dense matrix with about density of its entries set to small nonzero integers
+template <typename T>
+std::vector<T> RandomDense(std::size_t rows, std::size_t cols, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  std::uniform_int_distribution<int> value(1, 9);
+  std::vector<T> dense(rows * cols);
+  for (auto &x : dense) {
+    if (coin(gen) < density) {
+      x = static_cast<T>(value(gen));
+    }
+  }
+  return dense;
+}
+
+template <typename T, typename Index>
+ppc::sparse::CcsMatrix<T, Index> ToCcs(const std::vector<T> &dense, std::size_t rows, std::size_t cols) {
+  ppc::sparse::CcsMatrix<T, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.col_ptr.push_back(0);
+  for (std::size_t j = 0; j < cols; ++j) {
+    for (std::size_t i = 0; i < rows; ++i) {
+      if (dense[(j * rows) + i] != T{}) {
+        m.row_index.push_back(static_cast<Index>(i));
+        m.values.push_back(dense[(j * rows) + i]);
+      }
+    }
+    m.col_ptr.push_back(static_cast<Index>(m.values.size()));
+  }
+  return m;
+}
+
+template <typename T>
+std::vector<T> DenseProduct(const std::vector<T> &a, const std::vector<T> &b, std::size_t m, std::size_t k,
+                            std::size_t n) {
+  std::vector<T> c(m * n);
+  for (std::size_t j = 0; j < n; ++j) {
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t i = 0; i < m; ++i) {
+        c[(j * m) + i] += a[(p * m) + i] * b[(j * k) + p];
+      }
+    }
+  }
+  return c;
+}
+
+// The values are small integers, so the products are exact and nothing cancels: C must be the CCS form
+// of the dense product entry for entry
+template <typename T, typename Index>
+void ExpectProductMatches(std::size_t m, std::size_t k, std::size_t n, double density_a, double density_b) {
+  const auto dense_a = RandomDense<T>(m, k, density_a, 1);
+  const auto dense_b = RandomDense<T>(k, n, density_b, 2);
+  const auto a = ToCcs<T, Index>(dense_a, m, k);
+  const auto b = ToCcs<T, Index>(dense_b, k, n);
+  ppc::sparse::CcsMatrix<T, Index> c;
+  ppc::sparse::SpGemm(a.View(), b.View(), c, ReverseFor{});
+
+  const auto expected = ToCcs<T, Index>(DenseProduct(dense_a, dense_b, m, k, n), m, n);
+  EXPECT_EQ(c.rows, m);
+  EXPECT_EQ(c.cols, n);
+  EXPECT_EQ(c.col_ptr, expected.col_ptr);
+  EXPECT_EQ(c.row_index, expected.row_index);
+  EXPECT_EQ(c.values, expected.values);
+}
+
+}  // namespace
+
+TEST(spgemm, multiplies_hypersparse_matrices) { ExpectProductMatches<double, int>(500, 400, 300, 0.002, 0.005); }
+
+TEST(spgemm, multiplies_dense_columns) { ExpectProductMatches<double, int>(60, 50, 40, 0.5, 0.5); }
+
+// Columns of B from empty to full, so that both accumulators are used within one unit of work
+TEST(spgemm, multiplies_columns_of_mixed_density) {
+  constexpr std::size_t kM = 300;
+  constexpr std::size_t kK = 200;
+  constexpr std::size_t kN = 64;
+  const auto dense_a = RandomDense<double>(kM, kK, 0.01, 3);
+  std::vector<double> dense_b(kK * kN);
+  std::mt19937 gen(4);
+  for (std::size_t j = 0; j < kN; ++j) {
+    std::bernoulli_distribution coin(static_cast<double>(j) / kN);
+    for (std::size_t p = 0; p < kK; ++p) {
+      dense_b[(j * kK) + p] = coin(gen) ? 2.0 : 0.0;
+    }
+  }
+  const auto a = ToCcs<double, int>(dense_a, kM, kK);
+  const auto b = ToCcs<double, int>(dense_b, kK, kN);
+  ppc::sparse::CcsMatrix<double, int> c;
+  ppc::sparse::SpGemm(a.View(), b.View(), c);
+
+  const auto expected = ToCcs<double, int>(DenseProduct(dense_a, dense_b, kM, kK, kN), kM, kN);
+  EXPECT_EQ(c.col_ptr, expected.col_ptr);
+  EXPECT_EQ(c.row_index, expected.row_index);
+  EXPECT_EQ(c.values, expected.values);
+}
+
+TEST(spgemm, multiplies_with_64_bit_indices) { ExpectProductMatches<double, std::int64_t>(100, 80, 90, 0.05, 0.05); }
+
+TEST(spgemm, multiplies_complex_matrices) {
+  ExpectProductMatches<std::complex<double>, int>(70, 60, 50, 0.05, 0.1);
+}
+
+TEST(spgemm, multiplies_empty_matrices) {
+  const ppc::sparse::CcsMatrix<double, int> a{
+      .rows = 4, .cols = 3, .col_ptr = {0, 0, 0, 0}, .row_index = {}, .values = {}};
+  const ppc::sparse::CcsMatrix<double, int> b{
+      .rows = 3, .cols = 2, .col_ptr = {0, 0, 0}, .row_index = {}, .values = {}};
+  ppc::sparse::CcsMatrix<double, int> c;
+  ppc::sparse::SpGemm(a.View(), b.View(), c);
+  EXPECT_EQ(c.rows, std::size_t{4});
+  EXPECT_EQ(c.col_ptr, (std::vector<int>{0, 0, 0}));
+  EXPECT_TRUE(c.values.empty());
+}
+
+TEST(spgemm, keeps_cancelled_entries_until_pruned) {
+  // A = [1 1], B = [1 -1]^T and [1 1]^T: the first column of C cancels out, the second does not
+  const ppc::sparse::CcsMatrix<double, int> a{
+      .rows = 1, .cols = 2, .col_ptr = {0, 1, 2}, .row_index = {0, 0}, .values = {1.0, 1.0}};
+  const ppc::sparse::CcsMatrix<double, int> b{
+      .rows = 2, .cols = 2, .col_ptr = {0, 2, 4}, .row_index = {0, 1, 0, 1}, .values = {1.0, -1.0, 1.0, 1.0}};
+  ppc::sparse::CcsMatrix<double, int> c;
+  ppc::sparse::SpGemm(a.View(), b.View(), c);
+  EXPECT_EQ(c.col_ptr, (std::vector<int>{0, 1, 2}));
+  EXPECT_EQ(c.values, (std::vector<double>{0.0, 2.0}));
+
+  ppc::sparse::Prune(c, [](double value) { return value != 0.0; });
+  EXPECT_EQ(c.col_ptr, (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(c.row_index, (std::vector<int>{0}));
+  EXPECT_EQ(c.values, (std::vector<double>{2.0}));
+}
+
+// The CRS arrays of A and B read as CCS are A^T and B^T, and B^T * A^T is (A * B)^T
+TEST(spgemm, multiplies_crs_matrices_swapped) {
+  constexpr std::size_t kM = 30;
+  constexpr std::size_t kK = 20;
+  constexpr std::size_t kN = 25;
+  const auto dense_a = RandomDense<double>(kM, kK, 0.2, 5);
+  const auto dense_b = RandomDense<double>(kK, kN, 0.2, 6);
+  // Column-major A^T is row-major A, so ToCcs of it gives the CRS arrays of A
+  auto transpose = [](const std::vector<double> &x, std::size_t rows, std::size_t cols) {
+    std::vector<double> t(x.size());
+    for (std::size_t j = 0; j < cols; ++j) {
+      for (std::size_t i = 0; i < rows; ++i) {
+        t[(i * cols) + j] = x[(j * rows) + i];
+      }
+    }
+    return t;
+  };
+  const auto a_crs = ToCcs<double, int>(transpose(dense_a, kM, kK), kK, kM);
+  const auto b_crs = ToCcs<double, int>(transpose(dense_b, kK, kN), kN, kK);
+  ppc::sparse::CcsMatrix<double, int> c_crs;
+  ppc::sparse::SpGemm(b_crs.View(), a_crs.View(), c_crs);
+
+  const auto expected = ToCcs<double, int>(transpose(DenseProduct(dense_a, dense_b, kM, kK, kN), kM, kN), kN, kM);
+  EXPECT_EQ(c_crs.col_ptr, expected.col_ptr);
+  EXPECT_EQ(c_crs.row_index, expected.row_index);
+  EXPECT_EQ(c_crs.values, expected.values);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/split_complex.hpp"
+#include "core/sparse/include/spmv.hpp"
+
+namespace {
+
+using Complex = std::complex<double>;
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+// Compressed arrays of outer x inner slots, about density of them set to complex values with small
+// integer parts, so that products and sums are exact in either layout
+template <typename Index>
+void FillRandom(std::vector<Index> &ptr, std::vector<Index> &index, std::vector<Complex> &values, std::size_t outer,
+                std::size_t inner, double density, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::bernoulli_distribution coin(density);
+  std::uniform_int_distribution<int> part(-5, 5);
+  ptr.assign(1, Index{0});
+  for (std::size_t o = 0; o < outer; ++o) {
+    for (std::size_t i = 0; i < inner; ++i) {
+      if (coin(gen)) {
+        index.push_back(static_cast<Index>(i));
+        values.emplace_back(part(gen), part(gen));
+      }
+    }
+    ptr.push_back(static_cast<Index>(values.size()));
+  }
+}
+
+template <typename Index>
+ppc::sparse::CcsMatrix<Complex, Index> RandomCcs(std::size_t rows, std::size_t cols, double density, unsigned seed) {
+  ppc::sparse::CcsMatrix<Complex, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  FillRandom(m.col_ptr, m.row_index, m.values, cols, rows, density, seed);
+  return m;
+}
+
+template <typename Index>
+ppc::sparse::CrsMatrix<Complex, Index> RandomCrs(std::size_t rows, std::size_t cols, double density, unsigned seed) {
+  ppc::sparse::CrsMatrix<Complex, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  FillRandom(m.row_ptr, m.col_index, m.values, rows, cols, density, seed);
+  return m;
+}
+
+template <typename Index>
+void ExpectSplitSpGemmMatches(std::size_t m, std::size_t k, std::size_t n, double density) {
+  const auto a = RandomCcs<Index>(m, k, density, 1);
+  const auto b = RandomCcs<Index>(k, n, density, 2);
+  ppc::sparse::CcsMatrix<Complex, Index> expected;
+  ppc::sparse::SpGemm(a.View(), b.View(), expected);
+
+  ppc::sparse::SplitCcsMatrix<double, Index> c;
+  ppc::sparse::SpGemm(ppc::sparse::Split(a.View()).View(), ppc::sparse::Split(b.View()).View(), c, ReverseFor{});
+  const auto merged = ppc::sparse::Merge(c.View());
+  EXPECT_EQ(merged.rows, m);
+  EXPECT_EQ(merged.cols, n);
+  EXPECT_EQ(merged.col_ptr, expected.col_ptr);
+  EXPECT_EQ(merged.row_index, expected.row_index);
+  EXPECT_EQ(merged.values, expected.values);
+}
+
+template <typename Index>
+void ExpectSplitSpmvMatches(std::size_t rows, std::size_t cols, double density) {
+  const auto a = RandomCrs<Index>(rows, cols, density, 3);
+  std::vector<Complex> x(cols);
+  std::vector<double> x_re(cols);
+  std::vector<double> x_im(cols);
+  for (std::size_t j = 0; j < cols; ++j) {
+    x[j] = {static_cast<double>(j % 7) - 3.0, static_cast<double>(j % 5) - 2.0};
+    x_re[j] = x[j].real();
+    x_im[j] = x[j].imag();
+  }
+  std::vector<Complex> expected(rows);
+  ppc::sparse::SpMV(a.View(), x.data(), expected.data());
+
+  std::vector<double> y_re(rows, 1.0);
+  std::vector<double> y_im(rows, 1.0);
+  ppc::sparse::SpMV(ppc::sparse::Split(a.View()).View(), x_re.data(), x_im.data(), y_re.data(), y_im.data(),
+                    ReverseFor{});
+  for (std::size_t i = 0; i < rows; ++i) {
+    ASSERT_EQ(Complex(y_re[i], y_im[i]), expected[i]) << i;
+  }
+}
+
+}  // namespace
+
+TEST(split_complex, spgemm_matches_complex_layout) { ExpectSplitSpGemmMatches<int>(80, 60, 70, 0.08); }
+
+TEST(split_complex, spgemm_matches_complex_layout_with_dense_columns) {
+  ExpectSplitSpGemmMatches<std::int64_t>(40, 30, 20, 0.6);
+}
+
+TEST(split_complex, spmv_matches_complex_layout) { ExpectSplitSpmvMatches<int>(3000, 400, 0.05); }
+
+TEST(split_complex, spmv_matches_complex_layout_with_64_bit_indices) {
+  ExpectSplitSpmvMatches<std::int64_t>(500, 300, 0.1);
+}
+
+TEST(split_complex, split_and_merge_round_trip) {
+  const auto a = RandomCrs<int>(30, 40, 0.2, 4);
+  const auto split = ppc::sparse::Split(a.View());
+  ASSERT_EQ(split.re.size(), a.values.size());
+  EXPECT_EQ(split.re[0], a.values[0].real());
+  EXPECT_EQ(split.im[0], a.values[0].imag());
+  const auto merged = ppc::sparse::Merge(split.View());
+  EXPECT_EQ(merged.row_ptr, a.row_ptr);
+  EXPECT_EQ(merged.col_index, a.col_index);
+  EXPECT_EQ(merged.values, a.values);
+}
+
+TEST(split_complex, prunes_cancelled_entries) {
+  // (1 + i)(1 - i) + (-2)(1) = 0 in the first column, (1 + i)(i) = -1 + i in the second
+  const ppc::sparse::CcsMatrix<Complex, int> a{
+      .rows = 1, .cols = 2, .col_ptr = {0, 1, 2}, .row_index = {0, 0}, .values = {{1.0, 1.0}, {-2.0, 0.0}}};
+  const ppc::sparse::CcsMatrix<Complex, int> b{.rows = 2,
+                                               .cols = 2,
+                                               .col_ptr = {0, 2, 3},
+                                               .row_index = {0, 1, 0},
+                                               .values = {{1.0, -1.0}, {1.0, 0.0}, {0.0, 1.0}}};
+  ppc::sparse::SplitCcsMatrix<double, int> c;
+  ppc::sparse::SpGemm(ppc::sparse::Split(a.View()).View(), ppc::sparse::Split(b.View()).View(), c);
+  EXPECT_EQ(c.col_ptr, (std::vector<int>{0, 1, 2}));
+  ppc::sparse::Prune(c, [](const Complex &value) { return value != Complex{}; });
+  EXPECT_EQ(c.col_ptr, (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(c.re, (std::vector<double>{-1.0}));
+  EXPECT_EQ(c.im, (std::vector<double>{1.0}));
+}
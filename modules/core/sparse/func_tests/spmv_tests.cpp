@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spmv.hpp"
+
+namespace {
+
+// Runs body(i) in reverse order, to catch units of work that depend on the order they are done in
+struct ReverseFor {
+  template <typename Body>
+  void operator()(std::size_t count, const Body &body) const {
+    for (std::size_t i = count; i > 0; --i) {
+      body(i - 1);
+    }
+  }
+};
+
+// CRS matrix whose row i has row_nnz(i) entries in random distinct columns, valued small integers so
+// that every sum is exact whatever order it is taken in
+template <typename T, typename Index, typename RowNnz>
+ppc::sparse::CrsMatrix<T, Index> RandomCrs(std::size_t rows, std::size_t cols, const RowNnz &row_nnz, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> value(-4, 4);
+  ppc::sparse::CrsMatrix<T, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.row_ptr.push_back(0);
+  std::vector<Index> all(cols);
+  for (std::size_t j = 0; j < cols; ++j) {
+    all[j] = static_cast<Index>(j);
+  }
+  for (std::size_t i = 0; i < rows; ++i) {
+    std::shuffle(all.begin(), all.end(), gen);
+    const std::size_t count = row_nnz(i);
+    m.col_index.insert(m.col_index.end(), all.begin(), all.begin() + static_cast<std::ptrdiff_t>(count));
+    for (std::size_t p = 0; p < count; ++p) {
+      m.values.push_back(static_cast<T>(value(gen)));
+    }
+    m.row_ptr.push_back(static_cast<Index>(m.values.size()));
+  }
+  return m;
+}
+
+template <typename T>
+std::vector<T> RandomVector(std::size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> value(-3, 3);
+  std::vector<T> x(size);
+  for (auto &v : x) {
+    v = static_cast<T>(value(gen));
+  }
+  return x;
+}
+
+// Row-major c = a * b row by row, with b of n columns
+template <typename T, typename Index>
+std::vector<T> ReferenceProduct(const ppc::sparse::CrsMatrix<T, Index> &a, const std::vector<T> &b, std::size_t n) {
+  std::vector<T> c(a.rows * n);
+  for (std::size_t i = 0; i < a.rows; ++i) {
+    for (auto p = static_cast<std::size_t>(a.row_ptr[i]); p < static_cast<std::size_t>(a.row_ptr[i + 1]); ++p) {
+      for (std::size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a.values[p] * b[(static_cast<std::size_t>(a.col_index[p]) * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+template <typename T, typename Index, typename RowNnz>
+void ExpectSpmvMatches(std::size_t rows, std::size_t cols, const RowNnz &row_nnz) {
+  const auto a = RandomCrs<T, Index>(rows, cols, row_nnz, 1);
+  const auto x = RandomVector<T>(cols, 2);
+  std::vector<T> y(rows, T{7});
+  ppc::sparse::SpMV(a.View(), x.data(), y.data(), ReverseFor{});
+  EXPECT_EQ(y, ReferenceProduct(a, x, 1));
+}
+
+}  // namespace
+
+TEST(spmv, multiplies_uniform_rows) {
+  ExpectSpmvMatches<double, int>(2000, 300, [](std::size_t i) { return (i * 7) % 23; });
+}
+
+// One row with most of the nonzeros, so that it is shared by several units, among empty ones
+TEST(spmv, splits_a_long_row_across_units) {
+  ExpectSpmvMatches<double, int>(500, 60000, [](std::size_t i) {
+    if (i == 137) {
+      return std::size_t{50000};
+    }
+    return i % 3 == 0 ? std::size_t{0} : std::size_t{5};
+  });
+}
+
+// Row lengths from a power law, the case the nonzero balancing is for
+TEST(spmv, multiplies_power_law_rows) {
+  ExpectSpmvMatches<double, unsigned int>(4000, 4000, [](std::size_t i) { return std::size_t{4000} / (i + 1); });
+}
+
+TEST(spmv, multiplies_with_64_bit_indices) {
+  ExpectSpmvMatches<double, std::int64_t>(3000, 500, [](std::size_t i) { return (i * 5) % 17; });
+}
+
+TEST(spmv, multiplies_float_and_complex) {
+  ExpectSpmvMatches<float, int>(1000, 100, [](std::size_t i) { return i % 40; });
+  ExpectSpmvMatches<std::complex<double>, int>(1000, 100, [](std::size_t i) { return i % 40; });
+}
+
+TEST(spmv, multiplies_empty_matrix) {
+  ppc::sparse::CrsMatrix<double, int> a;
+  a.rows = 3;
+  a.cols = 2;
+  a.row_ptr = {0, 0, 0, 0};
+  const std::vector<double> x = {1.0, 2.0};
+  std::vector<double> y(3, 5.0);
+  ppc::sparse::SpMV(a.View(), x.data(), y.data());
+  EXPECT_EQ(y, (std::vector<double>{0.0, 0.0, 0.0}));
+}
+
+// CCS arrays read through TransposedView give the transpose of the CCS matrix
+TEST(spmv, multiplies_transpose_of_ccs_matrix) {
+  const ppc::sparse::CcsMatrix<double, int> a{
+      .rows = 2, .cols = 3, .col_ptr = {0, 1, 1, 3}, .row_index = {1, 0, 1}, .values = {1.0, 2.0, 3.0}};
+  const std::vector<double> x = {1.0, 10.0};
+  std::vector<double> y(3);
+  ppc::sparse::SpMV(ppc::sparse::TransposedView(a.View()), x.data(), y.data());
+  EXPECT_EQ(y, (std::vector<double>{10.0, 0.0, 32.0}));
+}
+
+TEST(spmm, multiplies_dense_block) {
+  constexpr std::size_t kN = 9;
+  const auto a = RandomCrs<double, int>(3000, 400, [](std::size_t i) { return i == 10 ? 400 : i % 13; }, 3);
+  const auto b = RandomVector<double>(a.cols * kN, 4);
+  std::vector<double> c(a.rows * kN, 7.0);
+  ppc::sparse::SpMM(a.View(), b.data(), kN, kN, c.data(), kN, ReverseFor{});
+  EXPECT_EQ(c, ReferenceProduct(a, b, kN));
+}
+
+TEST(spmm, uses_row_strides) {
+  // b holds 2 of its 3 columns, c is written in the first 2 of its 4
+  const auto a = RandomCrs<double, int>(40, 30, [](std::size_t i) { return i % 7; }, 5);
+  const auto b = RandomVector<double>(a.cols * 3, 6);
+  std::vector<double> b_used(a.cols * 2);
+  for (std::size_t k = 0; k < a.cols; ++k) {
+    b_used[(k * 2)] = b[(k * 3)];
+    b_used[(k * 2) + 1] = b[(k * 3) + 1];
+  }
+  std::vector<double> c(a.rows * 4, -1.0);
+  ppc::sparse::SpMM(a.View(), b.data(), 3, 2, c.data(), 4);
+  const auto expected = ReferenceProduct(a, b_used, 2);
+  for (std::size_t i = 0; i < a.rows; ++i) {
+    EXPECT_EQ(c[(i * 4)], expected[(i * 2)]);
+    EXPECT_EQ(c[(i * 4) + 1], expected[(i * 2) + 1]);
+    EXPECT_EQ(c[(i * 4) + 2], -1.0);
+  }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/generators.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// One pair of inputs of the sparse benchmark matrix, multiplied as A * B
+template <typename T, typename Index>
+struct SparseBenchmarkCase {
+  std::string name;
+  CcsMatrix<T, Index> a;
+  CcsMatrix<T, Index> b;
+};
+
+// The structures every sparse task is benchmarked on, square and of about n rows (the grids and the power of
+// two of R-MAT round it down), with about per_column entries per column where the structure leaves the
+// choice. Uniform random inputs are the easy case for SpGemm; the others bring long and uneven columns
+// (rmat), short reuse distances (banded, poisson_*) and products that stay in dense blocks (block_diagonal).
+//   erdos_renyi     independent Erdős–Rényi A and B
+//   banded          A and B with bands of per_column
+//   rmat            independent R-MAT A and B with the Graph500 probabilities
+//   block_diagonal  A and B of blocks of 4 * per_column, each a quarter full
+//   poisson_2d      A * A for the five-point Laplacian
+//   poisson_3d      A * A for the seven-point Laplacian
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+std::vector<SparseBenchmarkCase<T, Index>> SparseBenchmarkSuite(std::size_t n, std::size_t per_column,
+                                                                std::uint64_t seed = 1,
+                                                                const ParallelFor &parallel_for = {}) {
+  const double density = static_cast<double>(per_column) / static_cast<double>(n);
+  const std::size_t half_band = per_column / 2;
+  const std::size_t scale = std::bit_width(n) - 1;
+  const auto side_2d = static_cast<std::size_t>(std::sqrt(static_cast<double>(n)));
+  const auto side_3d = static_cast<std::size_t>(std::cbrt(static_cast<double>(n)));
+  const auto poisson_2d = Poisson2D<T, Index>(side_2d, side_2d, parallel_for);
+  const auto poisson_3d = Poisson3D<T, Index>(side_3d, side_3d, side_3d, parallel_for);
+
+  std::vector<SparseBenchmarkCase<T, Index>> suite;
+  suite.push_back({.name = "erdos_renyi",
+                   .a = ErdosRenyi<T, Index>(n, n, density, seed, parallel_for),
+                   .b = ErdosRenyi<T, Index>(n, n, density, seed + 1, parallel_for)});
+  suite.push_back({.name = "banded",
+                   .a = Banded<T, Index>(n, half_band, half_band, seed, parallel_for),
+                   .b = Banded<T, Index>(n, half_band, half_band, seed + 1, parallel_for)});
+  suite.push_back({.name = "rmat",
+                   .a = Rmat<T, Index>(scale, per_column, seed, {}, parallel_for),
+                   .b = Rmat<T, Index>(scale, per_column, seed + 1, {}, parallel_for)});
+  suite.push_back({.name = "block_diagonal",
+                   .a = BlockDiagonal<T, Index>(n, 4 * per_column, 0.25, seed, parallel_for),
+                   .b = BlockDiagonal<T, Index>(n, 4 * per_column, 0.25, seed + 1, parallel_for)});
+  suite.push_back({.name = "poisson_2d", .a = poisson_2d, .b = poisson_2d});
+  suite.push_back({.name = "poisson_3d", .a = poisson_3d, .b = poisson_3d});
+  return suite;
+}
+
+// Multiply-adds of A * B for CCS matrices with a.cols == b.rows, two flops each
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+std::size_t SpGemmMultiplyAdds(const CcsView<T, Index> &a, const CcsView<T, Index> &b,
+                               const ParallelFor &parallel_for = {}) {
+  std::vector<std::size_t> work((b.cols + kSpGemmColumnBlock - 1) / kSpGemmColumnBlock, 0);
+  parallel_for(work.size(), [&](std::size_t block) {
+    const std::size_t end = std::min(b.cols, (block + 1) * kSpGemmColumnBlock);
+    for (std::size_t j = block * kSpGemmColumnBlock; j < end; ++j) {
+      work[block] += detail::ColumnWork(a, b, j);
+    }
+  });
+  std::size_t total = 0;
+  for (const std::size_t w : work) {
+    total += w;
+  }
+  return total;
+}
+
+// Line of the report of the benchmark matrix for one task and one case:
+//   <task>: case=<case> time=<seconds> gflops=<GFLOP/s> nnz_per_s=<entries/s>
+// with two flops per multiply-add and nnz the entries of A, B and C together
+std::string FormatSparseRate(std::string_view task, std::string_view case_name, std::size_t multiply_adds,
+                             std::size_t nnz, double seconds);
+
+}  // namespace ppc::sparse
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Largest tiles multiplied by a dense kernel of their size; SpGemm on larger ones goes through CRS
+inline constexpr std::size_t kBsrMaxBlock = 8;
+
+// Stored values per nonzero up to which ChooseBsrBlock takes BSR: a tile product costs block^3
+// multiply-adds for block^2 index reads, and the dense kernels do them several times faster per value
+// than the scalar product does its, which pays for about this much padding
+inline constexpr double kBsrMaxFill = 2.0;
+
+namespace detail {
+
+// A block x block tile as a value of the accumulators of SpGemm
+template <typename T, std::size_t kBlock>
+struct Tile {
+  std::array<T, kBlock * kBlock> values{};
+
+  Tile &operator+=(const Tile &other) {
+    for (std::size_t i = 0; i < kBlock * kBlock; ++i) {
+      values[i] += other.values[i];
+    }
+    return *this;
+  }
+};
+
+// c = a * b for row-major kBlock x kBlock tiles. The generic version has the sizes fixed at compile
+// time, so the compiler unrolls it and vectorizes the rows of b.
+template <typename T, std::size_t kBlock>
+struct TileKernel {
+  static void Multiply(const T *a, const T *b, T *c) {
+    for (std::size_t r = 0; r < kBlock; ++r) {
+      T *row = c + (r * kBlock);
+      for (std::size_t j = 0; j < kBlock; ++j) {
+        row[j] = T{};
+      }
+      for (std::size_t k = 0; k < kBlock; ++k) {
+        const T a_rk = a[(r * kBlock) + k];
+        for (std::size_t j = 0; j < kBlock; ++j) {
+          row[j] += a_rk * b[(k * kBlock) + j];
+        }
+      }
+    }
+  }
+};
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+// Rows of c as one register: every row is a[r][0] * b[0] + ... + a[r][3] * b[3] with b held in four
+template <>
+struct TileKernel<double, 4> {
+  static void Multiply(const double *a, const double *b, double *c) {
+    const __m256d b0 = _mm256_loadu_pd(b);
+    const __m256d b1 = _mm256_loadu_pd(b + 4);
+    const __m256d b2 = _mm256_loadu_pd(b + 8);
+    const __m256d b3 = _mm256_loadu_pd(b + 12);
+    for (std::size_t r = 0; r < 4; ++r) {
+      const double *a_row = a + (r * 4);
+      __m256d acc = _mm256_mul_pd(_mm256_broadcast_sd(a_row), b0);
+      acc = _mm256_fmadd_pd(_mm256_broadcast_sd(a_row + 1), b1, acc);
+      acc = _mm256_fmadd_pd(_mm256_broadcast_sd(a_row + 2), b2, acc);
+      acc = _mm256_fmadd_pd(_mm256_broadcast_sd(a_row + 3), b3, acc);
+      _mm256_storeu_pd(c + (r * 4), acc);
+    }
+  }
+};
+
+// Rows of c as two registers, b read a row at a time
+template <>
+struct TileKernel<double, 8> {
+  static void Multiply(const double *a, const double *b, double *c) {
+    for (std::size_t r = 0; r < 8; ++r) {
+      const double *a_row = a + (r * 8);
+      __m256d lo = _mm256_setzero_pd();
+      __m256d hi = _mm256_setzero_pd();
+      for (std::size_t k = 0; k < 8; ++k) {
+        const __m256d a_rk = _mm256_broadcast_sd(a_row + k);
+        lo = _mm256_fmadd_pd(a_rk, _mm256_loadu_pd(b + (k * 8)), lo);
+        hi = _mm256_fmadd_pd(a_rk, _mm256_loadu_pd(b + (k * 8) + 4), hi);
+      }
+      _mm256_storeu_pd(c + (r * 8), lo);
+      _mm256_storeu_pd(c + (r * 8) + 4, hi);
+    }
+  }
+};
+
+#endif
+
+// The tiles of a as the entries of a CRS matrix of block rows and block columns
+template <typename T, typename Index>
+CrsView<T, Index> TilePattern(const BsrView<T, Index> &a) {
+  return {.rows = a.BlockRows(),
+          .cols = a.BlockCols(),
+          .row_ptr = a.block_row_ptr,
+          .col_index = a.block_col_index,
+          .values = a.values};
+}
+
+// SpGemm of the tile patterns with Tile values. The CRS arrays of the tiles of A * B are the CCS
+// arrays of B^T * A^T, so the CCS passes get the patterns swapped and read as CCS.
+template <std::size_t kBlock, typename T, typename Index, typename ParallelFor>
+void BsrSpGemm(const BsrView<T, Index> &a, const BsrView<T, Index> &b, BsrMatrix<T, Index> &c,
+               const ParallelFor &parallel_for) {
+  constexpr std::size_t kTile = kBlock * kBlock;
+  SpGemmPasses<Tile<T, kBlock>>(
+      TransposedView(TilePattern(b)), TransposedView(TilePattern(a)), c.block_row_ptr, c.block_col_index,
+      [&](std::size_t pb, std::size_t pa) {
+        Tile<T, kBlock> product;
+        TileKernel<T, kBlock>::Multiply(a.Tile(pa), b.Tile(pb), product.values.data());
+        return product;
+      },
+      [&](std::size_t tiles) { c.values.resize(tiles * kTile); },
+      [&](std::size_t p, const Tile<T, kBlock> &tile) {
+        std::ranges::copy(tile.values, c.values.begin() + static_cast<std::ptrdiff_t>(p * kTile));
+      },
+      parallel_for);
+}
+
+}  // namespace detail
+
+// Number of block x block tiles that hold an entry of a, which CrsToBsr would store
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+std::size_t BsrTiles(const CrsView<T, Index> &a, std::size_t block, const ParallelFor &parallel_for = {}) {
+  const std::size_t block_rows = (a.rows + block - 1) / block;
+  const linalg::BlockTiling units(block_rows, std::max<std::size_t>(kSparseKeyBlock / block, 1));
+  std::vector<std::size_t> tiles(units.Count(), 0);
+  parallel_for(units.Count(), [&](std::size_t u) {
+    std::vector<std::size_t> mark((a.cols + block - 1) / block, 0);
+    for (std::size_t br = units.Begin(u); br < units.Begin(u) + units.Size(u); ++br) {
+      const std::size_t first = br * block;
+      const std::size_t last = std::min(a.rows, first + block);
+      for (std::size_t p = a.Begin(first); p < a.End(last - 1); ++p) {
+        const auto bc = static_cast<std::size_t>(a.col_index[p]) / block;
+        if (mark[bc] != br + 1) {
+          mark[bc] = br + 1;
+          ++tiles[u];
+        }
+      }
+    }
+  });
+  std::size_t total = 0;
+  for (const std::size_t t : tiles) {
+    total += t;
+  }
+  return total;
+}
+
+// Values BSR with block x block tiles stores per nonzero of a, 1 for a matrix made of full tiles
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+double BsrFill(const CrsView<T, Index> &a, std::size_t block, const ParallelFor &parallel_for = {}) {
+  if (a.Nnz() == 0) {
+    return 1.0;
+  }
+  return static_cast<double>(BsrTiles(a, block, parallel_for) * block * block) / static_cast<double>(a.Nnz());
+}
+
+// The largest block size from kBsrMaxBlock down to 2 whose fill stays within max_fill, or 1 if none
+// does and a is better multiplied entry by entry. The transpose has the same tiles, so this holds for
+// the CCS arrays of a matrix read through TransposedView too.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+std::size_t ChooseBsrBlock(const CrsView<T, Index> &a, double max_fill = kBsrMaxFill,
+                           const ParallelFor &parallel_for = {}) {
+  for (std::size_t block = kBsrMaxBlock; block >= 2; --block) {
+    if (BsrFill(a, block, parallel_for) <= max_fill) {
+      return block;
+    }
+  }
+  return 1;
+}
+
+// C = A * B for BSR matrices of the same block size with a.cols == b.rows: Gustavson over the tiles,
+// with the passes and the balancing of SpGemm, each pair of tiles multiplied by a dense kernel. C has
+// every tile some pair reaches, canonical, and keeps the zeros they may hold; BsrToCrs drops them.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpGemm(const BsrView<T, Index> &a, const BsrView<T, Index> &b, BsrMatrix<T, Index> &c,
+            const ParallelFor &parallel_for = {}) {
+  c.rows = a.rows;
+  c.cols = b.cols;
+  c.block = a.block;
+  switch (a.block) {
+    case 1:
+      return detail::BsrSpGemm<1>(a, b, c, parallel_for);
+    case 2:
+      return detail::BsrSpGemm<2>(a, b, c, parallel_for);
+    case 3:
+      return detail::BsrSpGemm<3>(a, b, c, parallel_for);
+    case 4:
+      return detail::BsrSpGemm<4>(a, b, c, parallel_for);
+    case 5:
+      return detail::BsrSpGemm<5>(a, b, c, parallel_for);
+    case 6:
+      return detail::BsrSpGemm<6>(a, b, c, parallel_for);
+    case 7:
+      return detail::BsrSpGemm<7>(a, b, c, parallel_for);
+    case 8:
+      return detail::BsrSpGemm<8>(a, b, c, parallel_for);
+    default:
+      break;
+  }
+  // Tiles beyond the kernels: the product of the nonzeros, tiled again
+  const CrsMatrix<T, Index> a_crs = BsrToCrs(a, parallel_for);
+  const CrsMatrix<T, Index> b_crs = BsrToCrs(b, parallel_for);
+  CcsMatrix<T, Index> c_t;
+  SpGemm(TransposedView(b_crs.View()), TransposedView(a_crs.View()), c_t, parallel_for);
+  c = CrsToBsr(TransposedView(c_t.View()), a.block, parallel_for);
+}
+
+}  // namespace ppc::sparse
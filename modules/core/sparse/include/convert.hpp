@@ -0,0 +1,361 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Entries that one unit of parallel work of a conversion goes through
+inline constexpr std::size_t kSparseChunkWork = std::size_t{1} << 14;
+
+// Most units a counting sort is split into; each of them keeps a histogram of all the keys
+inline constexpr std::size_t kSparseMaxSortChunks = 256;
+
+// Rows, columns or keys that one unit of parallel work takes where each of them is little work
+inline constexpr std::size_t kSparseKeyBlock = 4096;
+
+namespace detail {
+
+// Turns the counts ptr[1 .. n] into the offsets ptr[0 .. n] in place: the blocks of kSparseKeyBlock
+// are summed in parallel, the block sums added up serially, and then every block is scanned from its base
+template <typename Index, typename ParallelFor>
+void PrefixSum(Index *ptr, std::size_t n, const ParallelFor &parallel_for) {
+  const linalg::BlockTiling blocks(n, kSparseKeyBlock);
+  std::vector<std::size_t> base(blocks.Count() + 1);
+  parallel_for(blocks.Count(), [&](std::size_t b) {
+    std::size_t sum = 0;
+    for (std::size_t i = blocks.Begin(b); i < blocks.Begin(b) + blocks.Size(b); ++i) {
+      sum += static_cast<std::size_t>(ptr[i + 1]);
+    }
+    base[b + 1] = sum;
+  });
+  for (std::size_t b = 0; b < blocks.Count(); ++b) {
+    base[b + 1] += base[b];
+  }
+  ptr[0] = Index{0};
+  parallel_for(blocks.Count(), [&](std::size_t b) {
+    std::size_t sum = base[b];
+    for (std::size_t i = blocks.Begin(b); i < blocks.Begin(b) + blocks.Size(b); ++i) {
+      sum += static_cast<std::size_t>(ptr[i + 1]);
+      ptr[i + 1] = static_cast<Index>(sum);
+    }
+  });
+}
+
+// Stable counting sort of the entries [0, size) by key(p) < keys: afterwards ptr[0 .. keys] is where
+// every key starts and order[ptr[k] .. ptr[k + 1]) are the entries with key k in their original order.
+// Each unit of work counts a range of entries into a histogram of its own, the histograms are scanned
+// key by key into where each unit puts its entries of that key, and the units place them independently.
+template <typename Index, typename Key, typename ParallelFor>
+void CountingSort(std::size_t size, std::size_t keys, const Key &key, Index *ptr, std::size_t *order,
+                  const ParallelFor &parallel_for) {
+  // No more units than keep the histograms within the order of size
+  const std::size_t by_work = (size + kSparseChunkWork - 1) / kSparseChunkWork;
+  const std::size_t by_memory = size / std::max<std::size_t>(keys, 1);
+  const std::size_t units = std::clamp<std::size_t>(std::min(by_work, by_memory), 1, kSparseMaxSortChunks);
+  const linalg::BlockTiling chunks(size, (size + units - 1) / units);
+  const std::size_t count = chunks.Count();
+
+  // offsets[c * keys + k]: entries of unit c with key k, then where in the slice of key k they start
+  std::vector<std::size_t> offsets(count * keys);
+  parallel_for(count, [&](std::size_t c) {
+    std::size_t *histogram = offsets.data() + (c * keys);
+    for (std::size_t p = chunks.Begin(c); p < chunks.Begin(c) + chunks.Size(c); ++p) {
+      ++histogram[static_cast<std::size_t>(key(p))];
+    }
+  });
+  const linalg::BlockTiling key_blocks(keys, kSparseKeyBlock);
+  parallel_for(key_blocks.Count(), [&](std::size_t b) {
+    for (std::size_t k = key_blocks.Begin(b); k < key_blocks.Begin(b) + key_blocks.Size(b); ++k) {
+      std::size_t sum = 0;
+      for (std::size_t c = 0; c < count; ++c) {
+        const std::size_t n = offsets[(c * keys) + k];
+        offsets[(c * keys) + k] = sum;
+        sum += n;
+      }
+      ptr[k + 1] = static_cast<Index>(sum);
+    }
+  });
+  PrefixSum(ptr, keys, parallel_for);
+  parallel_for(count, [&](std::size_t c) {
+    std::size_t *next = offsets.data() + (c * keys);
+    for (std::size_t p = chunks.Begin(c); p < chunks.Begin(c) + chunks.Size(c); ++p) {
+      const auto k = static_cast<std::size_t>(key(p));
+      order[static_cast<std::size_t>(ptr[k]) + next[k]++] = p;
+    }
+  });
+}
+
+// Compressed arrays of the same entries along the other dimension, which read in the same format are
+// the transpose. The entries are sorted stably by their index, so each new slice comes out in order.
+template <typename T, typename Index, typename ParallelFor>
+void TransposeCompressed(std::size_t outer, std::size_t inner, const Index *ptr, const Index *index, const T *values,
+                         std::vector<Index> &out_ptr, std::vector<Index> &out_index, std::vector<T> &out_values,
+                         const ParallelFor &parallel_for) {
+  const auto nnz = static_cast<std::size_t>(ptr[outer]);
+  std::vector<std::size_t> order(nnz);
+  out_ptr.assign(inner + 1, Index{0});
+  CountingSort(nnz, inner, [&](std::size_t p) { return index[p]; }, out_ptr.data(), order.data(), parallel_for);
+
+  // Slice of every entry, which becomes its index
+  std::vector<Index> owner(nnz);
+  const linalg::BlockTiling slices(outer, kSparseKeyBlock);
+  parallel_for(slices.Count(), [&](std::size_t b) {
+    for (std::size_t o = slices.Begin(b); o < slices.Begin(b) + slices.Size(b); ++o) {
+      std::fill(owner.begin() + ptr[o], owner.begin() + ptr[o + 1], static_cast<Index>(o));
+    }
+  });
+  out_index.resize(nnz);
+  out_values.resize(nnz);
+  const linalg::BlockTiling entries(nnz, kSparseChunkWork);
+  parallel_for(entries.Count(), [&](std::size_t b) {
+    for (std::size_t t = entries.Begin(b); t < entries.Begin(b) + entries.Size(b); ++t) {
+      out_index[t] = owner[order[t]];
+      out_values[t] = values[order[t]];
+    }
+  });
+}
+
+// Compressed arrays along outer slices of a coordinate list: the entries are sorted by their inner
+// index and then stably by their outer one, which leaves every slice in order, and repeats are summed
+template <typename T, typename Index, typename ParallelFor>
+void CooToCompressed(std::size_t outer, std::size_t inner, const std::vector<Index> &outer_index,
+                     const std::vector<Index> &inner_index, const std::vector<T> &values, std::vector<Index> &ptr,
+                     std::vector<Index> &index, std::vector<T> &out_values, const ParallelFor &parallel_for) {
+  const std::size_t size = values.size();
+  std::vector<Index> by_inner_ptr(inner + 1);
+  std::vector<std::size_t> by_inner(size);
+  CountingSort(size, inner, [&](std::size_t p) { return inner_index[p]; }, by_inner_ptr.data(), by_inner.data(),
+               parallel_for);
+  std::vector<Index> sorted_ptr(outer + 1);
+  std::vector<std::size_t> order(size);
+  CountingSort(size, outer, [&](std::size_t t) { return outer_index[by_inner[t]]; }, sorted_ptr.data(), order.data(),
+               parallel_for);
+  auto entry = [&](std::size_t t) { return by_inner[order[t]]; };
+  auto repeats = [&](std::size_t o, std::size_t t) {
+    return t > static_cast<std::size_t>(sorted_ptr[o]) && inner_index[entry(t)] == inner_index[entry(t - 1)];
+  };
+
+  ptr.assign(outer + 1, Index{0});
+  const linalg::BlockTiling slices(outer, kSparseKeyBlock);
+  parallel_for(slices.Count(), [&](std::size_t b) {
+    for (std::size_t o = slices.Begin(b); o < slices.Begin(b) + slices.Size(b); ++o) {
+      std::size_t distinct = 0;
+      for (auto t = static_cast<std::size_t>(sorted_ptr[o]); t < static_cast<std::size_t>(sorted_ptr[o + 1]); ++t) {
+        distinct += repeats(o, t) ? 0 : 1;
+      }
+      ptr[o + 1] = static_cast<Index>(distinct);
+    }
+  });
+  PrefixSum(ptr.data(), outer, parallel_for);
+
+  const auto nnz = static_cast<std::size_t>(ptr[outer]);
+  index.resize(nnz);
+  out_values.resize(nnz);
+  parallel_for(slices.Count(), [&](std::size_t b) {
+    for (std::size_t o = slices.Begin(b); o < slices.Begin(b) + slices.Size(b); ++o) {
+      auto q = static_cast<std::size_t>(ptr[o]);
+      for (auto t = static_cast<std::size_t>(sorted_ptr[o]); t < static_cast<std::size_t>(sorted_ptr[o + 1]); ++t) {
+        if (repeats(o, t)) {
+          out_values[q - 1] += values[entry(t)];
+        } else {
+          index[q] = inner_index[entry(t)];
+          out_values[q] = values[entry(t)];
+          ++q;
+        }
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+// Format conversions. They accept any valid matrix and return a canonical one, and run their passes
+// through parallel_for(count, body) as ppc::linalg::Gemm does.
+
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> CrsToCcs(const CrsView<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CcsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  detail::TransposeCompressed(a.rows, a.cols, a.row_ptr, a.col_index, a.values, result.col_ptr, result.row_index,
+                              result.values, parallel_for);
+  return result;
+}
+
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CrsMatrix<T, Index> CcsToCrs(const CcsView<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CrsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  detail::TransposeCompressed(a.cols, a.rows, a.col_ptr, a.row_index, a.values, result.row_ptr, result.col_index,
+                              result.values, parallel_for);
+  return result;
+}
+
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CrsMatrix<T, Index> CooToCrs(const CooMatrix<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CrsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  detail::CooToCompressed(a.rows, a.cols, a.row, a.col, a.values, result.row_ptr, result.col_index, result.values,
+                          parallel_for);
+  return result;
+}
+
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> CooToCcs(const CooMatrix<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CcsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  detail::CooToCompressed(a.cols, a.rows, a.col, a.row, a.values, result.col_ptr, result.row_index, result.values,
+                          parallel_for);
+  return result;
+}
+
+// A^T in the format of A: the same arrays as the conversion to the other format, read the other way
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CrsMatrix<T, Index> Transpose(const CrsView<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CrsMatrix<T, Index> result;
+  result.rows = a.cols;
+  result.cols = a.rows;
+  detail::TransposeCompressed(a.rows, a.cols, a.row_ptr, a.col_index, a.values, result.row_ptr, result.col_index,
+                              result.values, parallel_for);
+  return result;
+}
+
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> Transpose(const CcsView<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CcsMatrix<T, Index> result;
+  result.rows = a.cols;
+  result.cols = a.rows;
+  detail::TransposeCompressed(a.cols, a.rows, a.col_ptr, a.row_index, a.values, result.col_ptr, result.row_index,
+                              result.values, parallel_for);
+  return result;
+}
+
+// BSR with block x block tiles of a CRS matrix: every tile that holds an entry of a is stored
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+BsrMatrix<T, Index> CrsToBsr(const CrsView<T, Index> &a, std::size_t block, const ParallelFor &parallel_for = {}) {
+  BsrMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  result.block = block;
+  const std::size_t block_rows = (a.rows + block - 1) / block;
+  const std::size_t block_cols = (a.cols + block - 1) / block;
+  const std::size_t tile = block * block;
+  auto rows_of = [&](std::size_t br) { return std::pair{br * block, std::min(a.rows, (br + 1) * block)}; };
+
+  // Units of about kSparseKeyBlock rows; each marks the block columns of one block row at a time
+  const linalg::BlockTiling units(block_rows, std::max<std::size_t>(kSparseKeyBlock / block, 1));
+  result.block_row_ptr.assign(block_rows + 1, Index{0});
+  parallel_for(units.Count(), [&](std::size_t u) {
+    std::vector<std::size_t> mark(block_cols, 0);
+    for (std::size_t br = units.Begin(u); br < units.Begin(u) + units.Size(u); ++br) {
+      const std::size_t stamp = br + 1;
+      std::size_t tiles = 0;
+      const auto [first, last] = rows_of(br);
+      for (std::size_t p = a.Begin(first); p < a.End(last - 1); ++p) {
+        const auto bc = static_cast<std::size_t>(a.col_index[p]) / block;
+        if (mark[bc] != stamp) {
+          mark[bc] = stamp;
+          ++tiles;
+        }
+      }
+      result.block_row_ptr[br + 1] = static_cast<Index>(tiles);
+    }
+  });
+  detail::PrefixSum(result.block_row_ptr.data(), block_rows, parallel_for);
+
+  const auto blocks = static_cast<std::size_t>(result.block_row_ptr[block_rows]);
+  result.block_col_index.resize(blocks);
+  result.values.assign(blocks * tile, T{});
+  parallel_for(units.Count(), [&](std::size_t u) {
+    std::vector<std::size_t> mark(block_cols, 0);
+    std::vector<std::size_t> slot(block_cols);
+    for (std::size_t br = units.Begin(u); br < units.Begin(u) + units.Size(u); ++br) {
+      const std::size_t stamp = br + 1;
+      const auto [first, last] = rows_of(br);
+      const auto begin = static_cast<std::size_t>(result.block_row_ptr[br]);
+      std::size_t end = begin;
+      for (std::size_t p = a.Begin(first); p < a.End(last - 1); ++p) {
+        const auto bc = static_cast<std::size_t>(a.col_index[p]) / block;
+        if (mark[bc] != stamp) {
+          mark[bc] = stamp;
+          result.block_col_index[end++] = static_cast<Index>(bc);
+        }
+      }
+      std::sort(result.block_col_index.begin() + static_cast<std::ptrdiff_t>(begin),
+                result.block_col_index.begin() + static_cast<std::ptrdiff_t>(end));
+      for (std::size_t q = begin; q < end; ++q) {
+        slot[static_cast<std::size_t>(result.block_col_index[q])] = q;
+      }
+      for (std::size_t r = first; r < last; ++r) {
+        for (std::size_t p = a.Begin(r); p < a.End(r); ++p) {
+          const auto c = static_cast<std::size_t>(a.col_index[p]);
+          result.values[(slot[c / block] * tile) + ((r - first) * block) + (c % block)] += a.values[p];
+        }
+      }
+    }
+  });
+  return result;
+}
+
+// CRS of the nonzeros of a BSR matrix; the zeros the tiles are padded with are left out, and so are
+// any other zeros they hold
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CrsMatrix<T, Index> BsrToCrs(const BsrView<T, Index> &a, const ParallelFor &parallel_for = {}) {
+  CrsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  const std::size_t block = a.block;
+  // f(column, value) for every nonzero of row r, in order of columns if a is canonical
+  auto for_each_in_row = [&](std::size_t r, const auto &f) {
+    const std::size_t br = r / block;
+    for (std::size_t p = a.Begin(br); p < a.End(br); ++p) {
+      const std::size_t first_col = static_cast<std::size_t>(a.block_col_index[p]) * block;
+      const T *row = a.Tile(p) + ((r % block) * block);
+      for (std::size_t c = 0; c < block && first_col + c < a.cols; ++c) {
+        if (row[c] != T{}) {
+          f(first_col + c, row[c]);
+        }
+      }
+    }
+  };
+
+  const linalg::BlockTiling units(a.rows, kSparseKeyBlock);
+  result.row_ptr.assign(a.rows + 1, Index{0});
+  parallel_for(units.Count(), [&](std::size_t u) {
+    for (std::size_t r = units.Begin(u); r < units.Begin(u) + units.Size(u); ++r) {
+      std::size_t count = 0;
+      for_each_in_row(r, [&](std::size_t, const T &) { ++count; });
+      result.row_ptr[r + 1] = static_cast<Index>(count);
+    }
+  });
+  detail::PrefixSum(result.row_ptr.data(), a.rows, parallel_for);
+
+  const auto nnz = static_cast<std::size_t>(result.row_ptr[a.rows]);
+  result.col_index.resize(nnz);
+  result.values.resize(nnz);
+  parallel_for(units.Count(), [&](std::size_t u) {
+    for (std::size_t r = units.Begin(u); r < units.Begin(u) + units.Size(u); ++r) {
+      auto q = static_cast<std::size_t>(result.row_ptr[r]);
+      for_each_in_row(r, [&](std::size_t c, const T &value) {
+        result.col_index[q] = static_cast<Index>(c);
+        result.values[q] = value;
+        ++q;
+      });
+    }
+  });
+  return result;
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Random sparse matrices of the structures that SpGemm and SpMV are most sensitive to, for tests and
+// benchmarks. They come out canonical, with values uniform in [-1, 1) unless said otherwise. The columns, or
+// the edges of Rmat, are split into units of parallel work with a random engine each, seeded by the seed
+// and the unit, so a matrix depends on its seed only and not on how parallel_for runs the units.
+
+// Columns, or edges of Rmat, that one unit of parallel work of a generator makes
+inline constexpr std::size_t kGeneratorBlock = 4096;
+
+// Quadrant probabilities of Rmat, top left, top right and bottom left, the bottom right one taking the rest;
+// the defaults are those of Graph500
+struct RmatProbabilities {
+  double a = 0.57;
+  double b = 0.19;
+  double c = 0.19;
+};
+
+namespace detail {
+
+inline std::mt19937_64 UnitEngine(std::uint64_t seed, std::size_t unit) {
+  std::seed_seq sequence{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                         static_cast<std::uint32_t>(unit), static_cast<std::uint32_t>(unit >> 32)};
+  return std::mt19937_64(sequence);
+}
+
+template <typename T>
+T RandomValue(std::mt19937_64 &engine) {
+  return static_cast<T>(std::uniform_real_distribution<double>(-1.0, 1.0)(engine));
+}
+
+// CCS matrix whose column j is made by column(j, engine, emit), which calls emit(row, value) for its
+// entries in order of rows. Every unit of work appends its columns to arrays of its own, and they are
+// copied to their places once the sizes of all the columns are known.
+template <typename T, typename Index, typename Column, typename ParallelFor>
+CcsMatrix<T, Index> GenerateColumns(std::size_t rows, std::size_t cols, std::uint64_t seed, const Column &column,
+                                    const ParallelFor &parallel_for) {
+  CcsMatrix<T, Index> m;
+  m.rows = rows;
+  m.cols = cols;
+  m.col_ptr.assign(cols + 1, Index{0});
+  const linalg::BlockTiling units(cols, kGeneratorBlock);
+  std::vector<std::vector<Index>> unit_rows(units.Count());
+  std::vector<std::vector<T>> unit_values(units.Count());
+  parallel_for(units.Count(), [&](std::size_t u) {
+    std::mt19937_64 engine = UnitEngine(seed, u);
+    for (std::size_t j = units.Begin(u); j < units.Begin(u) + units.Size(u); ++j) {
+      const std::size_t before = unit_rows[u].size();
+      column(j, engine, [&](std::size_t i, const T &value) {
+        unit_rows[u].push_back(static_cast<Index>(i));
+        unit_values[u].push_back(value);
+      });
+      m.col_ptr[j + 1] = static_cast<Index>(unit_rows[u].size() - before);
+    }
+  });
+  PrefixSum(m.col_ptr.data(), cols, parallel_for);
+  m.row_index.resize(m.View().Nnz());
+  m.values.resize(m.View().Nnz());
+  parallel_for(units.Count(), [&](std::size_t u) {
+    const auto offset = static_cast<std::ptrdiff_t>(m.col_ptr[units.Begin(u)]);
+    std::ranges::copy(unit_rows[u], m.row_index.begin() + offset);
+    std::ranges::copy(unit_values[u], m.values.begin() + offset);
+  });
+  return m;
+}
+
+// emit(i, value) for every row i of [begin, end) independently with probability density, skipping the
+// rows in between by geometric steps, so that the work is that of the entries made
+template <typename T, typename Emit>
+void BernoulliRows(std::size_t begin, std::size_t end, double density, std::mt19937_64 &engine, const Emit &emit) {
+  if (density <= 0.0) {
+    return;
+  }
+  if (density >= 1.0) {
+    for (std::size_t i = begin; i < end; ++i) {
+      emit(i, RandomValue<T>(engine));
+    }
+    return;
+  }
+  std::geometric_distribution<std::size_t> skip(density);
+  for (std::size_t i = begin + skip(engine); i < end; i += 1 + skip(engine)) {
+    emit(i, RandomValue<T>(engine));
+  }
+}
+
+}  // namespace detail
+
+// Erdős–Rényi: every entry of a rows x cols matrix present independently with probability density
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> ErdosRenyi(std::size_t rows, std::size_t cols, double density, std::uint64_t seed,
+                               const ParallelFor &parallel_for = {}) {
+  return detail::GenerateColumns<T, Index>(
+      rows, cols, seed,
+      [&](std::size_t, std::mt19937_64 &engine, const auto &emit) {
+        detail::BernoulliRows<T>(0, rows, density, engine, emit);
+      },
+      parallel_for);
+}
+
+// n x n band matrix with every entry (i, j) for j - upper <= i <= j + lower
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> Banded(std::size_t n, std::size_t lower, std::size_t upper, std::uint64_t seed,
+                           const ParallelFor &parallel_for = {}) {
+  return detail::GenerateColumns<T, Index>(
+      n, n, seed,
+      [&](std::size_t j, std::mt19937_64 &engine, const auto &emit) {
+        for (std::size_t i = j - std::min(j, upper); i < std::min(n, j + lower + 1); ++i) {
+          emit(i, detail::RandomValue<T>(engine));
+        }
+      },
+      parallel_for);
+}
+
+// n x n matrix of diagonal block x block blocks, the last one cut short, each entry of a block present
+// independently with probability density
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> BlockDiagonal(std::size_t n, std::size_t block, double density, std::uint64_t seed,
+                                  const ParallelFor &parallel_for = {}) {
+  return detail::GenerateColumns<T, Index>(
+      n, n, seed,
+      [&](std::size_t j, std::mt19937_64 &engine, const auto &emit) {
+        const std::size_t begin = j / block * block;
+        detail::BernoulliRows<T>(begin, std::min(n, begin + block), density, engine, emit);
+      },
+      parallel_for);
+}
+
+// Five-point Laplacian of an nx x ny grid, 4 on the diagonal and -1 to every neighbour, the vertex (x, y)
+// being row and column x + nx * y
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> Poisson2D(std::size_t nx, std::size_t ny, const ParallelFor &parallel_for = {}) {
+  return detail::GenerateColumns<T, Index>(
+      nx * ny, nx * ny, 0,
+      [&](std::size_t j, std::mt19937_64 &, const auto &emit) {
+        const std::size_t x = j % nx;
+        const std::size_t y = j / nx;
+        const T neighbour = static_cast<T>(-1);
+        if (y > 0) {
+          emit(j - nx, neighbour);
+        }
+        if (x > 0) {
+          emit(j - 1, neighbour);
+        }
+        emit(j, static_cast<T>(4));
+        if (x + 1 < nx) {
+          emit(j + 1, neighbour);
+        }
+        if (y + 1 < ny) {
+          emit(j + nx, neighbour);
+        }
+      },
+      parallel_for);
+}
+
+// Seven-point Laplacian of an nx x ny x nz grid, 6 on the diagonal and -1 to every neighbour, the vertex
+// (x, y, z) being row and column x + nx * (y + ny * z)
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> Poisson3D(std::size_t nx, std::size_t ny, std::size_t nz, const ParallelFor &parallel_for = {}) {
+  const std::size_t plane = nx * ny;
+  return detail::GenerateColumns<T, Index>(
+      plane * nz, plane * nz, 0,
+      [&](std::size_t j, std::mt19937_64 &, const auto &emit) {
+        const std::size_t x = j % nx;
+        const std::size_t y = j / nx % ny;
+        const std::size_t z = j / plane;
+        const T neighbour = static_cast<T>(-1);
+        if (z > 0) {
+          emit(j - plane, neighbour);
+        }
+        if (y > 0) {
+          emit(j - nx, neighbour);
+        }
+        if (x > 0) {
+          emit(j - 1, neighbour);
+        }
+        emit(j, static_cast<T>(6));
+        if (x + 1 < nx) {
+          emit(j + 1, neighbour);
+        }
+        if (y + 1 < ny) {
+          emit(j + nx, neighbour);
+        }
+        if (z + 1 < nz) {
+          emit(j + plane, neighbour);
+        }
+      },
+      parallel_for);
+}
+
+// R-MAT power-law graph of 2^scale vertices and edge_factor * 2^scale edges as a square matrix: every edge
+// picks one of the four quadrants of the matrix with the given probabilities, then one of the quadrants of
+// that, and so on down to a single entry. Edges that land on the same entry add up, so there are somewhat
+// fewer entries than edges, and the first rows and columns are by far the densest.
+template <typename T = double, typename Index = int, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> Rmat(std::size_t scale, std::size_t edge_factor, std::uint64_t seed,
+                         const RmatProbabilities &probabilities = {}, const ParallelFor &parallel_for = {}) {
+  const std::size_t n = std::size_t{1} << scale;
+  CooMatrix<T, Index> edges;
+  edges.rows = n;
+  edges.cols = n;
+  edges.row.resize(edge_factor * n);
+  edges.col.resize(edge_factor * n);
+  edges.values.resize(edge_factor * n);
+  const linalg::BlockTiling units(edge_factor * n, kGeneratorBlock);
+  parallel_for(units.Count(), [&](std::size_t u) {
+    std::mt19937_64 engine = detail::UnitEngine(seed, u);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    for (std::size_t e = units.Begin(u); e < units.Begin(u) + units.Size(u); ++e) {
+      std::size_t row = 0;
+      std::size_t col = 0;
+      for (std::size_t bit = n >> 1; bit > 0; bit >>= 1) {
+        const double r = coin(engine);
+        if (r >= probabilities.a + probabilities.b) {
+          row |= bit;
+        }
+        if ((r >= probabilities.a && r < probabilities.a + probabilities.b) ||
+            r >= probabilities.a + probabilities.b + probabilities.c) {
+          col |= bit;
+        }
+      }
+      edges.row[e] = static_cast<Index>(row);
+      edges.col[e] = static_cast<Index>(col);
+      edges.values[e] = detail::RandomValue<T>(engine);
+    }
+  });
+  return CooToCcs(edges, parallel_for);
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+namespace detail {
+
+// Multiply-adds of column j of A * B plus the entries of the mask there, the work of Gather
+template <typename T, typename M, typename Index>
+std::size_t GatherWork(const CcsView<T, Index> &a, const CcsView<T, Index> &b, const CcsView<M, Index> &mask,
+                       std::size_t j) {
+  return ColumnWork(a, b, j) + (mask.End(j) - mask.Begin(j));
+}
+
+// Entries of column j of B plus those of the rows of A that column j of the mask selects, the work of Dot
+template <typename T, typename M, typename Index>
+std::size_t DotWork(const CrsView<T, Index> &a_rows, const CcsView<T, Index> &b, const CcsView<M, Index> &mask,
+                    std::size_t j) {
+  std::size_t work = b.End(j) - b.Begin(j);
+  for (std::size_t p = mask.Begin(j); p < mask.End(j); ++p) {
+    const auto i = static_cast<std::size_t>(mask.row_index[p]);
+    work += a_rows.End(i) - a_rows.Begin(i) + 1;
+  }
+  return work;
+}
+
+// Computes the columns of (A * B) .* M one at a time for one unit of parallel work, into the positions of
+// the mask: sums[p] for the entry p of M and hit[p] telling whether any multiply-add reached it. The arrays
+// over the rows of A and over the rows of B are allocated on the first column that needs them and never
+// cleared, entries of older columns are told apart by a stamp as in ColumnAccumulator.
+template <typename T, typename Index>
+class MaskedColumn {
+ public:
+  MaskedColumn(std::size_t rows, std::size_t inner) : rows_(rows), inner_(inner) {}
+
+  // Gustavson over column j of B, dropping the multiply-adds that land on rows outside column j of M
+  template <typename M>
+  void Gather(const CcsView<T, Index> &a, const CcsView<T, Index> &b, const CcsView<M, Index> &mask, std::size_t j,
+              T *sums, unsigned char *hit) {
+    if (row_mark_.empty()) {
+      row_mark_.assign(rows_, 0);
+      row_slot_.resize(rows_);
+    }
+    ++row_stamp_;
+    for (std::size_t p = mask.Begin(j); p < mask.End(j); ++p) {
+      const auto i = static_cast<std::size_t>(mask.row_index[p]);
+      row_mark_[i] = row_stamp_;
+      row_slot_[i] = p;
+      sums[p] = T{};
+      hit[p] = 0;
+    }
+    for (std::size_t pb = b.Begin(j); pb < b.End(j); ++pb) {
+      const auto k = static_cast<std::size_t>(b.row_index[pb]);
+      for (std::size_t pa = a.Begin(k); pa < a.End(k); ++pa) {
+        const auto i = static_cast<std::size_t>(a.row_index[pa]);
+        if (row_mark_[i] == row_stamp_) {
+          sums[row_slot_[i]] += a.values[pa] * b.values[pb];
+          hit[row_slot_[i]] = 1;
+        }
+      }
+    }
+  }
+
+  // One dot product per entry of column j of M: column j of B is scattered by row, and the entries of row i
+  // of A are looked up in it for every row i of the mask
+  template <typename M>
+  void Dot(const CrsView<T, Index> &a_rows, const CcsView<T, Index> &b, const CcsView<M, Index> &mask,
+           std::size_t j, T *sums, unsigned char *hit) {
+    if (inner_mark_.empty()) {
+      inner_mark_.assign(inner_, 0);
+      inner_slot_.resize(inner_);
+    }
+    ++inner_stamp_;
+    for (std::size_t pb = b.Begin(j); pb < b.End(j); ++pb) {
+      const auto k = static_cast<std::size_t>(b.row_index[pb]);
+      inner_mark_[k] = inner_stamp_;
+      inner_slot_[k] = pb;
+    }
+    for (std::size_t p = mask.Begin(j); p < mask.End(j); ++p) {
+      const auto i = static_cast<std::size_t>(mask.row_index[p]);
+      T sum{};
+      unsigned char any = 0;
+      for (std::size_t pa = a_rows.Begin(i); pa < a_rows.End(i); ++pa) {
+        const auto k = static_cast<std::size_t>(a_rows.col_index[pa]);
+        if (inner_mark_[k] == inner_stamp_) {
+          sum += a_rows.values[pa] * b.values[inner_slot_[k]];
+          any = 1;
+        }
+      }
+      sums[p] = sum;
+      hit[p] = any;
+    }
+  }
+
+ private:
+  std::size_t rows_;
+  std::size_t inner_;
+  std::vector<std::size_t> row_mark_;
+  std::vector<std::size_t> row_slot_;
+  std::size_t row_stamp_ = 0;
+  std::vector<std::size_t> inner_mark_;
+  std::vector<std::size_t> inner_slot_;
+  std::size_t inner_stamp_ = 0;
+};
+
+}  // namespace detail
+
+// C = (A * B) .* M for CCS matrices with a.cols == b.rows and a mask M of the shape of the product: only
+// the entries at the positions M stores are computed, whatever values M has there. C holds those of them
+// that some multiply-add reaches, in the order of M (canonical for a canonical M), and keeps explicit zeros
+// as SpGemm does. Every column goes whichever way reads fewer entries: Gustavson over column j of B with
+// the rows outside the mask dropped, or a dot product of a row of A with column j of B per entry of the
+// mask, which does not depend on how much of the product lies outside it. The dot products read A by rows,
+// which costs one transpose of A; for masks much sparser than the product, such as the lower triangle in
+// triangle counting, they skip most of the multiply-adds.
+template <typename T, typename Index, typename M, typename ParallelFor = SerialFor>
+void MaskedSpGemm(const CcsView<T, Index> &a, const CcsView<T, Index> &b, const CcsView<M, Index> &mask,
+                  CcsMatrix<T, Index> &c, const ParallelFor &parallel_for = {}) {
+  const std::size_t cols = b.cols;
+  c.rows = a.rows;
+  c.cols = cols;
+  const CrsMatrix<T, Index> a_rows = CcsToCrs(a, parallel_for);
+  const auto rows_view = a_rows.View();
+
+  std::vector<std::size_t> work(cols);
+  std::vector<unsigned char> dot(cols);
+  parallel_for((cols + kSpGemmColumnBlock - 1) / kSpGemmColumnBlock, [&](std::size_t block) {
+    const std::size_t end = std::min(cols, (block + 1) * kSpGemmColumnBlock);
+    for (std::size_t j = block * kSpGemmColumnBlock; j < end; ++j) {
+      const std::size_t gather = detail::GatherWork(a, b, mask, j);
+      const std::size_t dot_work = detail::DotWork(rows_view, b, mask, j);
+      dot[j] = dot_work < gather ? 1 : 0;
+      work[j] = std::min(gather, dot_work);
+    }
+  });
+  const std::vector<std::size_t> chunks = detail::WorkChunks(work, std::max(kSpGemmChunkWork, a.rows + a.cols));
+  const std::size_t chunk_count = chunks.size() - 1;
+
+  // The product at every position of the mask, then the positions some multiply-add reached
+  std::vector<T> sums(mask.Nnz());
+  std::vector<unsigned char> hit(mask.Nnz());
+  c.col_ptr.assign(cols + 1, Index{0});
+  parallel_for(chunk_count, [&](std::size_t chunk) {
+    detail::MaskedColumn<T, Index> column(a.rows, a.cols);
+    for (std::size_t j = chunks[chunk]; j < chunks[chunk + 1]; ++j) {
+      if (dot[j] != 0) {
+        column.Dot(rows_view, b, mask, j, sums.data(), hit.data());
+      } else {
+        column.Gather(a, b, mask, j, sums.data(), hit.data());
+      }
+      c.col_ptr[j + 1] = static_cast<Index>(std::count(hit.begin() + static_cast<std::ptrdiff_t>(mask.Begin(j)),
+                                                       hit.begin() + static_cast<std::ptrdiff_t>(mask.End(j)), 1));
+    }
+  });
+  detail::PrefixSum(c.col_ptr.data(), cols, parallel_for);
+
+  const auto nnz = static_cast<std::size_t>(c.col_ptr[cols]);
+  c.row_index.resize(nnz);
+  c.values.resize(nnz);
+  parallel_for(chunk_count, [&](std::size_t chunk) {
+    for (std::size_t j = chunks[chunk]; j < chunks[chunk + 1]; ++j) {
+      auto q = static_cast<std::size_t>(c.col_ptr[j]);
+      for (std::size_t p = mask.Begin(j); p < mask.End(j); ++p) {
+        if (hit[p] != 0) {
+          c.row_index[q] = mask.row_index[p];
+          c.values[q] = sums[p];
+          ++q;
+        }
+      }
+    }
+  });
+}
+
+// C = alpha * A + beta * C for CCS matrices of the same shape with the rows sorted within every column, as
+// SpGemm returns them: C gets the union of the entries of both, sorted, and keeps the ones that cancel out
+// as explicit zeros. With beta == 0 C is not read, as in BLAS, and the result has the entries of A only.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void Axpby(const T &alpha, const CcsView<T, Index> &a, const T &beta, CcsMatrix<T, Index> &c,
+           const ParallelFor &parallel_for = {}) {
+  const std::size_t cols = a.cols;
+  const std::size_t blocks = (cols + kSpGemmColumnBlock - 1) / kSpGemmColumnBlock;
+  CcsMatrix<T, Index> sum;
+  sum.rows = a.rows;
+  sum.cols = cols;
+  if (beta == T{}) {
+    sum.col_ptr.assign(a.col_ptr, a.col_ptr + cols + 1);
+    sum.row_index.assign(a.row_index, a.row_index + a.Nnz());
+    sum.values.resize(a.Nnz());
+    parallel_for(blocks, [&](std::size_t block) {
+      const std::size_t end = std::min(cols, (block + 1) * kSpGemmColumnBlock);
+      for (std::size_t p = a.Begin(block * kSpGemmColumnBlock); p < a.Begin(end); ++p) {
+        sum.values[p] = alpha * a.values[p];
+      }
+    });
+    c = std::move(sum);
+    return;
+  }
+
+  // merge(j, emit) calls emit(row, value) for the union of column j of both in order of rows
+  const auto old = c.View();
+  const auto merge = [&](std::size_t j, const auto &emit) {
+    std::size_t pa = a.Begin(j);
+    std::size_t pc = old.Begin(j);
+    while (pa < a.End(j) || pc < old.End(j)) {
+      if (pc == old.End(j) || (pa < a.End(j) && a.row_index[pa] < old.row_index[pc])) {
+        emit(a.row_index[pa], alpha * a.values[pa]);
+        ++pa;
+      } else if (pa == a.End(j) || old.row_index[pc] < a.row_index[pa]) {
+        emit(old.row_index[pc], beta * old.values[pc]);
+        ++pc;
+      } else {
+        emit(a.row_index[pa], (alpha * a.values[pa]) + (beta * old.values[pc]));
+        ++pa;
+        ++pc;
+      }
+    }
+  };
+  sum.col_ptr.assign(cols + 1, Index{0});
+  parallel_for(blocks, [&](std::size_t block) {
+    const std::size_t end = std::min(cols, (block + 1) * kSpGemmColumnBlock);
+    for (std::size_t j = block * kSpGemmColumnBlock; j < end; ++j) {
+      std::size_t count = 0;
+      merge(j, [&](Index, const T &) { ++count; });
+      sum.col_ptr[j + 1] = static_cast<Index>(count);
+    }
+  });
+  detail::PrefixSum(sum.col_ptr.data(), cols, parallel_for);
+  const auto nnz = static_cast<std::size_t>(sum.col_ptr[cols]);
+  sum.row_index.resize(nnz);
+  sum.values.resize(nnz);
+  parallel_for(blocks, [&](std::size_t block) {
+    const std::size_t end = std::min(cols, (block + 1) * kSpGemmColumnBlock);
+    for (std::size_t j = block * kSpGemmColumnBlock; j < end; ++j) {
+      auto q = static_cast<std::size_t>(sum.col_ptr[j]);
+      merge(j, [&](Index row, const T &value) {
+        sum.row_index[q] = row;
+        sum.values[q] = value;
+        ++q;
+      });
+    }
+  });
+  c = std::move(sum);
+}
+
+// C = alpha * A * B + beta * C: SpGemm with alpha applied as every entry of the product is stored, merged
+// into C by Axpby, so C must be as Axpby takes it
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpGemmAxpby(const T &alpha, const CcsView<T, Index> &a, const CcsView<T, Index> &b, const T &beta,
+                 CcsMatrix<T, Index> &c, const ParallelFor &parallel_for = {}) {
+  CcsMatrix<T, Index> product;
+  product.rows = a.rows;
+  product.cols = b.cols;
+  detail::SpGemmPasses<T>(
+      a, b, product.col_ptr, product.row_index,
+      [&](std::size_t pa, std::size_t pb) { return a.values[pa] * b.values[pb]; },
+      [&](std::size_t nnz) { product.values.resize(nnz); },
+      [&](std::size_t p, const T &value) { product.values[p] = alpha * value; }, parallel_for);
+  if (beta == T{}) {
+    c = std::move(product);
+    return;
+  }
+  Axpby(T{1}, product.View(), beta, c, parallel_for);
+}
+
+}  // namespace ppc::sparse
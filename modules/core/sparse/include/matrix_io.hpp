@@ -0,0 +1,307 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Bytes of a Matrix Market file parsed as one unit of work
+inline constexpr std::size_t kMatrixMarketChunkBytes = std::size_t{1} << 20;
+
+// A whole file, read-only: mapped into memory where the system has mmap, read into a buffer elsewhere.
+// Throws std::runtime_error if the file cannot be opened. The data stays where it is when the object
+// is moved, so views into it remain valid for as long as some owner of the mapping lives.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &path);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  [[nodiscard]] const std::byte *Data() const { return data_; }
+  [[nodiscard]] std::size_t Size() const { return size_; }
+  [[nodiscard]] std::string_view Text() const { return {reinterpret_cast<const char *>(data_), size_}; }
+
+ private:
+  const std::byte *data_ = nullptr;
+  std::size_t size_ = 0;
+  bool mapped_ = false;
+  std::vector<std::byte> buffer_;
+};
+
+enum class MatrixMarketField : std::uint8_t { kReal, kInteger, kComplex, kPattern };
+enum class MatrixMarketSymmetry : std::uint8_t { kGeneral, kSymmetric, kSkewSymmetric, kHermitian };
+
+struct MatrixMarketHeader {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::size_t entries = 0;  // entry lines in the file, before the symmetric ones are mirrored
+  MatrixMarketField field = MatrixMarketField::kReal;
+  MatrixMarketSymmetry symmetry = MatrixMarketSymmetry::kGeneral;
+};
+
+enum class SparseLayout : std::uint8_t { kCrs, kCcs };
+
+namespace detail {
+
+template <typename T>
+struct IsComplex : std::false_type {};
+
+template <typename T>
+struct IsComplex<std::complex<T>> : std::true_type {};
+
+// One entry line, 1-based as in the file; im is 0 and re 1 for fields without them
+struct MatrixMarketEntry {
+  std::uint64_t row = 0;
+  std::uint64_t col = 0;
+  double re = 0.0;
+  double im = 0.0;
+};
+
+enum class MatrixMarketLine : std::uint8_t { kEntry, kEnd, kMalformed };
+
+// Parses the banner and the size line of a coordinate Matrix Market file into header and returns the
+// offset of the line after the sizes; throws std::runtime_error on anything else
+std::size_t ParseMatrixMarketHeader(std::string_view text, MatrixMarketHeader &header);
+
+// Offsets of line starts from begin on that cut text into pieces of about chunk_bytes, both ends included
+std::vector<std::size_t> SplitLines(std::string_view text, std::size_t begin, std::size_t chunk_bytes);
+
+// Lines of text that are neither blank nor comments
+std::size_t CountMatrixMarketEntries(std::string_view text);
+
+// Reads the entry on the next line of text that is neither blank nor a comment and moves pos past it
+MatrixMarketLine NextMatrixMarketEntry(std::string_view text, std::size_t &pos, MatrixMarketField field,
+                                       MatrixMarketEntry &entry);
+
+template <typename T>
+T MatrixMarketValue(const MatrixMarketEntry &entry) {
+  if constexpr (IsComplex<T>::value) {
+    return {static_cast<typename T::value_type>(entry.re), static_cast<typename T::value_type>(entry.im)};
+  } else {
+    return static_cast<T>(entry.re);
+  }
+}
+
+// The value at (j, i) of a symmetric, skew-symmetric or Hermitian matrix with value at (i, j)
+template <typename T>
+T MirroredValue(const T &value, MatrixMarketSymmetry symmetry) {
+  if (symmetry == MatrixMarketSymmetry::kSkewSymmetric) {
+    return -value;
+  }
+  if constexpr (IsComplex<T>::value) {
+    if (symmetry == MatrixMarketSymmetry::kHermitian) {
+      return std::conj(value);
+    }
+  }
+  return value;
+}
+
+// What a binary file holds, checked against the types it is loaded as
+struct BinaryFormat {
+  SparseLayout layout = SparseLayout::kCrs;
+  std::uint8_t value_kind = 0;  // 0 integer, 1 real, 2 complex
+  std::uint8_t value_size = 0;
+  std::uint8_t index_signed = 0;
+  std::uint8_t index_size = 0;
+};
+
+template <typename T, typename Index>
+BinaryFormat BinaryFormatOf(SparseLayout layout) {
+  static_assert(std::is_trivially_copyable_v<T> && std::is_integral_v<Index>);
+  std::uint8_t kind = 0;
+  if constexpr (IsComplex<T>::value) {
+    kind = 2;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    kind = 1;
+  } else {
+    static_assert(std::is_integral_v<T>, "values are integers, reals or complex numbers");
+  }
+  return {.layout = layout,
+          .value_kind = kind,
+          .value_size = sizeof(T),
+          .index_signed = std::is_signed_v<Index> ? std::uint8_t{1} : std::uint8_t{0},
+          .index_size = sizeof(Index)};
+}
+
+// The arrays of a binary file in a mapping of it
+struct BinaryArrays {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const std::byte *ptr = nullptr;
+  const std::byte *index = nullptr;
+  const std::byte *values = nullptr;
+};
+
+// Checks the header of a binary file against format and the file size against the arrays it
+// announces; throws std::runtime_error if they do not match
+BinaryArrays MapBinary(const MappedFile &file, const BinaryFormat &format);
+
+void WriteBinary(const std::string &path, const BinaryFormat &format, std::size_t rows, std::size_t cols,
+                 const void *ptr, const void *index, const void *values, std::size_t nnz);
+
+}  // namespace detail
+
+// Reads a coordinate Matrix Market file: real, integer, complex (into complex T only) or pattern
+// entries, the latter valued 1, with the general, symmetric, skew-symmetric or Hermitian symmetry, the
+// entries of the stored triangle mirrored into the other. The file is mapped and its lines parsed in
+// chunks of kMatrixMarketChunkBytes in parallel; the entries keep the order of the file, mirrored ones
+// after the stored ones. Throws std::runtime_error on a malformed file or indices out of the range of Index.
+template <typename T, typename Index = int, typename ParallelFor = SerialFor>
+CooMatrix<T, Index> ReadMatrixMarket(const std::string &path, const ParallelFor &parallel_for = {}) {
+  const MappedFile file(path);
+  const std::string_view text = file.Text();
+  MatrixMarketHeader header;
+  const std::size_t body = detail::ParseMatrixMarketHeader(text, header);
+  if (header.field == MatrixMarketField::kComplex && !detail::IsComplex<T>::value) {
+    throw std::runtime_error(path + ": complex entries need a complex value type");
+  }
+  if (header.rows > static_cast<std::size_t>(std::numeric_limits<Index>::max()) ||
+      header.cols > static_cast<std::size_t>(std::numeric_limits<Index>::max())) {
+    throw std::runtime_error(path + ": the matrix is too large for its index type");
+  }
+
+  // First entry of every chunk, from the number of entry lines in it
+  const std::vector<std::size_t> bounds = detail::SplitLines(text, body, kMatrixMarketChunkBytes);
+  const std::size_t chunks = bounds.size() - 1;
+  std::vector<std::size_t> first(chunks + 1, 0);
+  parallel_for(chunks, [&](std::size_t c) {
+    first[c + 1] = detail::CountMatrixMarketEntries(text.substr(bounds[c], bounds[c + 1] - bounds[c]));
+  });
+  for (std::size_t c = 0; c < chunks; ++c) {
+    first[c + 1] += first[c];
+  }
+  if (first[chunks] != header.entries) {
+    throw std::runtime_error(path + ": " + std::to_string(header.entries) + " entries announced, " +
+                             std::to_string(first[chunks]) + " found");
+  }
+
+  CooMatrix<T, Index> result;
+  result.rows = header.rows;
+  result.cols = header.cols;
+  result.row.resize(header.entries);
+  result.col.resize(header.entries);
+  result.values.resize(header.entries);
+  // The loop bodies cannot throw; the chunks report malformed lines and their off-diagonal entries
+  std::vector<char> malformed(chunks, 0);
+  std::vector<std::size_t> mirrored(chunks + 1, 0);
+  parallel_for(chunks, [&](std::size_t c) {
+    const std::string_view chunk = text.substr(bounds[c], bounds[c + 1] - bounds[c]);
+    std::size_t pos = 0;
+    detail::MatrixMarketEntry entry;
+    for (std::size_t p = first[c]; p < first[c + 1]; ++p) {
+      if (detail::NextMatrixMarketEntry(chunk, pos, header.field, entry) != detail::MatrixMarketLine::kEntry ||
+          entry.row == 0 || entry.row > header.rows || entry.col == 0 || entry.col > header.cols) {
+        malformed[c] = 1;
+        return;
+      }
+      result.row[p] = static_cast<Index>(entry.row - 1);
+      result.col[p] = static_cast<Index>(entry.col - 1);
+      result.values[p] = detail::MatrixMarketValue<T>(entry);
+      mirrored[c + 1] += entry.row != entry.col ? 1 : 0;
+    }
+  });
+  for (std::size_t c = 0; c < chunks; ++c) {
+    if (malformed[c] != 0) {
+      throw std::runtime_error(path + ": malformed entry after byte " + std::to_string(bounds[c]));
+    }
+  }
+  if (header.symmetry == MatrixMarketSymmetry::kGeneral) {
+    return result;
+  }
+
+  for (std::size_t c = 0; c < chunks; ++c) {
+    mirrored[c + 1] += mirrored[c];
+  }
+  const std::size_t total = header.entries + mirrored[chunks];
+  result.row.resize(total);
+  result.col.resize(total);
+  result.values.resize(total);
+  parallel_for(chunks, [&](std::size_t c) {
+    std::size_t q = header.entries + mirrored[c];
+    for (std::size_t p = first[c]; p < first[c + 1]; ++p) {
+      if (result.row[p] != result.col[p]) {
+        result.row[q] = result.col[p];
+        result.col[q] = result.row[p];
+        result.values[q] = detail::MirroredValue(result.values[p], header.symmetry);
+        ++q;
+      }
+    }
+  });
+  return result;
+}
+
+// Native binary files of compressed matrices, laid out so that a mapping of the file is the arrays: a
+// 64-byte header with the layout, the value and index types, the sizes and the byte order, then the
+// pointer, index and value arrays, each at an offset that is a multiple of 64. They are only read on
+// machines with the byte order and types they were written with.
+template <typename T, typename Index>
+void WriteBinary(const std::string &path, const CrsView<T, Index> &a) {
+  detail::WriteBinary(path, detail::BinaryFormatOf<T, Index>(SparseLayout::kCrs), a.rows, a.cols, a.row_ptr,
+                      a.col_index, a.values, a.Nnz());
+}
+
+template <typename T, typename Index>
+void WriteBinary(const std::string &path, const CcsView<T, Index> &a) {
+  detail::WriteBinary(path, detail::BinaryFormatOf<T, Index>(SparseLayout::kCcs), a.rows, a.cols, a.col_ptr,
+                      a.row_index, a.values, a.Nnz());
+}
+
+// A binary CRS file mapped into memory, its view pointing into the mapping: nothing is parsed or copied,
+// and pages are only read from disk as the view touches them. Throws std::runtime_error if the file is
+// not a CRS matrix of T and Index.
+template <typename T, typename Index = int>
+class MappedCrsMatrix {
+ public:
+  explicit MappedCrsMatrix(const std::string &path) : file_(path) {
+    const detail::BinaryArrays arrays =
+        detail::MapBinary(file_, detail::BinaryFormatOf<T, Index>(SparseLayout::kCrs));
+    view_ = {.rows = arrays.rows,
+             .cols = arrays.cols,
+             .row_ptr = reinterpret_cast<const Index *>(arrays.ptr),
+             .col_index = reinterpret_cast<const Index *>(arrays.index),
+             .values = reinterpret_cast<const T *>(arrays.values)};
+  }
+
+  [[nodiscard]] CrsView<T, Index> View() const { return view_; }
+
+ private:
+  MappedFile file_;
+  CrsView<T, Index> view_;
+};
+
+template <typename T, typename Index = int>
+class MappedCcsMatrix {
+ public:
+  explicit MappedCcsMatrix(const std::string &path) : file_(path) {
+    const detail::BinaryArrays arrays =
+        detail::MapBinary(file_, detail::BinaryFormatOf<T, Index>(SparseLayout::kCcs));
+    view_ = {.rows = arrays.rows,
+             .cols = arrays.cols,
+             .col_ptr = reinterpret_cast<const Index *>(arrays.ptr),
+             .row_index = reinterpret_cast<const Index *>(arrays.index),
+             .values = reinterpret_cast<const T *>(arrays.values)};
+  }
+
+  [[nodiscard]] CcsView<T, Index> View() const { return view_; }
+
+ private:
+  MappedFile file_;
+  CcsView<T, Index> view_;
+};
+
+}  // namespace ppc::sparse
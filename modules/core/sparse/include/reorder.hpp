@@ -0,0 +1,276 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Orderings of the rows (and, for square matrices, the columns) of a sparse matrix that bring the
+// entries a product reads together closer in memory. A permutation perm lists the old positions in
+// their new order: new row i is old row perm[i].
+enum class Reordering {
+  kNone,
+  // Rows by increasing number of entries, equal ones in their old order
+  kDegree,
+  // Reverse Cuthill-McKee on the pattern of A + A^T: breadth-first from a peripheral row, which
+  // gathers the entries of a square matrix with a mesh-like pattern in a narrow band around the diagonal
+  kReverseCuthillMcKee,
+};
+
+template <typename Index>
+std::vector<Index> InversePermutation(const std::vector<Index> &perm) {
+  std::vector<Index> inverse(perm.size());
+  for (std::size_t i = 0; i < perm.size(); ++i) {
+    inverse[static_cast<std::size_t>(perm[i])] = static_cast<Index>(i);
+  }
+  return inverse;
+}
+
+namespace detail {
+
+// Positions 0 .. degree.size() - 1 stably sorted by degree
+template <typename Index>
+std::vector<Index> OrderByDegree(const std::vector<std::size_t> &degree) {
+  const std::size_t keys = degree.empty() ? 1 : *std::ranges::max_element(degree) + 1;
+  std::vector<Index> ptr(keys + 1);
+  std::vector<std::size_t> order(degree.size());
+  CountingSort(degree.size(), keys, [&](std::size_t i) { return degree[i]; }, ptr.data(), order.data(),
+               SerialFor{});
+  return {order.begin(), order.end()};
+}
+
+// Undirected graph of the pattern of a square CRS matrix and its transpose: the neighbours of v are in
+// row v of both, the diagonal and repeats included, which the search skips as already visited
+template <typename T, typename Index>
+class SymmetricPattern {
+ public:
+  explicit SymmetricPattern(const CrsView<T, Index> &a) : a_(a), columns_(CrsToCcs(a)), degree_(a.rows) {
+    for (std::size_t v = 0; v < a.rows; ++v) {
+      degree_[v] = (a_.End(v) - a_.Begin(v)) + (columns_.View().End(v) - columns_.View().Begin(v));
+    }
+  }
+
+  [[nodiscard]] const std::vector<std::size_t> &Degrees() const { return degree_; }
+
+  template <typename F>
+  void ForEachNeighbour(std::size_t v, const F &f) const {
+    for (std::size_t p = a_.Begin(v); p < a_.End(v); ++p) {
+      f(static_cast<std::size_t>(a_.col_index[p]));
+    }
+    const CcsView<T, Index> columns = columns_.View();
+    for (std::size_t p = columns.Begin(v); p < columns.End(v); ++p) {
+      f(static_cast<std::size_t>(columns.row_index[p]));
+    }
+  }
+
+ private:
+  CrsView<T, Index> a_;
+  CcsMatrix<T, Index> columns_;
+  std::vector<std::size_t> degree_;
+};
+
+// Levels of a breadth-first search and where in its order the last of them begins
+struct SearchLevels {
+  std::size_t count = 0;
+  std::size_t last_begin = 0;
+};
+
+// Breadth-first search of the component of start, appending its vertices to order level by level and
+// the new vertices found from each vertex by increasing degree (Cuthill-McKee). The vertices it reaches
+// get mark stamp, which has to be new, so that every search of a component sees all of it unvisited.
+template <typename T, typename Index>
+SearchLevels CuthillMcKee(const SymmetricPattern<T, Index> &graph, std::size_t start, std::vector<Index> &order,
+                          std::vector<std::size_t> &mark, std::size_t stamp) {
+  const std::vector<std::size_t> &degree = graph.Degrees();
+  std::size_t head = order.size();
+  SearchLevels levels{.count = 1, .last_begin = head};
+  std::size_t level_end = head + 1;
+  order.push_back(static_cast<Index>(start));
+  mark[start] = stamp;
+  std::vector<std::size_t> found;
+  while (head < order.size()) {
+    if (head == level_end) {
+      ++levels.count;
+      levels.last_begin = level_end;
+      level_end = order.size();
+    }
+    const auto v = static_cast<std::size_t>(order[head++]);
+    found.clear();
+    graph.ForEachNeighbour(v, [&](std::size_t w) {
+      if (mark[w] != stamp) {
+        mark[w] = stamp;
+        found.push_back(w);
+      }
+    });
+    std::ranges::stable_sort(found, [&](std::size_t x, std::size_t y) { return degree[x] < degree[y]; });
+    for (const std::size_t w : found) {
+      order.push_back(static_cast<Index>(w));
+    }
+  }
+  return levels;
+}
+
+// A start vertex far from the rest of its component (George and Liu): from start, move to the vertex of
+// least degree in the last level of the search for as long as that makes the search deeper
+template <typename T, typename Index>
+std::size_t PeripheralVertex(const SymmetricPattern<T, Index> &graph, std::size_t start,
+                             std::vector<std::size_t> &mark, std::size_t &stamp) {
+  const std::vector<std::size_t> &degree = graph.Degrees();
+  std::vector<Index> order;
+  std::size_t depth = 0;
+  for (;;) {
+    order.clear();
+    const SearchLevels levels = CuthillMcKee(graph, start, order, mark, ++stamp);
+    if (levels.count <= depth) {
+      return start;
+    }
+    depth = levels.count;
+    std::size_t next = static_cast<std::size_t>(order[levels.last_begin]);
+    for (std::size_t p = levels.last_begin; p < order.size(); ++p) {
+      const auto v = static_cast<std::size_t>(order[p]);
+      if (degree[v] < degree[next]) {
+        next = v;
+      }
+    }
+    if (next == start) {
+      return start;
+    }
+    start = next;
+  }
+}
+
+}  // namespace detail
+
+// Rows of a by increasing number of entries, as a permutation
+template <typename T, typename Index>
+std::vector<Index> DegreeOrder(const CrsView<T, Index> &a) {
+  std::vector<std::size_t> degree(a.rows);
+  for (std::size_t i = 0; i < a.rows; ++i) {
+    degree[i] = a.End(i) - a.Begin(i);
+  }
+  return detail::OrderByDegree<Index>(degree);
+}
+
+template <typename T, typename Index>
+std::vector<Index> DegreeOrder(const CcsView<T, Index> &a) {
+  std::vector<std::size_t> degree(a.rows);
+  for (std::size_t p = 0; p < a.Nnz(); ++p) {
+    ++degree[static_cast<std::size_t>(a.row_index[p])];
+  }
+  return detail::OrderByDegree<Index>(degree);
+}
+
+// Reverse Cuthill-McKee permutation of a square matrix, one component after another, each from a
+// peripheral vertex of it; rows and columns permuted by it together keep their entries near the diagonal
+template <typename T, typename Index>
+std::vector<Index> ReverseCuthillMcKee(const CrsView<T, Index> &a) {
+  const detail::SymmetricPattern<T, Index> graph(a);
+  std::vector<Index> order;
+  order.reserve(a.rows);
+  // Stamps of the searches, 0 for the components not yet ordered
+  std::vector<std::size_t> mark(a.rows, 0);
+  std::size_t stamp = 0;
+  // Components are started from their vertex of least degree, refined to a peripheral one
+  for (const Index candidate : detail::OrderByDegree<Index>(graph.Degrees())) {
+    if (mark[static_cast<std::size_t>(candidate)] == 0) {
+      const std::size_t start = detail::PeripheralVertex(graph, static_cast<std::size_t>(candidate), mark, stamp);
+      detail::CuthillMcKee(graph, start, order, mark, ++stamp);
+    }
+  }
+  std::ranges::reverse(order);
+  return order;
+}
+
+// The pattern of A + A^T is that of its transpose, so the CCS arrays read as CRS give the same order
+template <typename T, typename Index>
+std::vector<Index> ReverseCuthillMcKee(const CcsView<T, Index> &a) {
+  return ReverseCuthillMcKee(TransposedView(a));
+}
+
+// Permutation of the rows of a for reordering, empty for kNone; kReverseCuthillMcKee needs a square a
+template <typename View>
+auto Reorder(const View &a, Reordering reordering) -> decltype(DegreeOrder(a)) {
+  switch (reordering) {
+    case Reordering::kDegree:
+      return DegreeOrder(a);
+    case Reordering::kReverseCuthillMcKee:
+      return ReverseCuthillMcKee(a);
+    case Reordering::kNone:
+      break;
+  }
+  return {};
+}
+
+// The matrix with new row i = old row row_perm[i] and new column j = old column col_perm[j]; an empty
+// permutation leaves that dimension as it is. A canonical a gives a canonical result.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CrsMatrix<T, Index> Permute(const CrsView<T, Index> &a, const std::vector<Index> &row_perm,
+                            const std::vector<Index> &col_perm, const ParallelFor &parallel_for = {}) {
+  auto old_row = [&](std::size_t i) { return row_perm.empty() ? i : static_cast<std::size_t>(row_perm[i]); };
+  CrsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  result.row_ptr.assign(a.rows + 1, Index{0});
+  const linalg::BlockTiling rows(a.rows, kSparseKeyBlock);
+  parallel_for(rows.Count(), [&](std::size_t b) {
+    for (std::size_t i = rows.Begin(b); i < rows.Begin(b) + rows.Size(b); ++i) {
+      result.row_ptr[i + 1] = static_cast<Index>(a.End(old_row(i)) - a.Begin(old_row(i)));
+    }
+  });
+  detail::PrefixSum(result.row_ptr.data(), a.rows, parallel_for);
+  result.col_index.resize(a.Nnz());
+  result.values.resize(a.Nnz());
+  const std::vector<Index> new_col = InversePermutation(col_perm);
+  parallel_for(rows.Count(), [&](std::size_t b) {
+    for (std::size_t i = rows.Begin(b); i < rows.Begin(b) + rows.Size(b); ++i) {
+      auto q = static_cast<std::size_t>(result.row_ptr[i]);
+      for (std::size_t p = a.Begin(old_row(i)); p < a.End(old_row(i)); ++p, ++q) {
+        result.col_index[q] = new_col.empty() ? a.col_index[p] : new_col[static_cast<std::size_t>(a.col_index[p])];
+        result.values[q] = a.values[p];
+      }
+    }
+  });
+  if (col_perm.empty()) {
+    return result;
+  }
+  // The new column labels break the order within the rows; the transposes are stable and put it back
+  return CcsToCrs(CrsToCcs(result.View(), parallel_for).View(), parallel_for);
+}
+
+// Permute for CCS matrices: the CRS arrays of A^T permuted the other way round are those of the result
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+CcsMatrix<T, Index> Permute(const CcsView<T, Index> &a, const std::vector<Index> &row_perm,
+                            const std::vector<Index> &col_perm, const ParallelFor &parallel_for = {}) {
+  CrsMatrix<T, Index> transposed = Permute(TransposedView(a), col_perm, row_perm, parallel_for);
+  CcsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  result.col_ptr = std::move(transposed.row_ptr);
+  result.row_index = std::move(transposed.col_index);
+  result.values = std::move(transposed.values);
+  return result;
+}
+
+// Largest distance of an entry from the diagonal, what Reverse Cuthill-McKee reduces
+template <typename T, typename Index>
+std::size_t Bandwidth(const CrsView<T, Index> &a) {
+  std::size_t bandwidth = 0;
+  for (std::size_t i = 0; i < a.rows; ++i) {
+    for (std::size_t p = a.Begin(i); p < a.End(i); ++p) {
+      const auto j = static_cast<std::size_t>(a.col_index[p]);
+      bandwidth = std::max(bandwidth, i > j ? i - j : j - i);
+    }
+  }
+  return bandwidth;
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::sparse {
+
+// Sparse matrices of values T with indices of type Index, usually int or std::int64_t. The views
+// only point at arrays, which may belong to one of the containers below or to a task, and are
+// passed by value; the containers own their arrays and hand out views of them.
+
+// Compressed sparse columns: the rows of column j are row_index[col_ptr[j]] .. row_index[col_ptr[j + 1] - 1]
+// with their values alongside. The same arrays read as compressed rows describe the transpose.
+template <typename T, typename Index = int>
+struct CcsView {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const Index *col_ptr = nullptr;
+  const Index *row_index = nullptr;
+  const T *values = nullptr;
+
+  [[nodiscard]] std::size_t Begin(std::size_t col) const { return static_cast<std::size_t>(col_ptr[col]); }
+  [[nodiscard]] std::size_t End(std::size_t col) const { return static_cast<std::size_t>(col_ptr[col + 1]); }
+  [[nodiscard]] std::size_t Nnz() const { return static_cast<std::size_t>(col_ptr[cols]); }
+};
+
+// Compressed sparse rows, the same as CcsView with rows and columns swapped
+template <typename T, typename Index = int>
+struct CrsView {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const Index *row_ptr = nullptr;
+  const Index *col_index = nullptr;
+  const T *values = nullptr;
+
+  [[nodiscard]] std::size_t Begin(std::size_t row) const { return static_cast<std::size_t>(row_ptr[row]); }
+  [[nodiscard]] std::size_t End(std::size_t row) const { return static_cast<std::size_t>(row_ptr[row + 1]); }
+  [[nodiscard]] std::size_t Nnz() const { return static_cast<std::size_t>(row_ptr[rows]); }
+};
+
+// Block sparse rows: the matrix is cut into block x block tiles and the tiles with any nonzero are
+// stored whole, row-major, one after another in values. They are indexed like the entries of a CRS
+// matrix of tiles: the tiles of block row i are in columns block_col_index[block_row_ptr[i]] .. and tile
+// p starts at values[p * block * block]. Tiles on the bottom and right edges are padded with zeros.
+template <typename T, typename Index = int>
+struct BsrView {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::size_t block = 1;
+  const Index *block_row_ptr = nullptr;
+  const Index *block_col_index = nullptr;
+  const T *values = nullptr;
+
+  [[nodiscard]] std::size_t BlockRows() const { return (rows + block - 1) / block; }
+  [[nodiscard]] std::size_t BlockCols() const { return (cols + block - 1) / block; }
+  [[nodiscard]] std::size_t Begin(std::size_t block_row) const {
+    return static_cast<std::size_t>(block_row_ptr[block_row]);
+  }
+  [[nodiscard]] std::size_t End(std::size_t block_row) const {
+    return static_cast<std::size_t>(block_row_ptr[block_row + 1]);
+  }
+  [[nodiscard]] std::size_t Blocks() const { return static_cast<std::size_t>(block_row_ptr[BlockRows()]); }
+  [[nodiscard]] const T *Tile(std::size_t p) const { return values + (p * block * block); }
+};
+
+template <typename T, typename Index = int>
+struct CcsMatrix {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<Index> col_ptr;
+  std::vector<Index> row_index;
+  std::vector<T> values;
+
+  [[nodiscard]] CcsView<T, Index> View() const {
+    return {.rows = rows,
+            .cols = cols,
+            .col_ptr = col_ptr.data(),
+            .row_index = row_index.data(),
+            .values = values.data()};
+  }
+};
+
+template <typename T, typename Index = int>
+struct CrsMatrix {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<Index> row_ptr;
+  std::vector<Index> col_index;
+  std::vector<T> values;
+
+  [[nodiscard]] CrsView<T, Index> View() const {
+    return {.rows = rows,
+            .cols = cols,
+            .row_ptr = row_ptr.data(),
+            .col_index = col_index.data(),
+            .values = values.data()};
+  }
+};
+
+template <typename T, typename Index = int>
+struct BsrMatrix {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::size_t block = 1;
+  std::vector<Index> block_row_ptr;
+  std::vector<Index> block_col_index;
+  std::vector<T> values;
+
+  [[nodiscard]] BsrView<T, Index> View() const {
+    return {.rows = rows,
+            .cols = cols,
+            .block = block,
+            .block_row_ptr = block_row_ptr.data(),
+            .block_col_index = block_col_index.data(),
+            .values = values.data()};
+  }
+};
+
+// Coordinate list: values[p] is at (row[p], col[p]). The entries may come in any order and the same
+// position may repeat, in which case the values add up.
+template <typename T, typename Index = int>
+struct CooMatrix {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<Index> row;
+  std::vector<Index> col;
+  std::vector<T> values;
+};
+
+// The CRS arrays of A read as CCS are A^T and the other way round; nothing is copied
+template <typename T, typename Index>
+CcsView<T, Index> TransposedView(const CrsView<T, Index> &a) {
+  return {.rows = a.cols, .cols = a.rows, .col_ptr = a.row_ptr, .row_index = a.col_index, .values = a.values};
+}
+
+template <typename T, typename Index>
+CrsView<T, Index> TransposedView(const CcsView<T, Index> &a) {
+  return {.rows = a.cols, .cols = a.rows, .row_ptr = a.col_ptr, .col_index = a.row_index, .values = a.values};
+}
+
+namespace detail {
+
+template <typename Index>
+bool InRange(Index i, std::size_t size) {
+  if constexpr (std::is_signed_v<Index>) {
+    if (i < Index{0}) {
+      return false;
+    }
+  }
+  return static_cast<std::size_t>(i) < size;
+}
+
+// Compressed arrays along outer slices of inner entries each: ptr starts at 0 and does not decrease,
+// every index is below inner and, if canonical, the indices of each slice increase. The whole of ptr is
+// checked before any index is read, so that no slice reaches past ptr[outer].
+template <typename Index>
+bool IsValidCompressed(std::size_t outer, std::size_t inner, const Index *ptr, const Index *index, bool canonical) {
+  if (ptr == nullptr || ptr[0] != Index{0}) {
+    return false;
+  }
+  for (std::size_t o = 0; o < outer; ++o) {
+    if (ptr[o + 1] < ptr[o]) {
+      return false;
+    }
+  }
+  for (std::size_t o = 0; o < outer; ++o) {
+    const auto begin = static_cast<std::size_t>(ptr[o]);
+    for (std::size_t p = begin; p < static_cast<std::size_t>(ptr[o + 1]); ++p) {
+      if (!InRange(index[p], inner) || (canonical && p > begin && index[p] <= index[p - 1])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace detail
+
+// Whether the arrays of a view describe a matrix of its size. Canonical ones also have the indices of
+// each column (row, block row) in increasing order, so no position twice; SpGemm and the conversions
+// produce canonical matrices and accept any valid ones.
+template <typename T, typename Index>
+bool IsValid(const CcsView<T, Index> &a, bool canonical = false) {
+  return detail::IsValidCompressed(a.cols, a.rows, a.col_ptr, a.row_index, canonical);
+}
+
+template <typename T, typename Index>
+bool IsValid(const CrsView<T, Index> &a, bool canonical = false) {
+  return detail::IsValidCompressed(a.rows, a.cols, a.row_ptr, a.col_index, canonical);
+}
+
+template <typename T, typename Index>
+bool IsValid(const BsrView<T, Index> &a, bool canonical = false) {
+  return a.block > 0 &&
+         detail::IsValidCompressed(a.BlockRows(), a.BlockCols(), a.block_row_ptr, a.block_col_index, canonical);
+}
+
+// The containers also have to hold arrays of the sizes the pointers promise, which is checked before the
+// view walks them
+template <typename T, typename Index>
+bool IsValid(const CcsMatrix<T, Index> &a, bool canonical = false) {
+  return a.col_ptr.size() == a.cols + 1 && static_cast<std::size_t>(a.col_ptr.back()) == a.row_index.size() &&
+         a.values.size() == a.row_index.size() && IsValid(a.View(), canonical);
+}
+
+template <typename T, typename Index>
+bool IsValid(const CrsMatrix<T, Index> &a, bool canonical = false) {
+  return a.row_ptr.size() == a.rows + 1 && static_cast<std::size_t>(a.row_ptr.back()) == a.col_index.size() &&
+         a.values.size() == a.col_index.size() && IsValid(a.View(), canonical);
+}
+
+template <typename T, typename Index>
+bool IsValid(const BsrMatrix<T, Index> &a, bool canonical = false) {
+  return a.block > 0 && a.block_row_ptr.size() == a.View().BlockRows() + 1 &&
+         static_cast<std::size_t>(a.block_row_ptr.back()) == a.block_col_index.size() &&
+         a.values.size() == a.block_col_index.size() * a.block * a.block && IsValid(a.View(), canonical);
+}
+
+template <typename T, typename Index>
+bool IsValid(const CooMatrix<T, Index> &a) {
+  if (a.row.size() != a.values.size() || a.col.size() != a.values.size()) {
+    return false;
+  }
+  for (std::size_t p = 0; p < a.values.size(); ++p) {
+    if (!detail::InRange(a.row[p], a.rows) || !detail::InRange(a.col[p], a.cols)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Multiply-adds in one unit of parallel work of SpGemm; a unit also does at least as many as C has
+// rows, so that the dense accumulator it may allocate is paid for
+inline constexpr std::size_t kSpGemmChunkWork = std::size_t{1} << 14;
+
+// A column of C whose multiply-adds times this reach the number of rows of C is accumulated in a dense
+// array indexed by row; sparser columns go to a hash table of about twice their multiply-adds
+inline constexpr std::size_t kSpGemmDenseRatio = 16;
+
+// Columns whose multiply-adds are counted by one body
+inline constexpr std::size_t kSpGemmColumnBlock = 1024;
+
+namespace detail {
+
+// Multiply-adds of column j of A * B: the entries of the columns of A that column j of B selects
+template <typename U, typename Index>
+std::size_t ColumnWork(const CcsView<U, Index> &a, const CcsView<U, Index> &b, std::size_t j) {
+  std::size_t work = 0;
+  for (std::size_t p = b.Begin(j); p < b.End(j); ++p) {
+    const auto k = static_cast<std::size_t>(b.row_index[p]);
+    work += a.End(k) - a.Begin(k);
+  }
+  return work;
+}
+
+// Accumulates the columns of A * B one at a time for one unit of parallel work. Each column goes to a
+// dense array or to a hash table depending on its multiply-adds; the dense array is allocated on the
+// first column that needs it and is never cleared, entries of older columns are told apart by a stamp.
+// The sums are of type T; only the structure of the views is read, the values come from product.
+template <typename T, typename Index>
+class ColumnAccumulator {
+ public:
+  explicit ColumnAccumulator(std::size_t rows) : rows_(rows) {}
+
+  // Number of distinct rows in column j of A * B, work being its ColumnWork
+  template <typename U>
+  std::size_t Count(const CcsView<U, Index> &a, const CcsView<U, Index> &b, std::size_t j, std::size_t work) {
+    std::size_t count = 0;
+    if (IsDense(work)) {
+      NextDenseColumn();
+      ForEachRow(a, b, j, [&](std::size_t i, std::size_t, std::size_t) {
+        if (mark_[i] != stamp_) {
+          mark_[i] = stamp_;
+          ++count;
+        }
+      });
+    } else {
+      ResetTable(work);
+      ForEachRow(a, b, j, [&](std::size_t i, std::size_t, std::size_t) {
+        const std::size_t slot = Slot(i);
+        if (keys_[slot] == kEmpty) {
+          keys_[slot] = i;
+          ++count;
+        }
+      });
+    }
+    return count;
+  }
+
+  // Writes column j of A * B to rows and store(r, value), as many entries as Count returned, in order of
+  // rows; product(pa, pb) is the product of the entries of A and B at those positions
+  template <typename U, typename Product, typename Store>
+  void Multiply(const CcsView<U, Index> &a, const CcsView<U, Index> &b, std::size_t j, std::size_t work,
+                const Product &product_of, Index *rows, const Store &store) {
+    if (IsDense(work)) {
+      NextDenseColumn();
+      touched_.clear();
+      ForEachRow(a, b, j, [&](std::size_t i, std::size_t pa, std::size_t pb) {
+        const T product = product_of(pa, pb);
+        if (mark_[i] != stamp_) {
+          mark_[i] = stamp_;
+          dense_[i] = product;
+          touched_.push_back(i);
+        } else {
+          dense_[i] += product;
+        }
+      });
+      // A column that fills a good part of the rows is cheaper to read back in order than to sort
+      if (touched_.size() * kSpGemmDenseRatio >= rows_) {
+        touched_.clear();
+        for (std::size_t i = 0; i < rows_; ++i) {
+          if (mark_[i] == stamp_) {
+            touched_.push_back(i);
+          }
+        }
+      } else {
+        std::ranges::sort(touched_);
+      }
+      for (std::size_t r = 0; r < touched_.size(); ++r) {
+        rows[r] = static_cast<Index>(touched_[r]);
+        store(r, dense_[touched_[r]]);
+      }
+      return;
+    }
+    ResetTable(work);
+    ForEachRow(a, b, j, [&](std::size_t i, std::size_t pa, std::size_t pb) {
+      const T product = product_of(pa, pb);
+      const std::size_t slot = Slot(i);
+      if (keys_[slot] == kEmpty) {
+        keys_[slot] = i;
+        table_[slot] = product;
+      } else {
+        table_[slot] += product;
+      }
+    });
+    touched_.clear();
+    for (const std::size_t key : keys_) {
+      if (key != kEmpty) {
+        touched_.push_back(key);
+      }
+    }
+    std::ranges::sort(touched_);
+    for (std::size_t r = 0; r < touched_.size(); ++r) {
+      rows[r] = static_cast<Index>(touched_[r]);
+      store(r, table_[Slot(touched_[r])]);
+    }
+  }
+
+ private:
+  static constexpr std::size_t kEmpty = std::numeric_limits<std::size_t>::max();
+
+  [[nodiscard]] bool IsDense(std::size_t work) const { return work * kSpGemmDenseRatio >= rows_; }
+
+  // f(row of A, position in A, position in B) for every multiply-add of column j
+  template <typename U, typename F>
+  static void ForEachRow(const CcsView<U, Index> &a, const CcsView<U, Index> &b, std::size_t j, const F &f) {
+    for (std::size_t pb = b.Begin(j); pb < b.End(j); ++pb) {
+      const auto k = static_cast<std::size_t>(b.row_index[pb]);
+      for (std::size_t pa = a.Begin(k); pa < a.End(k); ++pa) {
+        f(static_cast<std::size_t>(a.row_index[pa]), pa, pb);
+      }
+    }
+  }
+
+  void NextDenseColumn() {
+    if (mark_.empty()) {
+      mark_.assign(rows_, 0);
+      dense_.resize(rows_);
+    }
+    ++stamp_;
+  }
+
+  // Empty table of a power of two slots, at least twice the entries the column may have
+  void ResetTable(std::size_t work) {
+    const std::size_t size = std::bit_ceil(std::max<std::size_t>(2 * work, 2));
+    keys_.assign(size, kEmpty);
+    if (table_.size() < size) {
+      table_.resize(size);
+    }
+    mask_ = size - 1;
+  }
+
+  // Slot of row i: the one holding it, or the empty one where it goes (linear probing)
+  [[nodiscard]] std::size_t Slot(std::size_t i) const {
+    std::size_t slot = (i * 107) & mask_;
+    while (keys_[slot] != kEmpty && keys_[slot] != i) {
+      slot = (slot + 1) & mask_;
+    }
+    return slot;
+  }
+
+  std::size_t rows_;
+  std::vector<std::size_t> mark_;
+  std::vector<T> dense_;
+  std::size_t stamp_ = 0;
+  std::vector<std::size_t> keys_;
+  std::vector<T> table_;
+  std::size_t mask_ = 0;
+  std::vector<std::size_t> touched_;
+};
+
+// Splits the columns into runs of consecutive ones of about chunk_work in total, work[j] being that of
+// column j, and returns where every run starts followed by the number of columns
+inline std::vector<std::size_t> WorkChunks(const std::vector<std::size_t> &work, std::size_t chunk_work) {
+  std::vector<std::size_t> chunks{0};
+  std::size_t run = 0;
+  for (std::size_t j = 0; j < work.size(); ++j) {
+    run += work[j] + 1;
+    if (run >= chunk_work || j + 1 == work.size()) {
+      chunks.push_back(j + 1);
+      run = 0;
+    }
+  }
+  return chunks;
+}
+
+// The two passes of SpGemm over the structure of a and b, for any storage of the values: the symbolic
+// one fills col_ptr and row_index, resize(nnz) then makes room for the values, and the numeric one
+// passes every entry of C to store(position, value), with product(pa, pb) as in Multiply.
+template <typename T, typename U, typename Index, typename Product, typename Resize, typename Store,
+          typename ParallelFor>
+void SpGemmPasses(const CcsView<U, Index> &a, const CcsView<U, Index> &b, std::vector<Index> &col_ptr,
+                  std::vector<Index> &row_index, const Product &product, const Resize &resize, const Store &store,
+                  const ParallelFor &parallel_for) {
+  const std::size_t cols = b.cols;
+  col_ptr.assign(cols + 1, Index{0});
+
+  std::vector<std::size_t> work(cols);
+  parallel_for((cols + kSpGemmColumnBlock - 1) / kSpGemmColumnBlock, [&](std::size_t block) {
+    const std::size_t end = std::min(cols, (block + 1) * kSpGemmColumnBlock);
+    for (std::size_t j = block * kSpGemmColumnBlock; j < end; ++j) {
+      work[j] = ColumnWork(a, b, j);
+    }
+  });
+
+  const std::vector<std::size_t> chunks = WorkChunks(work, std::max(kSpGemmChunkWork, a.rows));
+  const std::size_t chunk_count = chunks.size() - 1;
+
+  parallel_for(chunk_count, [&](std::size_t chunk) {
+    ColumnAccumulator<T, Index> accumulator(a.rows);
+    for (std::size_t j = chunks[chunk]; j < chunks[chunk + 1]; ++j) {
+      col_ptr[j + 1] = static_cast<Index>(accumulator.Count(a, b, j, work[j]));
+    }
+  });
+  for (std::size_t j = 0; j < cols; ++j) {
+    col_ptr[j + 1] += col_ptr[j];
+  }
+
+  const auto nnz = static_cast<std::size_t>(col_ptr[cols]);
+  row_index.resize(nnz);
+  resize(nnz);
+  parallel_for(chunk_count, [&](std::size_t chunk) {
+    ColumnAccumulator<T, Index> accumulator(a.rows);
+    for (std::size_t j = chunks[chunk]; j < chunks[chunk + 1]; ++j) {
+      const auto begin = static_cast<std::size_t>(col_ptr[j]);
+      accumulator.Multiply(a, b, j, work[j], product, row_index.data() + begin,
+                           [&](std::size_t r, const T &value) { store(begin + r, value); });
+    }
+  });
+}
+
+}  // namespace detail
+
+// C = A * B (Gustavson, column by column) for CCS matrices with a.cols == b.rows and valid index
+// arrays; C gets its rows sorted within each column and keeps entries that cancel out as explicit
+// zeros, see Prune. For CRS matrices pass them swapped: the CRS arrays of A * B are the CCS arrays of
+// B^T * A^T. Two passes over the same units of parallel work, which parallel_for(count, body) runs as
+// in ppc::linalg::Gemm: the symbolic one counts the entries of every column of C, so that C is allocated
+// once at its exact size, and the numeric one writes every column straight to its place.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpGemm(const CcsView<T, Index> &a, const CcsView<T, Index> &b, CcsMatrix<T, Index> &c,
+            const ParallelFor &parallel_for = {}) {
+  c.rows = a.rows;
+  c.cols = b.cols;
+  detail::SpGemmPasses<T>(
+      a, b, c.col_ptr, c.row_index, [&](std::size_t pa, std::size_t pb) { return a.values[pa] * b.values[pb]; },
+      [&](std::size_t nnz) { c.values.resize(nnz); }, [&](std::size_t p, const T &value) { c.values[p] = value; },
+      parallel_for);
+}
+
+// Removes the entries of m whose value fails keep(value), e.g. the ones a product cancelled out
+template <typename T, typename Index, typename Keep>
+void Prune(CcsMatrix<T, Index> &m, const Keep &keep) {
+  std::size_t kept = 0;
+  std::size_t begin = 0;
+  for (std::size_t j = 0; j < m.cols; ++j) {
+    const auto end = static_cast<std::size_t>(m.col_ptr[j + 1]);
+    for (std::size_t p = begin; p < end; ++p) {
+      if (keep(m.values[p])) {
+        m.row_index[kept] = m.row_index[p];
+        m.values[kept] = m.values[p];
+        ++kept;
+      }
+    }
+    begin = end;
+    m.col_ptr[j + 1] = static_cast<Index>(kept);
+  }
+  m.row_index.resize(kept);
+  m.values.resize(kept);
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/spmv.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Complex matrices with the real and imaginary parts of their values in separate arrays re and im, of
+// real type T. The products below multiply them with explicit multiply-adds on the parts, which
+// vectorize where std::complex<T> multiplication does not and skip its checks for infinities and NaNs.
+// Which layout a product uses is chosen by the views passed to it; Split and Merge convert between them.
+template <typename T, typename Index = int>
+struct SplitCcsView {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const Index *col_ptr = nullptr;
+  const Index *row_index = nullptr;
+  const T *re = nullptr;
+  const T *im = nullptr;
+
+  // The index arrays, for the routines that only read the structure
+  [[nodiscard]] CcsView<T, Index> Pattern() const {
+    return {.rows = rows, .cols = cols, .col_ptr = col_ptr, .row_index = row_index, .values = re};
+  }
+};
+
+template <typename T, typename Index = int>
+struct SplitCrsView {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const Index *row_ptr = nullptr;
+  const Index *col_index = nullptr;
+  const T *re = nullptr;
+  const T *im = nullptr;
+
+  [[nodiscard]] CrsView<T, Index> Pattern() const {
+    return {.rows = rows, .cols = cols, .row_ptr = row_ptr, .col_index = col_index, .values = re};
+  }
+};
+
+template <typename T, typename Index = int>
+struct SplitCcsMatrix {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<Index> col_ptr;
+  std::vector<Index> row_index;
+  std::vector<T> re;
+  std::vector<T> im;
+
+  [[nodiscard]] SplitCcsView<T, Index> View() const {
+    return {.rows = rows,
+            .cols = cols,
+            .col_ptr = col_ptr.data(),
+            .row_index = row_index.data(),
+            .re = re.data(),
+            .im = im.data()};
+  }
+};
+
+template <typename T, typename Index = int>
+struct SplitCrsMatrix {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<Index> row_ptr;
+  std::vector<Index> col_index;
+  std::vector<T> re;
+  std::vector<T> im;
+
+  [[nodiscard]] SplitCrsView<T, Index> View() const {
+    return {.rows = rows,
+            .cols = cols,
+            .row_ptr = row_ptr.data(),
+            .col_index = col_index.data(),
+            .re = re.data(),
+            .im = im.data()};
+  }
+};
+
+namespace detail {
+
+// a * b + c, rounded once where the target has FMA
+template <typename T>
+T MulAdd(T a, T b, T c) {
+#if defined(__FMA__)
+  return std::fma(a, b, c);
+#else
+  return (a * b) + c;
+#endif
+}
+
+// A complex value in the accumulators of SpGemm
+template <typename T>
+struct SplitValue {
+  T re{};
+  T im{};
+
+  SplitValue &operator+=(const SplitValue &other) {
+    re += other.re;
+    im += other.im;
+    return *this;
+  }
+};
+
+template <typename T>
+SplitValue<T> SplitProduct(T a_re, T a_im, T b_re, T b_im) {
+  return {.re = MulAdd(a_re, b_re, -(a_im * b_im)), .im = MulAdd(a_re, b_im, a_im * b_re)};
+}
+
+template <typename T>
+void SplitValues(const std::complex<T> *values, std::size_t size, std::vector<T> &re, std::vector<T> &im) {
+  re.resize(size);
+  im.resize(size);
+  for (std::size_t p = 0; p < size; ++p) {
+    re[p] = values[p].real();
+    im[p] = values[p].imag();
+  }
+}
+
+template <typename T>
+std::vector<std::complex<T>> MergeValues(const T *re, const T *im, std::size_t size) {
+  std::vector<std::complex<T>> values(size);
+  for (std::size_t p = 0; p < size; ++p) {
+    values[p] = {re[p], im[p]};
+  }
+  return values;
+}
+
+// Sum of the products of the entries [begin, end) of a row with x, as SpmvKernel for split values
+template <typename T, typename Index>
+SplitValue<T> SplitDot(std::size_t begin, std::size_t end, const T *re, const T *im, const Index *index,
+                       const T *x_re, const T *x_im) {
+  // The products do not wait for the sums, which carry one addition per entry
+  SplitValue<T> sum;
+  for (std::size_t p = begin; p < end; ++p) {
+    const auto k = static_cast<std::size_t>(index[p]);
+    sum += SplitProduct(re[p], im[p], x_re[k], x_im[k]);
+  }
+  return sum;
+}
+
+template <typename T, typename Index>
+struct SplitSpmvKernel {
+  static SplitValue<T> Dot(std::size_t begin, std::size_t end, const T *re, const T *im, const Index *index,
+                           const T *x_re, const T *x_im) {
+    return SplitDot(begin, end, re, im, index, x_re, x_im);
+  }
+};
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+// Four entries per step, both parts of x gathered with the same indices
+template <typename Index>
+  requires(sizeof(Index) == 4)
+struct SplitSpmvKernel<double, Index> {
+  static SplitValue<double> Dot(std::size_t begin, std::size_t end, const double *re, const double *im,
+                                const Index *index, const double *x_re, const double *x_im) {
+    using Real = SpmvKernel<double, Index>;
+    __m256d acc_re = _mm256_setzero_pd();
+    __m256d acc_im = _mm256_setzero_pd();
+    std::size_t p = begin;
+    for (; p + 4 <= end; p += 4) {
+      const __m256d a_re = _mm256_loadu_pd(re + p);
+      const __m256d a_im = _mm256_loadu_pd(im + p);
+      const __m256d b_re = Real::Gather(x_re, index + p);
+      const __m256d b_im = Real::Gather(x_im, index + p);
+      acc_re = _mm256_fnmadd_pd(a_im, b_im, _mm256_fmadd_pd(a_re, b_re, acc_re));
+      acc_im = _mm256_fmadd_pd(a_im, b_re, _mm256_fmadd_pd(a_re, b_im, acc_im));
+    }
+    SplitValue<double> sum{.re = Real::Sum(acc_re), .im = Real::Sum(acc_im)};
+    sum += SplitDot(p, end, re, im, index, x_re, x_im);
+    return sum;
+  }
+};
+
+#endif
+
+}  // namespace detail
+
+template <typename T, typename Index>
+SplitCcsMatrix<T, Index> Split(const CcsView<std::complex<T>, Index> &a) {
+  SplitCcsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  result.col_ptr.assign(a.col_ptr, a.col_ptr + a.cols + 1);
+  result.row_index.assign(a.row_index, a.row_index + a.Nnz());
+  detail::SplitValues(a.values, a.Nnz(), result.re, result.im);
+  return result;
+}
+
+template <typename T, typename Index>
+SplitCrsMatrix<T, Index> Split(const CrsView<std::complex<T>, Index> &a) {
+  SplitCrsMatrix<T, Index> result;
+  result.rows = a.rows;
+  result.cols = a.cols;
+  result.row_ptr.assign(a.row_ptr, a.row_ptr + a.rows + 1);
+  result.col_index.assign(a.col_index, a.col_index + a.Nnz());
+  detail::SplitValues(a.values, a.Nnz(), result.re, result.im);
+  return result;
+}
+
+template <typename T, typename Index>
+CcsMatrix<std::complex<T>, Index> Merge(const SplitCcsView<T, Index> &a) {
+  const std::size_t nnz = a.Pattern().Nnz();
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .col_ptr = std::vector<Index>(a.col_ptr, a.col_ptr + a.cols + 1),
+          .row_index = std::vector<Index>(a.row_index, a.row_index + nnz),
+          .values = detail::MergeValues(a.re, a.im, nnz)};
+}
+
+template <typename T, typename Index>
+CrsMatrix<std::complex<T>, Index> Merge(const SplitCrsView<T, Index> &a) {
+  const std::size_t nnz = a.Pattern().Nnz();
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .row_ptr = std::vector<Index>(a.row_ptr, a.row_ptr + a.rows + 1),
+          .col_index = std::vector<Index>(a.col_index, a.col_index + nnz),
+          .values = detail::MergeValues(a.re, a.im, nnz)};
+}
+
+// SpGemm for split values, with the same passes and the same C apart from rounding: the products are
+// formed with multiply-adds rather than by std::complex
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpGemm(const SplitCcsView<T, Index> &a, const SplitCcsView<T, Index> &b, SplitCcsMatrix<T, Index> &c,
+            const ParallelFor &parallel_for = {}) {
+  c.rows = a.rows;
+  c.cols = b.cols;
+  detail::SpGemmPasses<detail::SplitValue<T>>(
+      a.Pattern(), b.Pattern(), c.col_ptr, c.row_index,
+      [&](std::size_t pa, std::size_t pb) { return detail::SplitProduct(a.re[pa], a.im[pa], b.re[pb], b.im[pb]); },
+      [&](std::size_t nnz) {
+        c.re.resize(nnz);
+        c.im.resize(nnz);
+      },
+      [&](std::size_t p, const detail::SplitValue<T> &value) {
+        c.re[p] = value.re;
+        c.im[p] = value.im;
+      },
+      parallel_for);
+}
+
+// Prune for split values; keep gets them as std::complex<T>
+template <typename T, typename Index, typename Keep>
+void Prune(SplitCcsMatrix<T, Index> &m, const Keep &keep) {
+  std::size_t kept = 0;
+  std::size_t begin = 0;
+  for (std::size_t j = 0; j < m.cols; ++j) {
+    const auto end = static_cast<std::size_t>(m.col_ptr[j + 1]);
+    for (std::size_t p = begin; p < end; ++p) {
+      if (keep(std::complex<T>(m.re[p], m.im[p]))) {
+        m.row_index[kept] = m.row_index[p];
+        m.re[kept] = m.re[p];
+        m.im[kept] = m.im[p];
+        ++kept;
+      }
+    }
+    begin = end;
+    m.col_ptr[j + 1] = static_cast<Index>(kept);
+  }
+  m.row_index.resize(kept);
+  m.re.resize(kept);
+  m.im.resize(kept);
+}
+
+// SpMV for split values: y = a * x with x and y split the same way, balanced as SpMV
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpMV(const SplitCrsView<T, Index> &a, const T *x_re, const T *x_im, T *y_re, T *y_im,
+          const ParallelFor &parallel_for = {}) {
+  const CrsView<T, Index> pattern = a.Pattern();
+  auto dot = [&](std::size_t begin, std::size_t end) {
+    return detail::SplitSpmvKernel<T, Index>::Dot(begin, end, a.re, a.im, a.col_index, x_re, x_im);
+  };
+  std::vector<std::size_t> carry_row(detail::MergeUnits(pattern));
+  std::vector<detail::SplitValue<T>> carry_value(carry_row.size());
+  detail::ForEachMergeUnit(
+      pattern,
+      [&](std::size_t row, std::size_t begin, std::size_t end) {
+        const detail::SplitValue<T> sum = dot(begin, end);
+        y_re[row] = sum.re;
+        y_im[row] = sum.im;
+      },
+      [&](std::size_t unit, std::size_t row, std::size_t begin, std::size_t end) {
+        carry_row[unit] = row;
+        carry_value[unit] = dot(begin, end);
+      },
+      parallel_for);
+  for (std::size_t unit = 0; unit < carry_row.size(); ++unit) {
+    if (carry_row[unit] < a.rows) {
+      y_re[carry_row[unit]] += carry_value[unit].re;
+      y_im[carry_row[unit]] += carry_value[unit].im;
+    }
+  }
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+namespace ppc::sparse {
+
+using ppc::linalg::SerialFor;
+
+// Rows plus nonzeros handled by one unit of parallel work. The units split the merge of the row ends
+// with the nonzeros evenly, so a unit gets the same work whether its share is one long row or many
+// short ones, and a row longer than a unit is shared by several.
+inline constexpr std::size_t kSpmvChunkWork = std::size_t{1} << 14;
+
+namespace detail {
+
+// Sum of values[p] * x[index[p]] over [begin, end), the gather in the inner loop of SpMV.
+// The generic version is a plain loop.
+template <typename T, typename Index>
+struct SpmvKernel {
+  static T Dot(std::size_t begin, std::size_t end, const T *values, const Index *index, const T *x) {
+    T sum{};
+    for (std::size_t p = begin; p < end; ++p) {
+      sum += values[p] * x[static_cast<std::size_t>(index[p])];
+    }
+    return sum;
+  }
+};
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+// Four entries of x per gather, with two accumulators to hide the latency of the FMAs.
+// Only 32-bit indices fit the gather, and they are read as signed, so a row may not reach 2^31.
+template <typename Index>
+  requires(sizeof(Index) == 4)
+struct SpmvKernel<double, Index> {
+  static double Dot(std::size_t begin, std::size_t end, const double *values, const Index *index, const double *x) {
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    std::size_t p = begin;
+    for (; p + 8 <= end; p += 8) {
+      acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(values + p), Gather(x, index + p), acc0);
+      acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(values + p + 4), Gather(x, index + p + 4), acc1);
+    }
+    if (p + 4 <= end) {
+      acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(values + p), Gather(x, index + p), acc0);
+      p += 4;
+    }
+    double sum = Sum(_mm256_add_pd(acc0, acc1));
+    for (; p < end; ++p) {
+      sum += values[p] * x[static_cast<std::size_t>(index[p])];
+    }
+    return sum;
+  }
+
+  // x[index[0..3]]. The masked form with a zero source, because the plain one starts from an
+  // undefined register that GCC reports as uninitialized.
+  static __m256d Gather(const double *x, const Index *index) {
+    const __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(index));
+    const __m256d all = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    return _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, lanes, all, 8);
+  }
+
+  static double Sum(__m256d v) {
+    const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+  }
+};
+
+#endif
+
+// Where diagonal d of the merge of the row ends row_ptr[1..rows] with the nonzeros 0..nnz-1 crosses
+// the merge path: the path has taken the first `row` row ends and the first d - row nonzeros
+template <typename Index>
+std::size_t MergePathRow(std::size_t d, const Index *row_ptr, std::size_t rows, std::size_t nnz) {
+  std::size_t lo = d > nnz ? d - nnz : 0;
+  std::size_t hi = std::min(d, rows);
+  while (lo < hi) {
+    const std::size_t mid = lo + ((hi - lo) / 2);
+    if (static_cast<std::size_t>(row_ptr[mid + 1]) <= d - 1 - mid) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+template <typename T, typename Index>
+std::size_t MergeUnits(const CrsView<T, Index> &a) {
+  return std::max<std::size_t>(1, (a.rows + a.Nnz() + kSpmvChunkWork - 1) / kSpmvChunkWork);
+}
+
+// Splits the merge of a's rows and nonzeros into MergeUnits(a) units. Each unit passes the
+// rows it finishes to finish(row, begin, end) with the range of the row's nonzeros it covers, which
+// for its first row may start mid-row; the part of the row it ends in is passed to carry(unit, row,
+// begin, end) instead, to be added by the caller once all units are done. row is rows for a unit
+// ending after the last row.
+template <typename T, typename Index, typename Finish, typename Carry, typename ParallelFor>
+void ForEachMergeUnit(const CrsView<T, Index> &a, const Finish &finish, const Carry &carry,
+                      const ParallelFor &parallel_for) {
+  const std::size_t nnz = a.Nnz();
+  const std::size_t total = a.rows + nnz;
+  const std::size_t units = MergeUnits(a);
+  parallel_for(units, [&](std::size_t unit) {
+    const std::size_t d_begin = total * unit / units;
+    const std::size_t d_end = total * (unit + 1) / units;
+    std::size_t row = MergePathRow(d_begin, a.row_ptr, a.rows, nnz);
+    std::size_t p = d_begin - row;
+    const std::size_t row_end = MergePathRow(d_end, a.row_ptr, a.rows, nnz);
+    for (; row < row_end; ++row) {
+      finish(row, p, a.End(row));
+      p = a.End(row);
+    }
+    carry(unit, row_end, p, d_end - row_end);
+  });
+}
+
+}  // namespace detail
+
+// y = a * x for a CRS matrix a, with x of a.cols entries and y of a.rows. The work is balanced by
+// nonzeros rather than by rows, so a few very long rows do not hold up the rest.
+// The CRS arrays of a CCS matrix are those of its transpose: SpMV(TransposedView(b), ...) is b^T * x.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpMV(const CrsView<T, Index> &a, const T *x, T *y, const ParallelFor &parallel_for = {}) {
+  std::vector<std::size_t> carry_row(detail::MergeUnits(a));
+  std::vector<T> carry_value(carry_row.size());
+  detail::ForEachMergeUnit(
+      a,
+      [&](std::size_t row, std::size_t begin, std::size_t end) {
+        y[row] = detail::SpmvKernel<T, Index>::Dot(begin, end, a.values, a.col_index, x);
+      },
+      [&](std::size_t unit, std::size_t row, std::size_t begin, std::size_t end) {
+        carry_row[unit] = row;
+        carry_value[unit] = detail::SpmvKernel<T, Index>::Dot(begin, end, a.values, a.col_index, x);
+      },
+      parallel_for);
+  for (std::size_t unit = 0; unit < carry_row.size(); ++unit) {
+    if (carry_row[unit] < a.rows) {
+      y[carry_row[unit]] += carry_value[unit];
+    }
+  }
+}
+
+// c = a * b for a CRS matrix a and dense row-major b (a.cols x n, row stride ldb) and c (a.rows x n,
+// row stride ldc). Every nonzero adds a multiple of a contiguous row of b, which vectorizes without
+// gathers; the work is balanced as in SpMV.
+template <typename T, typename Index, typename ParallelFor = SerialFor>
+void SpMM(const CrsView<T, Index> &a, const T *b, std::size_t ldb, std::size_t n, T *c, std::size_t ldc,
+          const ParallelFor &parallel_for = {}) {
+  auto accumulate = [&](std::size_t begin, std::size_t end, T *out) {
+    std::fill(out, out + n, T{});
+    for (std::size_t p = begin; p < end; ++p) {
+      const T value = a.values[p];
+      const T *b_row = b + (static_cast<std::size_t>(a.col_index[p]) * ldb);
+      for (std::size_t j = 0; j < n; ++j) {
+        out[j] += value * b_row[j];
+      }
+    }
+  };
+  std::vector<std::size_t> carry_row(detail::MergeUnits(a));
+  std::vector<T> carry_value(carry_row.size() * n);
+  detail::ForEachMergeUnit(
+      a, [&](std::size_t row, std::size_t begin, std::size_t end) { accumulate(begin, end, c + (row * ldc)); },
+      [&](std::size_t unit, std::size_t row, std::size_t begin, std::size_t end) {
+        carry_row[unit] = row;
+        accumulate(begin, end, carry_value.data() + (unit * n));
+      },
+      parallel_for);
+  for (std::size_t unit = 0; unit < carry_row.size(); ++unit) {
+    if (carry_row[unit] < a.rows) {
+      T *c_row = c + (carry_row[unit] * ldc);
+      const T *carried = carry_value.data() + (unit * n);
+      for (std::size_t j = 0; j < n; ++j) {
+        c_row[j] += carried[j];
+      }
+    }
+  }
+}
+
+}  // namespace ppc::sparse
@@ -0,0 +1,19 @@
+#include "core/sparse/include/benchmark.hpp"
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+namespace ppc::sparse {
+
+std::string FormatSparseRate(std::string_view task, std::string_view case_name, std::size_t multiply_adds,
+                             std::size_t nnz, double seconds) {
+  const double gflops = seconds > 0.0 ? 2.0 * static_cast<double>(multiply_adds) / seconds * 1e-9 : 0.0;
+  const double nnz_per_s = seconds > 0.0 ? static_cast<double>(nnz) / seconds : 0.0;
+  std::ostringstream line;
+  line << task << ": case=" << case_name << " time=" << seconds << " gflops=" << gflops << " nnz_per_s=" << nnz_per_s;
+  return line.str();
+}
+
+}  // namespace ppc::sparse
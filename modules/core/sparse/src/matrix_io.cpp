@@ -0,0 +1,404 @@
+#include "core/sparse/include/matrix_io.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <iterator>
+#endif
+
+namespace ppc::sparse {
+
+MappedFile::MappedFile(const std::string &path) {
+#ifndef _WIN32
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  struct stat status{};
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    throw std::runtime_error("cannot read the size of " + path);
+  }
+  size_ = static_cast<std::size_t>(status.st_size);
+  if (size_ > 0) {
+    void *data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("cannot map " + path);
+    }
+    data_ = static_cast<const std::byte *>(data);
+    mapped_ = true;
+  }
+  close(fd);
+#else
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("cannot open " + path);
+  }
+  for (auto it = std::istreambuf_iterator<char>(in); it != std::istreambuf_iterator<char>(); ++it) {
+    buffer_.push_back(static_cast<std::byte>(*it));
+  }
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+#endif
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapped_(std::exchange(other.mapped_, false)),
+      buffer_(std::move(other.buffer_)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    MappedFile old(std::move(*this));
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    mapped_ = std::exchange(other.mapped_, false);
+    buffer_ = std::move(other.buffer_);
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (mapped_) {
+    munmap(const_cast<std::byte *>(data_), size_);
+  }
+#endif
+}
+
+namespace {
+
+bool IsBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+std::string_view NextLine(std::string_view text, std::size_t &pos) {
+  const std::size_t end = std::min(text.find('\n', pos), text.size());
+  const std::string_view line = text.substr(pos, end - pos);
+  pos = std::min(end + 1, text.size());
+  return line;
+}
+
+// The next blank-separated word of line from pos, empty at the end
+std::string_view NextWord(std::string_view line, std::size_t &pos) {
+  while (pos < line.size() && IsBlank(line[pos])) {
+    ++pos;
+  }
+  const std::size_t begin = pos;
+  while (pos < line.size() && !IsBlank(line[pos])) {
+    ++pos;
+  }
+  return line.substr(begin, pos - begin);
+}
+
+bool IsEntryLine(std::string_view line) {
+  std::size_t pos = 0;
+  const std::string_view word = NextWord(line, pos);
+  return !word.empty() && word.front() != '%';
+}
+
+std::string Lower(std::string_view word) {
+  std::string lower(word);
+  std::ranges::transform(lower, lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return lower;
+}
+
+bool ParseUnsigned(std::string_view word, std::uint64_t &value) {
+  const auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+  return error == std::errc() && end == word.data() + word.size();
+}
+
+bool ParseReal(std::string_view word, double &value) {
+  if (word.size() > 1 && word.front() == '+') {
+    word.remove_prefix(1);
+  }
+#if defined(__cpp_lib_to_chars)
+  const auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+  return error == std::errc() && end == word.data() + word.size();
+#else
+  // Without floating-point from_chars: strtod on a terminated copy, long enough for any double
+  std::array<char, 64> copy{};
+  if (word.empty() || word.size() >= copy.size()) {
+    return false;
+  }
+  std::ranges::copy(word, copy.begin());
+  char *end = nullptr;
+  value = std::strtod(copy.data(), &end);
+  return end == copy.data() + word.size();
+#endif
+}
+
+// Layout of the header of a binary file, 64 bytes
+struct BinaryHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byte_order;
+  std::uint8_t layout;
+  std::uint8_t value_kind;
+  std::uint8_t value_size;
+  std::uint8_t index_signed;
+  std::uint8_t index_size;
+  std::array<std::uint8_t, 3> reserved;
+  std::uint64_t rows;
+  std::uint64_t cols;
+  std::uint64_t nnz;
+  std::array<std::uint8_t, 16> padding;
+};
+static_assert(sizeof(BinaryHeader) == 64);
+
+constexpr std::array<char, 8> kBinaryMagic = {'P', 'P', 'C', 'S', 'P', 'A', 'R', 'S'};
+constexpr std::uint32_t kBinaryVersion = 1;
+// Reads back as another number on a machine of the other byte order
+constexpr std::uint32_t kByteOrderMark = 0x01020304;
+constexpr std::size_t kBinaryAlignment = 64;
+
+std::size_t AlignBinary(std::size_t offset) {
+  return ((offset + kBinaryAlignment - 1) / kBinaryAlignment) * kBinaryAlignment;
+}
+
+// Offsets of the three arrays and the end of the file
+struct BinaryOffsets {
+  std::size_t ptr = 0;
+  std::size_t index = 0;
+  std::size_t values = 0;
+  std::size_t end = 0;
+};
+
+BinaryOffsets OffsetsOf(std::size_t outer, std::size_t nnz, const detail::BinaryFormat &format) {
+  BinaryOffsets offsets;
+  offsets.ptr = sizeof(BinaryHeader);
+  offsets.index = AlignBinary(offsets.ptr + ((outer + 1) * format.index_size));
+  offsets.values = AlignBinary(offsets.index + (nnz * format.index_size));
+  offsets.end = offsets.values + (nnz * format.value_size);
+  return offsets;
+}
+
+std::uint64_t ReadIndex(const std::byte *data, std::uint8_t index_size) {
+  if (index_size == sizeof(std::uint32_t)) {
+    std::uint32_t value = 0;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+  }
+  std::uint64_t value = 0;
+  std::memcpy(&value, data, std::min<std::size_t>(index_size, sizeof(value)));
+  return value;
+}
+
+}  // namespace
+
+namespace detail {
+
+std::size_t ParseMatrixMarketHeader(std::string_view text, MatrixMarketHeader &header) {
+  std::size_t pos = 0;
+  const std::string_view banner = NextLine(text, pos);
+  std::size_t word_pos = 0;
+  std::array<std::string, 5> words;
+  for (auto &word : words) {
+    word = Lower(NextWord(banner, word_pos));
+  }
+  if (words[0] != "%%matrixmarket" || words[1] != "matrix") {
+    throw std::runtime_error("not a Matrix Market file");
+  }
+  if (words[2] != "coordinate") {
+    throw std::runtime_error("only coordinate Matrix Market files are supported, not " + words[2]);
+  }
+  if (words[3] == "real") {
+    header.field = MatrixMarketField::kReal;
+  } else if (words[3] == "integer") {
+    header.field = MatrixMarketField::kInteger;
+  } else if (words[3] == "complex") {
+    header.field = MatrixMarketField::kComplex;
+  } else if (words[3] == "pattern") {
+    header.field = MatrixMarketField::kPattern;
+  } else {
+    throw std::runtime_error("unknown Matrix Market field " + words[3]);
+  }
+  if (words[4] == "general") {
+    header.symmetry = MatrixMarketSymmetry::kGeneral;
+  } else if (words[4] == "symmetric") {
+    header.symmetry = MatrixMarketSymmetry::kSymmetric;
+  } else if (words[4] == "skew-symmetric") {
+    header.symmetry = MatrixMarketSymmetry::kSkewSymmetric;
+  } else if (words[4] == "hermitian") {
+    header.symmetry = MatrixMarketSymmetry::kHermitian;
+  } else {
+    throw std::runtime_error("unknown Matrix Market symmetry " + words[4]);
+  }
+  if (header.symmetry == MatrixMarketSymmetry::kHermitian && header.field != MatrixMarketField::kComplex) {
+    throw std::runtime_error("Hermitian Matrix Market files have complex entries");
+  }
+
+  while (pos < text.size()) {
+    const std::string_view line = NextLine(text, pos);
+    if (!IsEntryLine(line)) {
+      continue;
+    }
+    std::size_t size_pos = 0;
+    std::uint64_t rows = 0;
+    std::uint64_t cols = 0;
+    std::uint64_t entries = 0;
+    if (!ParseUnsigned(NextWord(line, size_pos), rows) || !ParseUnsigned(NextWord(line, size_pos), cols) ||
+        !ParseUnsigned(NextWord(line, size_pos), entries)) {
+      throw std::runtime_error("malformed Matrix Market size line");
+    }
+    if (header.symmetry != MatrixMarketSymmetry::kGeneral && rows != cols) {
+      throw std::runtime_error("a symmetric Matrix Market matrix has to be square");
+    }
+    header.rows = rows;
+    header.cols = cols;
+    header.entries = entries;
+    return pos;
+  }
+  throw std::runtime_error("Matrix Market file without a size line");
+}
+
+std::vector<std::size_t> SplitLines(std::string_view text, std::size_t begin, std::size_t chunk_bytes) {
+  std::vector<std::size_t> bounds = {begin};
+  while (text.size() - bounds.back() > chunk_bytes) {
+    const std::size_t newline = text.find('\n', bounds.back() + chunk_bytes - 1);
+    if (newline == std::string_view::npos || newline + 1 == text.size()) {
+      break;
+    }
+    bounds.push_back(newline + 1);
+  }
+  bounds.push_back(text.size());
+  return bounds;
+}
+
+std::size_t CountMatrixMarketEntries(std::string_view text) {
+  std::size_t count = 0;
+  std::size_t pos = 0;
+  while (pos < text.size()) {
+    count += IsEntryLine(NextLine(text, pos)) ? 1 : 0;
+  }
+  return count;
+}
+
+MatrixMarketLine NextMatrixMarketEntry(std::string_view text, std::size_t &pos, MatrixMarketField field,
+                                       MatrixMarketEntry &entry) {
+  while (pos < text.size()) {
+    const std::string_view line = NextLine(text, pos);
+    if (!IsEntryLine(line)) {
+      continue;
+    }
+    std::size_t word_pos = 0;
+    if (!ParseUnsigned(NextWord(line, word_pos), entry.row) || !ParseUnsigned(NextWord(line, word_pos), entry.col)) {
+      return MatrixMarketLine::kMalformed;
+    }
+    entry.re = 1.0;
+    entry.im = 0.0;
+    switch (field) {
+      case MatrixMarketField::kReal:
+      case MatrixMarketField::kInteger:
+        if (!ParseReal(NextWord(line, word_pos), entry.re)) {
+          return MatrixMarketLine::kMalformed;
+        }
+        break;
+      case MatrixMarketField::kComplex:
+        if (!ParseReal(NextWord(line, word_pos), entry.re) || !ParseReal(NextWord(line, word_pos), entry.im)) {
+          return MatrixMarketLine::kMalformed;
+        }
+        break;
+      case MatrixMarketField::kPattern:
+        break;
+    }
+    return NextWord(line, word_pos).empty() ? MatrixMarketLine::kEntry : MatrixMarketLine::kMalformed;
+  }
+  return MatrixMarketLine::kEnd;
+}
+
+BinaryArrays MapBinary(const MappedFile &file, const BinaryFormat &format) {
+  BinaryHeader header{};
+  if (file.Size() < sizeof(header)) {
+    throw std::runtime_error("not a binary sparse matrix: the file is too short");
+  }
+  std::memcpy(&header, file.Data(), sizeof(header));
+  if (header.magic != kBinaryMagic || header.version != kBinaryVersion) {
+    throw std::runtime_error("not a binary sparse matrix");
+  }
+  if (header.byte_order != kByteOrderMark) {
+    throw std::runtime_error("binary sparse matrix of another byte order");
+  }
+  if (header.layout != static_cast<std::uint8_t>(format.layout)) {
+    throw std::runtime_error(format.layout == SparseLayout::kCrs ? "binary sparse matrix in CCS, not CRS"
+                                                                  : "binary sparse matrix in CRS, not CCS");
+  }
+  if (header.value_kind != format.value_kind || header.value_size != format.value_size ||
+      header.index_signed != format.index_signed || header.index_size != format.index_size) {
+    throw std::runtime_error("binary sparse matrix of other value or index types");
+  }
+  const std::size_t outer = format.layout == SparseLayout::kCrs ? header.rows : header.cols;
+  const BinaryOffsets offsets = OffsetsOf(outer, header.nnz, format);
+  if (file.Size() < offsets.end) {
+    throw std::runtime_error("binary sparse matrix cut short");
+  }
+  const std::byte *data = file.Data();
+  if (ReadIndex(data + offsets.ptr, format.index_size) != 0 ||
+      ReadIndex(data + offsets.ptr + (outer * format.index_size), format.index_size) != header.nnz) {
+    throw std::runtime_error("binary sparse matrix with pointers that do not match its entries");
+  }
+  return {.rows = header.rows,
+          .cols = header.cols,
+          .ptr = data + offsets.ptr,
+          .index = data + offsets.index,
+          .values = data + offsets.values};
+}
+
+void WriteBinary(const std::string &path, const BinaryFormat &format, std::size_t rows, std::size_t cols,
+                 const void *ptr, const void *index, const void *values, std::size_t nnz) {
+  const std::size_t outer = format.layout == SparseLayout::kCrs ? rows : cols;
+  const BinaryOffsets offsets = OffsetsOf(outer, nnz, format);
+  BinaryHeader header{};
+  header.magic = kBinaryMagic;
+  header.version = kBinaryVersion;
+  header.byte_order = kByteOrderMark;
+  header.layout = static_cast<std::uint8_t>(format.layout);
+  header.value_kind = format.value_kind;
+  header.value_size = format.value_size;
+  header.index_signed = format.index_signed;
+  header.index_size = format.index_size;
+  header.rows = rows;
+  header.cols = cols;
+  header.nnz = nnz;
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    throw std::runtime_error("cannot create " + path);
+  }
+  const std::array<char, kBinaryAlignment> zeros{};
+  auto write_at = [&](std::size_t offset, const void *data, std::size_t size) {
+    const auto at = static_cast<std::size_t>(out.tellp());
+    out.write(zeros.data(), static_cast<std::streamsize>(offset - at));
+    out.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+  };
+  write_at(0, &header, sizeof(header));
+  write_at(offsets.ptr, ptr, (outer + 1) * format.index_size);
+  write_at(offsets.index, index, nnz * format.index_size);
+  write_at(offsets.values, values, nnz * format.value_size);
+  if (!out.flush()) {
+    throw std::runtime_error("cannot write " + path);
+  }
+}
+
+}  // namespace detail
+
+}  // namespace ppc::sparse
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "core/util/include/sort_inputs.hpp"
+
+using ppc::util::Distribution;
+using ppc::util::GenerateSortInput;
+
+TEST(sort_inputs_tests, every_distribution_has_requested_size) {
+  for (auto distribution : ppc::util::kComparableDistributions) {
+    EXPECT_EQ(GenerateSortInput<int>(distribution, 1000).size(), 1000U) << ppc::util::DistributionName(distribution);
+    EXPECT_EQ(GenerateSortInput<double>(distribution, 0).size(), 0U) << ppc::util::DistributionName(distribution);
+  }
+}
+
+TEST(sort_inputs_tests, generation_is_deterministic) {
+  EXPECT_EQ(GenerateSortInput<double>(Distribution::kUniform, 500, 7),
+            GenerateSortInput<double>(Distribution::kUniform, 500, 7));
+  EXPECT_NE(GenerateSortInput<int>(Distribution::kUniform, 500, 7),
+            GenerateSortInput<int>(Distribution::kUniform, 500, 8));
+}
+
+TEST(sort_inputs_tests, sorted_and_reverse) {
+  const auto sorted = GenerateSortInput<int>(Distribution::kSorted, 1000);
+  EXPECT_TRUE(std::ranges::is_sorted(sorted));
+  const auto reverse = GenerateSortInput<long long>(Distribution::kReverse, 1000);
+  EXPECT_TRUE(std::ranges::is_sorted(reverse, std::greater<>()));
+}
+
+TEST(sort_inputs_tests, nearly_sorted_is_a_permutation) {
+  auto data = GenerateSortInput<int>(Distribution::kNearlySorted, 10000);
+  EXPECT_FALSE(std::ranges::is_sorted(data));
+  std::ranges::sort(data);
+  EXPECT_EQ(data, GenerateSortInput<int>(Distribution::kSorted, 10000));
+}
+
+TEST(sort_inputs_tests, few_unique_and_all_equal) {
+  const auto few = GenerateSortInput<double>(Distribution::kFewUnique, 10000);
+  EXPECT_LE(std::set<double>(few.begin(), few.end()).size(), 16U);
+  const auto equal = GenerateSortInput<int>(Distribution::kAllEqual, 100);
+  EXPECT_EQ(std::set<int>(equal.begin(), equal.end()).size(), 1U);
+}
+
+TEST(sort_inputs_tests, zipf_is_skewed) {
+  const auto data = GenerateSortInput<int>(Distribution::kZipf, 100000);
+  const auto zeros = std::ranges::count(data, 0);
+  EXPECT_GT(zeros, 5000);
+  EXPECT_TRUE(std::ranges::all_of(data, [](int v) { return v >= 0 && v < 10000; }));
+}
+
+TEST(sort_inputs_tests, sawtooth_has_sixteen_runs) {
+  const auto data = GenerateSortInput<int>(Distribution::kSawtooth, 1600);
+  std::size_t descents = 0;
+  for (std::size_t i = 1; i < data.size(); ++i) {
+    descents += data[i] < data[i - 1] ? 1 : 0;
+  }
+  EXPECT_EQ(descents, 15U);
+}
+
+TEST(sort_inputs_tests, extremes_contain_limits) {
+  const auto data = GenerateSortInput<double>(Distribution::kExtremes, 10000);
+  EXPECT_NE(std::ranges::find(data, std::numeric_limits<double>::infinity()), data.end());
+  EXPECT_NE(std::ranges::find(data, std::numeric_limits<double>::lowest()), data.end());
+  EXPECT_TRUE(std::ranges::any_of(data, [](double v) { return v == 0.0 && std::signbit(v); }));
+}
+
+TEST(sort_inputs_tests, nan_only_for_floating_point) {
+  const auto data = GenerateSortInput<double>(Distribution::kNaN, 10000);
+  EXPECT_TRUE(std::ranges::any_of(data, [](double v) { return std::isnan(v); }));
+  EXPECT_THROW(GenerateSortInput<int>(Distribution::kNaN, 10), std::invalid_argument);
+}
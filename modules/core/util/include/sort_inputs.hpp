@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ppc::util {
+
+// Input shapes used to benchmark sorting tasks; see GenerateSortInput
+enum class Distribution : std::uint8_t {
+  kUniform,        // independent uniform values over the whole range of the type
+  kSorted,         // already ascending
+  kReverse,        // strictly descending
+  kNearlySorted,   // ascending with 1% of the elements swapped with random partners
+  kFewUnique,      // 16 distinct values
+  kZipf,           // ranks 0..9999 with Zipf(1.0) frequencies: a few keys dominate
+  kStaggered,      // Bentley-McIlroy stagger: (i * m + i) mod n with m = n / 8
+  kSawtooth,       // 16 ascending runs of equal length
+  kAllEqual,       // a single repeated value
+  kExtremes,       // uniform values mixed with the lowest and highest values of the type (+-0 and +-inf too)
+  kNaN,            // uniform doubles with 1% NaN; floating-point types only
+};
+
+// Every distribution that is a valid input for a comparison sort of any type (kNaN is not)
+inline constexpr std::array<Distribution, 10> kComparableDistributions = {
+    Distribution::kUniform,   Distribution::kSorted,    Distribution::kReverse,  Distribution::kNearlySorted,
+    Distribution::kFewUnique, Distribution::kZipf,      Distribution::kStaggered, Distribution::kSawtooth,
+    Distribution::kAllEqual,  Distribution::kExtremes};
+
+std::string DistributionName(Distribution distribution);
+
+// Deterministic for a given seed. Defined for int, long long and double; kNaN throws
+// std::invalid_argument for the integer types.
+template <typename T>
+std::vector<T> GenerateSortInput(Distribution distribution, std::size_t size, std::uint64_t seed = 42);
+
+}  // namespace ppc::util
@@ -0,0 +1,157 @@
+#include "core/util/include/sort_inputs.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template <typename T>
+T UniformValue(std::mt19937_64 &gen) {
+  if constexpr (std::is_integral_v<T>) {
+    return std::uniform_int_distribution<T>(std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max())(gen);
+  } else {
+    return std::uniform_real_distribution<T>(-1e9, 1e9)(gen);
+  }
+}
+
+std::vector<double> ZipfCdf(std::size_t ranks) {
+  std::vector<double> cdf(ranks);
+  double sum = 0.0;
+  for (std::size_t r = 0; r < ranks; ++r) {
+    sum += 1.0 / static_cast<double>(r + 1);
+    cdf[r] = sum;
+  }
+  for (auto &value : cdf) {
+    value /= sum;
+  }
+  return cdf;
+}
+
+}  // namespace
+
+std::string ppc::util::DistributionName(Distribution distribution) {
+  switch (distribution) {
+    case Distribution::kUniform:
+      return "uniform";
+    case Distribution::kSorted:
+      return "sorted";
+    case Distribution::kReverse:
+      return "reverse";
+    case Distribution::kNearlySorted:
+      return "nearly_sorted";
+    case Distribution::kFewUnique:
+      return "few_unique";
+    case Distribution::kZipf:
+      return "zipf";
+    case Distribution::kStaggered:
+      return "staggered";
+    case Distribution::kSawtooth:
+      return "sawtooth";
+    case Distribution::kAllEqual:
+      return "all_equal";
+    case Distribution::kExtremes:
+      return "extremes";
+    case Distribution::kNaN:
+      return "nan";
+  }
+  return "unknown";
+}
+
+template <typename T>
+std::vector<T> ppc::util::GenerateSortInput(Distribution distribution, std::size_t size, std::uint64_t seed) {
+  std::mt19937_64 gen(seed);
+  std::vector<T> data(size);
+  auto ascending = [&data] {
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<T>(i);
+    }
+  };
+
+  switch (distribution) {
+    case Distribution::kUniform:
+      std::ranges::generate(data, [&gen] { return UniformValue<T>(gen); });
+      break;
+    case Distribution::kSorted:
+      ascending();
+      break;
+    case Distribution::kReverse:
+      ascending();
+      std::ranges::reverse(data);
+      break;
+    case Distribution::kNearlySorted: {
+      ascending();
+      std::uniform_int_distribution<std::size_t> index(0, size == 0 ? 0 : size - 1);
+      for (std::size_t swaps = size / 100; swaps > 0; --swaps) {
+        std::swap(data[index(gen)], data[index(gen)]);
+      }
+      break;
+    }
+    case Distribution::kFewUnique: {
+      std::uniform_int_distribution<int> value(0, 15);
+      std::ranges::generate(data, [&] { return static_cast<T>(value(gen) * 1000); });
+      break;
+    }
+    case Distribution::kZipf: {
+      const std::vector<double> cdf = ZipfCdf(10000);
+      std::uniform_real_distribution<double> u(0.0, 1.0);
+      std::ranges::generate(data, [&] {
+        const auto rank = std::ranges::upper_bound(cdf, u(gen)) - cdf.begin();
+        return static_cast<T>(std::min<std::ptrdiff_t>(rank, static_cast<std::ptrdiff_t>(cdf.size()) - 1));
+      });
+      break;
+    }
+    case Distribution::kStaggered: {
+      const std::size_t m = std::max<std::size_t>(size / 8, 1);
+      for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<T>(((i * m) + i) % size);
+      }
+      break;
+    }
+    case Distribution::kSawtooth: {
+      const std::size_t period = std::max<std::size_t>(size / 16, 1);
+      for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<T>(i % period);
+      }
+      break;
+    }
+    case Distribution::kAllEqual:
+      std::ranges::fill(data, static_cast<T>(7));
+      break;
+    case Distribution::kExtremes: {
+      std::vector<T> specials = {std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max(), T{0}};
+      if constexpr (std::is_floating_point_v<T>) {
+        specials.insert(specials.end(), {-0.0, std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+                                         std::numeric_limits<T>::denorm_min()});
+      }
+      std::uniform_int_distribution<std::size_t> pick(0, (specials.size() * 10) - 1);
+      std::ranges::generate(data, [&] {
+        const std::size_t p = pick(gen);
+        return p < specials.size() ? specials[p] : UniformValue<T>(gen);
+      });
+      break;
+    }
+    case Distribution::kNaN:
+      if constexpr (std::is_floating_point_v<T>) {
+        std::uniform_int_distribution<int> percent(0, 99);
+        std::ranges::generate(data, [&] {
+          return percent(gen) == 0 ? std::numeric_limits<T>::quiet_NaN() : UniformValue<T>(gen);
+        });
+        break;
+      } else {
+        throw std::invalid_argument("NaN inputs exist only for floating-point types");
+      }
+  }
+  return data;
+}
+
+template std::vector<int> ppc::util::GenerateSortInput<int>(Distribution, std::size_t, std::uint64_t);
+template std::vector<long long> ppc::util::GenerateSortInput<long long>(Distribution, std::size_t, std::uint64_t);
+template std::vector<double> ppc::util::GenerateSortInput<double>(Distribution, std::size_t, std::uint64_t);
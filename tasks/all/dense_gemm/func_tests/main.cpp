@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/dense_gemm/include/ops_all.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+std::vector<double> GenerateMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+std::vector<double> NaiveMultiply(const std::vector<double> &a, const std::vector<double> &b, std::size_t m,
+                                  std::size_t k, std::size_t n) {
+  std::vector<double> c(m * n);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+ppc::core::TaskDataPtr MakeTaskData(std::vector<double> &a, std::vector<double> &b, std::vector<double> &c,
+                                    std::size_t m, std::size_t k, std::size_t n) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data->inputs_count = {static_cast<unsigned>(m), static_cast<unsigned>(k), static_cast<unsigned>(n)};
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data->outputs_count.emplace_back(c.size());
+  return task_data;
+}
+
+// Every process runs the task; only rank 0 has the matrices and checks the result. Also checks that each
+// process moved as much data as the model says.
+void CheckAgainstNaive(std::size_t m, std::size_t k, std::size_t n, int replication) {
+  boost::mpi::communicator world;
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> c;
+  if (world.rank() == 0) {
+    a = GenerateMatrix(m, k, 1);
+    b = GenerateMatrix(k, n, 2);
+    c.resize(m * n);
+  }
+  dense_gemm_all::GemmAll task(MakeTaskData(a, b, c, m, k, n), replication);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  const auto &grid = task.GetGrid();
+  if (task.GetLayer() >= 0) {
+    const auto q = static_cast<std::size_t>(grid.q);
+    const std::size_t mb = (m + q - 1) / q;
+    const std::size_t kb = (k + q - 1) / q;
+    const std::size_t nb = (n + q - 1) / q;
+    EXPECT_EQ(task.GetVolume(), dense_gemm_all::ExpectedVolume(grid, task.GetLayer(), mb * kb, kb * nb, mb * nb));
+  }
+  if (world.rank() == 0) {
+    const auto expected = NaiveMultiply(a, b, m, k, n);
+    for (std::size_t i = 0; i < c.size(); ++i) {
+      ASSERT_NEAR(c[i], expected[i], 1e-9) << i << " on a " << grid.q << "x" << grid.q << "x" << grid.c << " grid";
+    }
+  }
+}
+
+}  // namespace
+
+TEST(dense_gemm_all, multiplies_1x1) { CheckAgainstNaive(1, 1, 1, 0); }
+
+TEST(dense_gemm_all, multiplies_square) { CheckAgainstNaive(128, 128, 128, 0); }
+
+TEST(dense_gemm_all, multiplies_odd_rectangular) { CheckAgainstNaive(37, 101, 59, 0); }
+
+TEST(dense_gemm_all, multiplies_smaller_than_the_grid) { CheckAgainstNaive(2, 1, 3, 0); }
+
+TEST(dense_gemm_all, plain_cannon_multiplies) { CheckAgainstNaive(65, 70, 75, 1); }
+
+TEST(dense_gemm_all, two_layers_multiply) { CheckAgainstNaive(65, 70, 75, 2); }
+
+TEST(dense_gemm_all, more_layers_than_steps_multiply) { CheckAgainstNaive(40, 40, 40, 3); }
+
+// Every rank turns the task down, not only rank 0 that holds the data
+TEST(dense_gemm_all, rejects_wrong_output_size) {
+  auto a = GenerateMatrix(4, 5, 4);
+  auto b = GenerateMatrix(5, 6, 5);
+  std::vector<double> c(4 * 5);
+  dense_gemm_all::GemmAll task(MakeTaskData(a, b, c, 4, 5, 6));
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(dense_gemm_all, grid_uses_most_processes) {
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(1).Size(), 1);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(4).c, 1);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(8).q, 2);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(8).c, 2);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(12).Size(), 9);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(16).c, 1);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(8, 1).Size(), 4);
+  EXPECT_EQ(dense_gemm_all::ChooseGrid(3, 2).Size(), 2);
+}
+
+TEST(dense_gemm_all, layers_cover_every_step_once) {
+  const dense_gemm_all::Grid25D grid{.q = 7, .c = 3};
+  int steps = 0;
+  for (int layer = 0; layer < grid.c; ++layer) {
+    EXPECT_EQ(grid.FirstStep(layer), steps);
+    steps += grid.Steps(layer);
+  }
+  EXPECT_EQ(steps, grid.q);
+}
+
+// The point of the replication: on many processes each one moves less than in Cannon on the same processes
+TEST(dense_gemm_all, replication_reduces_volume_at_scale) {
+  constexpr std::size_t kN = 4096;
+  auto per_process = [](const dense_gemm_all::Grid25D &grid) {
+    const std::size_t block = (kN / grid.q) * (kN / grid.q);
+    std::size_t worst = 0;
+    for (int layer = 0; layer < grid.c; ++layer) {
+      worst = std::max(worst, dense_gemm_all::ExpectedVolume(grid, layer, block, block, block).Total());
+    }
+    return worst;
+  };
+  const dense_gemm_all::Grid25D cannon{.q = 32, .c = 1};
+  const dense_gemm_all::Grid25D replicated{.q = 16, .c = 4};
+  ASSERT_EQ(cannon.Size(), replicated.Size());
+  EXPECT_LT(per_process(replicated), per_process(cannon));
+}
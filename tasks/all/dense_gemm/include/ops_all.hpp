@@ -0,0 +1,106 @@
+#pragma once
+
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+
+namespace dense_gemm_all {
+
+// Process grid of the 2.5D algorithm: c layers of q x q processes. Every layer runs Cannon's algorithm on
+// the same q x q blocks of A and B, but only over its share of the q steps, and the layers' partial
+// products are summed at the end. With c = 1 this is plain Cannon.
+struct Grid25D {
+  int q = 1;
+  int c = 1;
+
+  [[nodiscard]] int Size() const { return q * q * c; }
+  // Layer l does the Cannon steps [FirstStep(l), FirstStep(l + 1))
+  [[nodiscard]] int FirstStep(int layer) const { return layer * q / c; }
+  [[nodiscard]] int Steps(int layer) const { return FirstStep(layer + 1) - FirstStep(layer); }
+};
+
+// Grid on at most the given number of processes. replication = 0 picks the grid that uses the most of
+// them with c <= q, preferring fewer layers; otherwise c is the given number of layers.
+Grid25D ChooseGrid(int processes, int replication = 0);
+
+// Doubles that one process receives in each phase of the algorithm. Scattering A and B from rank 0 and
+// gathering C back are left out: they move the same data whatever the grid.
+struct CommunicationVolume {
+  // Blocks of A and B that layers other than 0 get from layer 0
+  std::size_t replicate = 0;
+  // Cannon shifts within a layer
+  std::size_t shift = 0;
+  // Partial products summed into layer 0
+  std::size_t reduce = 0;
+
+  [[nodiscard]] std::size_t Total() const { return replicate + shift + reduce; }
+  bool operator==(const CommunicationVolume &) const = default;
+};
+
+// Volume of a process of the given layer for blocks of A, B and C of the given numbers of elements.
+// Cannon on a q x q grid shifts 2 (q - 1) blocks through every process; 2.5D on c layers shifts
+// 2 (q / c - 1) and pays 2 blocks of replication and one of reduction instead, which is less once
+// q / c is large, i.e. for large process counts.
+CommunicationVolume ExpectedVolume(const Grid25D &grid, int layer, std::size_t a_block, std::size_t b_block,
+                                   std::size_t c_block);
+
+// inputs[0]  - row-major A (m x k), inputs[1] - row-major B (k x n)
+// inputs_count = {m, k, n}
+// outputs[0] - row-major C = A * B (m x n), outputs_count[0] == m * n
+// Only rank 0 needs the data. Each process multiplies its blocks with the threaded Gemm.
+class GemmAll : public ppc::core::Task {
+ public:
+  // replication is passed to ChooseGrid: 0 picks the number of layers, 1 runs plain Cannon
+  explicit GemmAll(ppc::core::TaskDataPtr task_data, int replication = 0)
+      : Task(std::move(task_data)), replication_(replication) {}
+
+  bool ValidationImpl() override;
+  bool PreProcessingImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  [[nodiscard]] const Grid25D &GetGrid() const { return grid_; }
+  // Layer of this process, -1 if the grid has no room for it
+  [[nodiscard]] int GetLayer() const { return layer_; }
+  [[nodiscard]] const CommunicationVolume &GetVolume() const { return volume_; }
+
+ private:
+  void Scatter();
+  void Replicate();
+  void MultiplyAndShift();
+  void ReduceAndGather();
+
+  // Copies block (bi, bj) of the rows x cols matrix src into a zero-padded block_rows x block_cols block
+  static void CopyBlock(const std::vector<double> &src, std::size_t rows, std::size_t cols, std::size_t bi,
+                        std::size_t bj, std::size_t block_rows, std::size_t block_cols, std::vector<double> &block);
+
+  int replication_;
+  boost::mpi::communicator world_;
+  Grid25D grid_;
+  int layer_ = -1;
+  int row_ = 0;
+  int col_ = 0;
+  // All the processes of the grid as (layer, row, column), the q x q grid of this layer, and the c
+  // processes of this (row, column) across the layers
+  std::optional<boost::mpi::cartesian_communicator> grid_comm_, layer_comm_, depth_comm_;
+
+  std::size_t m_{};
+  std::size_t k_{};
+  std::size_t n_{};
+  // Sides of the blocks; the matrices are zero-padded to q of them
+  std::size_t mb_{};
+  std::size_t kb_{};
+  std::size_t nb_{};
+  std::vector<double> a_, b_, c_;
+  std::vector<double> a_block_, b_block_, c_block_, a_next_, b_next_;
+  ppc::linalg::GemmWorkspace<double> workspace_;
+  CommunicationVolume volume_;
+};
+
+}  // namespace dense_gemm_all
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/dense_gemm/include/ops_all.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+constexpr std::size_t kSize = 1024;
+
+std::vector<double> GenerateMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+ppc::core::TaskDataPtr MakeTaskData(std::vector<double> &a, std::vector<double> &b, std::vector<double> &c) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data->inputs_count = {kSize, kSize, kSize};
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data->outputs_count.emplace_back(c.size());
+  return task_data;
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+// Checks one element of every row against a direct dot product
+void CheckSampledElements(const std::vector<double> &a, const std::vector<double> &b, const std::vector<double> &c) {
+  for (std::size_t i = 0; i < kSize; ++i) {
+    const std::size_t j = (i * 7) % kSize;
+    double expected = 0.0;
+    for (std::size_t p = 0; p < kSize; ++p) {
+      expected += a[(i * kSize) + p] * b[(p * kSize) + j];
+    }
+    ASSERT_NEAR(c[(i * kSize) + j], expected, 1e-8);
+  }
+}
+
+}  // namespace
+
+TEST(dense_gemm_all, test_pipeline_run) {
+  boost::mpi::communicator world;
+  auto a = GenerateMatrix(kSize, kSize, 1);
+  auto b = GenerateMatrix(kSize, kSize, 2);
+  std::vector<double> c(kSize * kSize);
+  auto task = std::make_shared<dense_gemm_all::GemmAll>(MakeTaskData(a, b, c));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  if (world.rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+    CheckSampledElements(a, b, c);
+  }
+}
+
+TEST(dense_gemm_all, test_task_run) {
+  boost::mpi::communicator world;
+  auto a = GenerateMatrix(kSize, kSize, 1);
+  auto b = GenerateMatrix(kSize, kSize, 2);
+  std::vector<double> c(kSize * kSize);
+  auto task = std::make_shared<dense_gemm_all::GemmAll>(MakeTaskData(a, b, c));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  if (world.rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+    CheckSampledElements(a, b, c);
+  }
+}
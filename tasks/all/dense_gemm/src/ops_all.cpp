@@ -0,0 +1,295 @@
+#include "all/dense_gemm/include/ops_all.hpp"
+
+#include <mpi.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/reduce.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+constexpr int kScatterTag = 0;
+constexpr int kReplicateATag = 1;
+constexpr int kReplicateBTag = 2;
+constexpr int kShiftATag = 3;
+constexpr int kShiftBTag = 4;
+constexpr int kGatherTag = 5;
+
+int Mod(int value, int q) { return ((value % q) + q) % q; }
+
+}  // namespace
+
+dense_gemm_all::Grid25D dense_gemm_all::ChooseGrid(int processes, int replication) {
+  processes = std::max(processes, 1);
+  if (replication > 0) {
+    Grid25D grid{.q = 1, .c = std::min(replication, processes)};
+    while ((grid.q + 1) * (grid.q + 1) * grid.c <= processes) {
+      ++grid.q;
+    }
+    return grid;
+  }
+  Grid25D best;
+  for (int q = 1; q * q <= processes; ++q) {
+    const Grid25D grid{.q = q, .c = std::min(q, processes / (q * q))};
+    if (grid.Size() >= best.Size()) {
+      best = grid;
+    }
+  }
+  return best;
+}
+
+dense_gemm_all::CommunicationVolume dense_gemm_all::ExpectedVolume(const Grid25D &grid, int layer, std::size_t a_block,
+                                                                   std::size_t b_block, std::size_t c_block) {
+  CommunicationVolume volume;
+  const auto steps = static_cast<std::size_t>(grid.Steps(layer));
+  if (layer > 0 && steps > 0) {
+    volume.replicate = a_block + b_block;
+  }
+  if (steps > 1) {
+    volume.shift = (steps - 1) * (a_block + b_block);
+  }
+  if (layer == 0) {
+    volume.reduce = static_cast<std::size_t>(grid.c - 1) * c_block;
+  }
+  return volume;
+}
+
+bool dense_gemm_all::GemmAll::ValidationImpl() {
+  // Only rank 0 has the task data, and every rank has to agree with it
+  bool valid = false;
+  if (world_.rank() == 0) {
+    valid = task_data->inputs.size() == 2 && task_data->inputs_count.size() == 3 && task_data->outputs.size() == 1 &&
+            task_data->outputs_count.size() == 1 &&
+            task_data->outputs_count[0] == task_data->inputs_count[0] * task_data->inputs_count[2];
+  }
+  boost::mpi::broadcast(world_, valid, 0);
+  return valid;
+}
+
+bool dense_gemm_all::GemmAll::PreProcessingImpl() {
+  if (world_.rank() == 0) {
+    m_ = task_data->inputs_count[0];
+    k_ = task_data->inputs_count[1];
+    n_ = task_data->inputs_count[2];
+    auto *a_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
+    auto *b_ptr = reinterpret_cast<double *>(task_data->inputs[1]);
+    a_ = std::vector<double>(a_ptr, a_ptr + (m_ * k_));
+    b_ = std::vector<double>(b_ptr, b_ptr + (k_ * n_));
+    c_ = std::vector<double>(m_ * n_);
+  }
+  std::array<std::size_t, 3> sizes = {m_, k_, n_};
+  boost::mpi::broadcast(world_, sizes.data(), static_cast<int>(sizes.size()), 0);
+  m_ = sizes[0];
+  k_ = sizes[1];
+  n_ = sizes[2];
+
+  grid_ = ChooseGrid(world_.size(), replication_);
+  const auto q = static_cast<std::size_t>(grid_.q);
+  mb_ = (m_ + q - 1) / q;
+  kb_ = (k_ + q - 1) / q;
+  nb_ = (n_ + q - 1) / q;
+  volume_ = {};
+
+  // Processes past the grid get a null communicator and sit the run out
+  const bool in_grid = world_.rank() < grid_.Size();
+  const boost::mpi::communicator grid_members = world_.split(in_grid ? 0 : MPI_UNDEFINED);
+  if (!in_grid) {
+    layer_ = -1;
+    return true;
+  }
+  const std::vector<boost::mpi::cartesian_dimension> dims = {
+      boost::mpi::cartesian_dimension(grid_.c), boost::mpi::cartesian_dimension(grid_.q, true),
+      boost::mpi::cartesian_dimension(grid_.q, true)};
+  grid_comm_.emplace(grid_members, boost::mpi::cartesian_topology(dims));
+  const std::vector<int> coords = grid_comm_->coordinates(grid_comm_->rank());
+  layer_ = coords[0];
+  row_ = coords[1];
+  col_ = coords[2];
+  layer_comm_.emplace(*grid_comm_, std::vector<int>{1, 2});
+  depth_comm_.emplace(*grid_comm_, std::vector<int>{0});
+
+  a_block_.assign(mb_ * kb_, 0.0);
+  b_block_.assign(kb_ * nb_, 0.0);
+  c_block_.assign(mb_ * nb_, 0.0);
+  a_next_.resize(a_block_.size());
+  b_next_.resize(b_block_.size());
+  return true;
+}
+
+void dense_gemm_all::GemmAll::CopyBlock(const std::vector<double> &src, std::size_t rows, std::size_t cols,
+                                        std::size_t bi, std::size_t bj, std::size_t block_rows,
+                                        std::size_t block_cols, std::vector<double> &block) {
+  std::ranges::fill(block, 0.0);
+  const std::size_t row_begin = std::min(rows, bi * block_rows);
+  const std::size_t row_end = std::min(rows, row_begin + block_rows);
+  const std::size_t col_begin = std::min(cols, bj * block_cols);
+  const std::size_t col_end = std::min(cols, col_begin + block_cols);
+  for (std::size_t i = row_begin; i < row_end; ++i) {
+    std::copy(src.begin() + static_cast<std::ptrdiff_t>((i * cols) + col_begin),
+              src.begin() + static_cast<std::ptrdiff_t>((i * cols) + col_end),
+              block.begin() + static_cast<std::ptrdiff_t>((i - row_begin) * block_cols));
+  }
+}
+
+// Rank 0 hands layer 0 its blocks already skewed for the first Cannon step, so that the usual initial
+// shifts are not needed
+void dense_gemm_all::GemmAll::Scatter() {
+  if (layer_ != 0) {
+    return;
+  }
+  const auto a_size = static_cast<int>(a_block_.size());
+  const auto b_size = static_cast<int>(b_block_.size());
+  if (grid_comm_->rank() != 0) {
+    grid_comm_->recv(0, kScatterTag, a_block_.data(), a_size);
+    grid_comm_->recv(0, kScatterTag, b_block_.data(), b_size);
+    return;
+  }
+  std::vector<double> a_send(a_block_.size());
+  std::vector<double> b_send(b_block_.size());
+  const auto q = static_cast<std::size_t>(grid_.q);
+  for (std::size_t i = 0; i < q; ++i) {
+    for (std::size_t j = 0; j < q; ++j) {
+      const std::size_t inner = ppc::linalg::CannonBlock(i, j, 0, q);
+      const int dest = grid_comm_->rank({0, static_cast<int>(i), static_cast<int>(j)});
+      CopyBlock(a_, m_, k_, i, inner, mb_, kb_, dest == 0 ? a_block_ : a_send);
+      CopyBlock(b_, k_, n_, inner, j, kb_, nb_, dest == 0 ? b_block_ : b_send);
+      if (dest != 0) {
+        grid_comm_->send(dest, kScatterTag, a_send.data(), a_size);
+        grid_comm_->send(dest, kScatterTag, b_send.data(), b_size);
+      }
+    }
+  }
+}
+
+// Layer l starts at step s = FirstStep(l). The blocks it needs for that step are those that layer 0
+// holds s columns to the right for A and s rows down for B, so each layer gets them in one message
+// instead of a broadcast followed by s shifts.
+void dense_gemm_all::GemmAll::Replicate() {
+  const auto a_size = static_cast<int>(a_block_.size());
+  const auto b_size = static_cast<int>(b_block_.size());
+  if (layer_ == 0) {
+    std::vector<boost::mpi::request> requests;
+    for (int layer = 1; layer < grid_.c; ++layer) {
+      const int shift = grid_.FirstStep(layer);
+      if (grid_.Steps(layer) == 0) {
+        continue;
+      }
+      requests.push_back(grid_comm_->isend(grid_comm_->rank({layer, row_, Mod(col_ - shift, grid_.q)}),
+                                           kReplicateATag, a_block_.data(), a_size));
+      requests.push_back(grid_comm_->isend(grid_comm_->rank({layer, Mod(row_ - shift, grid_.q), col_}),
+                                           kReplicateBTag, b_block_.data(), b_size));
+    }
+    boost::mpi::wait_all(requests.begin(), requests.end());
+  } else if (grid_.Steps(layer_) > 0) {
+    const int shift = grid_.FirstStep(layer_);
+    grid_comm_->recv(grid_comm_->rank({0, row_, (col_ + shift) % grid_.q}), kReplicateATag, a_block_.data(), a_size);
+    grid_comm_->recv(grid_comm_->rank({0, (row_ + shift) % grid_.q, col_}), kReplicateBTag, b_block_.data(), b_size);
+    volume_.replicate += a_block_.size() + b_block_.size();
+  }
+}
+
+// The shifts for the next step are in flight while the current blocks are multiplied
+void dense_gemm_all::GemmAll::MultiplyAndShift() {
+  const int steps = grid_.Steps(layer_);
+  const auto a_size = static_cast<int>(a_block_.size());
+  const auto b_size = static_cast<int>(b_block_.size());
+  const auto [a_source, a_dest] = layer_comm_->shifted_ranks(1, -1);
+  const auto [b_source, b_dest] = layer_comm_->shifted_ranks(0, -1);
+  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+  for (int step = 0; step < steps; ++step) {
+    const bool shift = step + 1 < steps;
+    std::array<boost::mpi::request, 4> requests;
+    if (shift) {
+      requests = {layer_comm_->isend(a_dest, kShiftATag, a_block_.data(), a_size),
+                  layer_comm_->irecv(a_source, kShiftATag, a_next_.data(), a_size),
+                  layer_comm_->isend(b_dest, kShiftBTag, b_block_.data(), b_size),
+                  layer_comm_->irecv(b_source, kShiftBTag, b_next_.data(), b_size)};
+    }
+    arena.execute([&] {
+      ppc::linalg::Gemm(mb_, nb_, kb_, 1.0, a_block_.data(), kb_, b_block_.data(), nb_, 1.0, c_block_.data(), nb_,
+                        workspace_, ppc::linalg::TbbFor{});
+    });
+    if (shift) {
+      boost::mpi::wait_all(requests.begin(), requests.end());
+      std::swap(a_block_, a_next_);
+      std::swap(b_block_, b_next_);
+      volume_.shift += a_block_.size() + b_block_.size();
+    }
+  }
+}
+
+void dense_gemm_all::GemmAll::ReduceAndGather() {
+  const auto c_size = static_cast<int>(c_block_.size());
+  if (grid_.c > 1) {
+    if (layer_ == 0) {
+      std::vector<double> sum(c_block_.size());
+      boost::mpi::reduce(*depth_comm_, c_block_.data(), c_size, sum.data(), std::plus<double>(), 0);
+      c_block_ = std::move(sum);
+      volume_.reduce += static_cast<std::size_t>(grid_.c - 1) * c_block_.size();
+    } else {
+      boost::mpi::reduce(*depth_comm_, c_block_.data(), c_size, std::plus<double>(), 0);
+    }
+  }
+  if (layer_ != 0) {
+    return;
+  }
+  if (grid_comm_->rank() != 0) {
+    grid_comm_->send(0, kGatherTag, c_block_.data(), c_size);
+    return;
+  }
+  std::vector<double> block(c_block_.size());
+  for (int i = 0; i < grid_.q; ++i) {
+    for (int j = 0; j < grid_.q; ++j) {
+      const int source = grid_comm_->rank({0, i, j});
+      if (source == 0) {
+        block = c_block_;
+      } else {
+        grid_comm_->recv(source, kGatherTag, block.data(), c_size);
+      }
+      const std::size_t row_begin = std::min(m_, static_cast<std::size_t>(i) * mb_);
+      const std::size_t row_end = std::min(m_, row_begin + mb_);
+      const std::size_t col_begin = std::min(n_, static_cast<std::size_t>(j) * nb_);
+      const std::size_t col_end = std::min(n_, col_begin + nb_);
+      for (std::size_t row = row_begin; row < row_end; ++row) {
+        std::copy(block.begin() + static_cast<std::ptrdiff_t>((row - row_begin) * nb_),
+                  block.begin() + static_cast<std::ptrdiff_t>((row - row_begin) * nb_ + (col_end - col_begin)),
+                  c_.begin() + static_cast<std::ptrdiff_t>((row * n_) + col_begin));
+      }
+    }
+  }
+}
+
+bool dense_gemm_all::GemmAll::RunImpl() {
+  if (layer_ < 0) {
+    return true;
+  }
+  volume_ = {};
+  std::ranges::fill(c_block_, 0.0);
+  Scatter();
+  Replicate();
+  MultiplyAndShift();
+  ReduceAndGather();
+  return true;
+}
+
+bool dense_gemm_all::GemmAll::PostProcessingImpl() {
+  if (world_.rank() == 0) {
+    std::ranges::copy(c_, reinterpret_cast<double *>(task_data->outputs[0]));
+  }
+  return true;
+}
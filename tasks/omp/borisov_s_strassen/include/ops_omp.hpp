@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/strassen.hpp"
 #include "core/task/include/task.hpp"
 
 namespace borisov_s_strassen_omp {
@@ -25,6 +26,8 @@ class ParallelStrassenOMP : public ppc::core::Task {
   int colsA_ = 0;
   int rowsB_ = 0;
   int colsB_ = 0;
+
+  ppc::linalg::StrassenWorkspace<double> workspace_;
 };
 
 }  // namespace borisov_s_strassen_omp
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/batched_gemm.hpp"
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/task/include/task.hpp"
+
+namespace dense_gemm_omp {
+
+// inputs[0]  - row-major A (m x k), inputs[1] - row-major B (k x n), both of In
+// inputs_count = {m, k, n} or {m, k, n, batch}
+// outputs[0] - row-major C = A * B (m x n) of In, outputs_count[0] == batch * m * n
+// With a batch, A, B and C hold that many matrices one after another and every A_i is multiplied by
+// its B_i, which for small matrices costs far less than a task per product.
+// The products are summed in Acc: GemmOpenMP<float, double> takes and returns float but accumulates
+// in double, which costs the memory traffic of float and loses only the final rounding.
+template <typename In = double, typename Acc = In>
+class GemmOpenMP : public ppc::core::Task {
+ public:
+  explicit GemmOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override {
+    m_ = task_data->inputs_count[0];
+    k_ = task_data->inputs_count[1];
+    n_ = task_data->inputs_count[2];
+    batch_ = task_data->inputs_count.size() > 3 ? task_data->inputs_count[3] : 1;
+    auto *a_ptr = reinterpret_cast<In *>(task_data->inputs[0]);
+    auto *b_ptr = reinterpret_cast<In *>(task_data->inputs[1]);
+    a_ = std::vector<In>(a_ptr, a_ptr + (batch_ * m_ * k_));
+    b_ = std::vector<In>(b_ptr, b_ptr + (batch_ * k_ * n_));
+    c_ = std::vector<Acc>(batch_ * m_ * n_);
+    return true;
+  }
+
+  bool ValidationImpl() override {
+    const auto &counts = task_data->inputs_count;
+    if (task_data->inputs.size() != 2 || (counts.size() != 3 && counts.size() != 4) ||
+        task_data->outputs.size() != 1 || task_data->outputs_count.size() != 1) {
+      return false;
+    }
+    const std::size_t batch = counts.size() > 3 ? counts[3] : 1;
+    return task_data->outputs_count[0] == batch * counts[0] * counts[2];
+  }
+
+  bool RunImpl() override {
+    ppc::linalg::BatchedGemm(batch_, m_, n_, k_, Acc{1}, a_.data(), k_, m_ * k_, b_.data(), n_, k_ * n_, Acc{0},
+                             c_.data(), n_, m_ * n_, workspace_, ppc::linalg::OmpFor{});
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    std::ranges::transform(c_, reinterpret_cast<In *>(task_data->outputs[0]),
+                           [](Acc value) { return static_cast<In>(value); });
+    return true;
+  }
+
+ private:
+  std::size_t m_{};
+  std::size_t k_{};
+  std::size_t n_{};
+  std::size_t batch_{};
+  std::vector<In> a_, b_;
+  std::vector<Acc> c_;
+  ppc::linalg::GemmWorkspace<Acc> workspace_;
+};
+
+}  // namespace dense_gemm_omp
@@ -364,3 +364,34 @@ TEST(deryabin_m_hoare_sort_simple_merge_omp, test_invalid_chunk_count) {
   deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP hoare_sort_task_openmp(task_data_omp);
   ASSERT_EQ(hoare_sort_task_openmp.Validation(), false);
 }
+
+TEST(deryabin_m_hoare_sort_simple_merge_omp, test_large_array_few_unique_elements) {
+  // Create data
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> distribution(0, 3);
+  std::vector<double> input_array(300000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 8;
+  std::vector<double> output_array(300000);
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  // Create TaskData
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_omp->inputs_count.emplace_back(input_array.size());
+  task_data_omp->inputs_count.emplace_back(chunk_count);
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_omp->outputs_count.emplace_back(output_array.size());
+
+  // Create Task
+  deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP hoare_sort_task_omp(task_data_omp);
+  ASSERT_EQ(hoare_sort_task_omp.Validation(), true);
+  hoare_sort_task_omp.PreProcessing();
+  hoare_sort_task_omp.Run();
+  hoare_sort_task_omp.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
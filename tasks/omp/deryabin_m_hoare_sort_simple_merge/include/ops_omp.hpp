@@ -38,7 +38,5 @@ class HoareSortTaskOpenMP : public ppc::core::Task {
  private:
   std::vector<double> input_array_A_;  // входной массив
   size_t dimension_;                   // его размер
-  size_t min_chunk_size_;  // размер частей на которые будет разбиваться исходный массив
-  size_t chunk_count_;  // число таких частей
 };
 }  // namespace deryabin_m_hoare_sort_simple_merge_omp
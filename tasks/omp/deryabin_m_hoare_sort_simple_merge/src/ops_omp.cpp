@@ -3,9 +3,13 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <numbers>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sort/include/quick_sort.hpp"
+
 void deryabin_m_hoare_sort_simple_merge_omp::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   size_t i = first;
   size_t j = last;
@@ -102,8 +106,6 @@ bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskSequential::PostProces
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::PreProcessingImpl() {
   input_array_A_ = reinterpret_cast<std::vector<double>*>(task_data->inputs[0])[0];
   dimension_ = task_data->inputs_count[0];
-  chunk_count_ = task_data->inputs_count[1];
-  min_chunk_size_ = dimension_ / chunk_count_;
   return true;
 }
 
@@ -114,24 +116,8 @@ bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::ValidationImpl
 }
 
 bool deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP::RunImpl() {
-  auto chunk_count = (short)chunk_count_;
-#pragma omp parallel for
-  for (short count = 0; count < chunk_count; count++) {
-    HoaraSort(input_array_A_, count * (short)min_chunk_size_, ((count + 1) * (short)min_chunk_size_) - 1);
-  }
-#pragma omp barrier
-#pragma omp parallel for ordered
-  for (short i = 0; i < (short)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-#pragma omp ordered
-    {
-      for (short j = 0; j < chunk_count; j++) {
-        MergeTwoParts(input_array_A_, j * (short)min_chunk_size_ << (i + 1),
-                      ((j + 1) * (short)min_chunk_size_ << (i + 1)) - 1, dimension_);
-        chunk_count--;
-      }
-    }
-  }
-#pragma omp barrier
+  // параллельная быстрая сортировка на месте, без разбиения на части и слияния
+  ppc::sort::ParallelHoareSort(input_array_A_.data(), dimension_, std::less<>(), ppc::linalg::OmpTaskFor{});
   return true;
 }
 
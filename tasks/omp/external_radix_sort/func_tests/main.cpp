@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <omp.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "omp/external_radix_sort/include/ops_omp.hpp"
+
+namespace {
+
+std::vector<int> GenerateRandomVector(size_t size, int min_val = std::numeric_limits<int>::min(),
+                                      int max_val = std::numeric_limits<int>::max()) {
+  std::vector<int> vec(size);
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dis(min_val, max_val);
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+std::string TempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / ("external_radix_sort_omp_" + name)).string();
+}
+
+void WriteFile(const std::string &path, const std::vector<int> &data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+}
+
+std::vector<int> ReadFile(const std::string &path) {
+  std::vector<int> data(std::filesystem::file_size(path) / sizeof(int));
+  std::ifstream in(path, std::ios::binary);
+  in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+
+void RunExternalSort(const std::vector<int> &input, std::size_t budget, const std::string &name) {
+  std::string in_path = TempPath(name + "_in.bin");
+  std::string out_path = TempPath(name + "_out.bin");
+  WriteFile(in_path, input);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_path.data()));
+  task_data->inputs_count.emplace_back(in_path.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_path.data()));
+  task_data->outputs_count.emplace_back(out_path.size());
+
+  external_radix_sort_omp::ExternalRadixSortOMP task(task_data);
+  ASSERT_TRUE(task.Validation());
+  ASSERT_TRUE(task.PreProcessing());
+  ASSERT_TRUE(task.Run());
+  ASSERT_TRUE(task.PostProcessing());
+
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  EXPECT_EQ(ReadFile(out_path), expected);
+  EXPECT_FALSE(std::filesystem::exists(out_path + ".runs"));
+
+  std::filesystem::remove(in_path);
+  std::filesystem::remove(out_path);
+}
+
+}  // namespace
+
+TEST(external_radix_sort_omp, fits_in_budget) { RunExternalSort(GenerateRandomVector(1000), 1 << 20, "fits"); }
+
+TEST(external_radix_sort_omp, many_runs) { RunExternalSort(GenerateRandomVector(100000), 1 << 14, "many_runs"); }
+
+TEST(external_radix_sort_omp, uneven_last_run) {
+  RunExternalSort(GenerateRandomVector(12345, -100, 100), 1 << 12, "uneven_last_run");
+}
+
+TEST(external_radix_sort_omp, all_equal) { RunExternalSort(std::vector<int>(20000, -7), 1 << 12, "all_equal"); }
+
+TEST(external_radix_sort_omp, reverse_sorted) {
+  std::vector<int> input(30000);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<int>(input.size() - i) - 15000;
+  }
+  RunExternalSort(input, 1 << 13, "reverse_sorted");
+}
+
+TEST(external_radix_sort_omp, empty_file) { RunExternalSort({}, 1 << 12, "empty_file"); }
+
+TEST(external_radix_sort_omp, radix_kernel) {
+  std::vector<int> data = GenerateRandomVector(5000);
+  std::vector<int> buffer;
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+  external_radix_sort_omp::ExternalRadixSortOMP::RadixSort(data, buffer);
+  EXPECT_EQ(data, expected);
+}
+
+// Only the low byte differs, so the other three passes put everything in one bucket and are skipped. Every pass
+// that runs scatters into the scratch buffer and swaps it with data, so after the single low-byte pass the
+// buffer holds the input as it was; four passes would leave the output of the third one there.
+TEST(external_radix_sort_omp, radix_kernel_skips_single_bucket_passes) {
+  std::vector<int> data(5000);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int>((i * 7919) % 256);
+  }
+  const std::vector<int> input = data;
+  std::vector<int> buffer;
+  std::vector<int> expected = data;
+  std::ranges::sort(expected);
+  external_radix_sort_omp::ExternalRadixSortOMP::RadixSort(data, buffer);
+  EXPECT_EQ(data, expected);
+  EXPECT_EQ(buffer, input);
+}
+
+// One thread takes every part, so a failure of an early part must survive the parts after it
+TEST(external_radix_sort_omp, merge_parts_reports_a_failed_part) {
+  const int threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  EXPECT_FALSE(external_radix_sort_omp::ExternalRadixSortOMP::MergeParts(4, [](int t) { return t != 0; }));
+  EXPECT_TRUE(external_radix_sort_omp::ExternalRadixSortOMP::MergeParts(4, [](int) { return true; }));
+  omp_set_num_threads(threads);
+  EXPECT_FALSE(external_radix_sort_omp::ExternalRadixSortOMP::MergeParts(8, [](int t) { return t != 5; }));
+}
+
+TEST(external_radix_sort_omp, validation_missing_file) {
+  std::string in_path = TempPath("does_not_exist.bin");
+  std::string out_path = TempPath("does_not_exist_out.bin");
+  std::size_t budget = 1 << 20;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_path.data()));
+  task_data->inputs_count.emplace_back(in_path.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_path.data()));
+  task_data->outputs_count.emplace_back(out_path.size());
+
+  external_radix_sort_omp::ExternalRadixSortOMP task(task_data);
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(external_radix_sort_omp, validation_small_budget) {
+  std::string in_path = TempPath("small_budget_in.bin");
+  std::string out_path = TempPath("small_budget_out.bin");
+  WriteFile(in_path, GenerateRandomVector(10));
+  std::size_t budget = 16;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_path.data()));
+  task_data->inputs_count.emplace_back(in_path.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_path.data()));
+  task_data->outputs_count.emplace_back(out_path.size());
+
+  external_radix_sort_omp::ExternalRadixSortOMP task(task_data);
+  EXPECT_FALSE(task.Validation());
+  std::filesystem::remove(in_path);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace external_radix_sort_omp {
+
+// Out-of-core sort of a binary file of int32 values.
+//
+// inputs[0]  - path of the input file (inputs_count[0] is the path length)
+// inputs[1]  - std::size_t memory budget in bytes (inputs_count[1] == 1)
+// outputs[0] - path of the output file (outputs_count[0] is the path length)
+//
+// The input is streamed in chunks that fit the budget, every chunk is sorted with a
+// parallel LSD radix sort and spilled to disk as a run, and the runs are merged by all
+// threads at once, each one owning a disjoint key range of the output file.
+class ExternalRadixSortOMP : public ppc::core::Task {
+ public:
+  explicit ExternalRadixSortOMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  static void RadixSort(std::vector<int> &data, std::vector<int> &buffer);
+  // Runs merge_part(t) for every part t < parts on all threads; true if every part succeeded
+  static bool MergeParts(int parts, const std::function<bool(int)> &merge_part);
+
+ private:
+  struct SortedRun {
+    std::filesystem::path path;
+    std::uint64_t size;
+  };
+
+  std::filesystem::path input_path_, output_path_, runs_dir_;
+  std::uint64_t size_{};
+  std::size_t budget_{};
+  std::vector<SortedRun> runs_;
+
+  bool SpillRuns();
+  bool MergeRuns();
+};
+
+}  // namespace external_radix_sort_omp
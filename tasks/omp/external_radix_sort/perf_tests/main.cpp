@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/external_radix_sort/include/ops_omp.hpp"
+
+namespace {
+
+constexpr size_t kNumElements = 20000000;
+constexpr size_t kBudget = size_t{16} << 20;
+
+std::vector<int> GenerateRandomVector(size_t size) {
+  std::vector<int> vec(size);
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dis;
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+std::string TempPath(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / ("external_radix_sort_omp_perf_" + name)).string();
+}
+
+void WriteFile(const std::string &path, const std::vector<int> &data) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+}
+
+std::vector<int> ReadFile(const std::string &path) {
+  std::vector<int> data(std::filesystem::file_size(path) / sizeof(int));
+  std::ifstream in(path, std::ios::binary);
+  in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(int)));
+  return data;
+}
+
+void RunPerf(bool pipeline, const std::string &name) {
+  std::vector<int> input = GenerateRandomVector(kNumElements);
+  std::string in_path = TempPath(name + "_in.bin");
+  std::string out_path = TempPath(name + "_out.bin");
+  WriteFile(in_path, input);
+  size_t budget = kBudget;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in_path.data()));
+  task_data->inputs_count.emplace_back(in_path.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&budget));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_path.data()));
+  task_data->outputs_count.emplace_back(out_path.size());
+
+  auto task = std::make_shared<external_radix_sort_omp::ExternalRadixSortOMP>(task_data);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  if (pipeline) {
+    perf_analyzer->PipelineRun(perf_attr, perf_results);
+  } else {
+    perf_analyzer->TaskRun(perf_attr, perf_results);
+  }
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  std::ranges::sort(input);
+  EXPECT_EQ(ReadFile(out_path), input);
+
+  std::filesystem::remove(in_path);
+  std::filesystem::remove(out_path);
+}
+
+}  // namespace
+
+TEST(external_radix_sort_omp, test_pipeline_run) { RunPerf(true, "pipeline"); }
+
+TEST(external_radix_sort_omp, test_task_run) { RunPerf(false, "task_run"); }
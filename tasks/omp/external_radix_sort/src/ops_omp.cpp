@@ -0,0 +1,405 @@
+#include "omp/external_radix_sort/include/ops_omp.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <ios>
+#include <memory>
+#include <queue>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kMinBudget = std::size_t{1} << 12;
+constexpr std::size_t kMinMergeBlock = 1024;
+constexpr std::size_t kSamplesPerRun = 64;
+
+std::vector<int> ReadBlock(std::ifstream &in, std::size_t count) {
+  std::vector<int> block(count);
+  in.read(reinterpret_cast<char *>(block.data()), static_cast<std::streamsize>(count * sizeof(int)));
+  block.resize(static_cast<std::size_t>(in.gcount()) / sizeof(int));
+  return block;
+}
+
+bool WriteBlock(const std::filesystem::path &path, const std::vector<int> &block) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size() * sizeof(int)));
+  return out.good();
+}
+
+int ReadValue(std::ifstream &in, std::uint64_t index) {
+  int value = 0;
+  in.seekg(static_cast<std::streamoff>(index * sizeof(int)));
+  in.read(reinterpret_cast<char *>(&value), sizeof(int));
+  return value;
+}
+
+// Position of the first element of a sorted run that is not less than value
+std::uint64_t LowerBound(std::ifstream &in, std::uint64_t size, int value) {
+  std::uint64_t low = 0;
+  std::uint64_t high = size;
+  while (low < high) {
+    const std::uint64_t mid = low + ((high - low) / 2);
+    if (ReadValue(in, mid) < value) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
+}
+
+// Sequential reader of [begin, end) of a run; the next block is fetched in the background
+// while the current one is consumed by the merge.
+class BlockReader {
+ public:
+  BlockReader(const std::filesystem::path &path, std::uint64_t begin, std::uint64_t end, std::size_t block)
+      : stream_(path, std::ios::binary), left_(end - begin), block_(block) {
+    stream_.seekg(static_cast<std::streamoff>(begin * sizeof(int)));
+    Prefetch();
+    Advance();
+  }
+
+  BlockReader(const BlockReader &) = delete;
+  BlockReader &operator=(const BlockReader &) = delete;
+  BlockReader(BlockReader &&) = delete;
+  BlockReader &operator=(BlockReader &&) = delete;
+  ~BlockReader() {
+    if (pending_.valid()) {
+      pending_.wait();
+    }
+  }
+
+  [[nodiscard]] bool Empty() const { return cursor_ == current_.size(); }
+  [[nodiscard]] int Front() const { return current_[cursor_]; }
+
+  void Pop() {
+    if (++cursor_ == current_.size()) {
+      Advance();
+    }
+  }
+
+ private:
+  std::ifstream stream_;
+  std::uint64_t left_;
+  std::size_t block_;
+  std::vector<int> current_;
+  std::size_t cursor_{};
+  std::future<std::vector<int>> pending_;
+
+  void Prefetch() {
+    const auto count = static_cast<std::size_t>(std::min<std::uint64_t>(block_, left_));
+    left_ -= count;
+    pending_ = std::async(std::launch::async, ReadBlock, std::ref(stream_), count);
+  }
+
+  void Advance() {
+    current_.clear();
+    cursor_ = 0;
+    if (pending_.valid()) {
+      current_ = pending_.get();
+    }
+    if (!current_.empty() && left_ != 0) {
+      Prefetch();
+    }
+  }
+};
+
+// Writer of a contiguous slice of the output file; full blocks are flushed in the background
+class BlockWriter {
+ public:
+  BlockWriter(const std::filesystem::path &path, std::uint64_t offset, std::size_t block)
+      : stream_(path, std::ios::binary | std::ios::in | std::ios::out), block_(block) {
+    stream_.seekp(static_cast<std::streamoff>(offset * sizeof(int)));
+    buffer_.reserve(block_);
+  }
+
+  BlockWriter(const BlockWriter &) = delete;
+  BlockWriter &operator=(const BlockWriter &) = delete;
+  BlockWriter(BlockWriter &&) = delete;
+  BlockWriter &operator=(BlockWriter &&) = delete;
+  ~BlockWriter() { Wait(); }
+
+  void Push(int value) {
+    buffer_.push_back(value);
+    if (buffer_.size() == block_) {
+      Flush();
+    }
+  }
+
+  // Returns the number of elements that reached the file
+  std::uint64_t Finish() {
+    Flush();
+    Wait();
+    return stream_.good() ? written_ : 0;
+  }
+
+ private:
+  std::fstream stream_;
+  std::size_t block_;
+  std::vector<int> buffer_, flushing_;
+  std::uint64_t written_{};
+  std::future<void> pending_;
+
+  void Wait() {
+    if (pending_.valid()) {
+      pending_.get();
+    }
+  }
+
+  void Flush() {
+    Wait();
+    std::swap(buffer_, flushing_);
+    buffer_.clear();
+    written_ += flushing_.size();
+    pending_ = std::async(std::launch::async, [this] {
+      stream_.write(reinterpret_cast<const char *>(flushing_.data()),
+                    static_cast<std::streamsize>(flushing_.size() * sizeof(int)));
+    });
+  }
+};
+
+}  // namespace
+
+void external_radix_sort_omp::ExternalRadixSortOMP::RadixSort(std::vector<int> &data, std::vector<int> &buffer) {
+  const auto n = static_cast<std::int64_t>(data.size());
+  buffer.resize(data.size());
+  std::vector<std::array<std::int64_t, 256>> hist;
+
+  for (unsigned int shift = 0; shift < 32; shift += 8) {
+    const unsigned int flip = shift == 24 ? 0x80U : 0U;
+    bool skip = false;
+#pragma omp parallel
+    {
+      const int nth = omp_get_num_threads();
+      const int tid = omp_get_thread_num();
+#pragma omp single
+      hist.assign(nth, {});
+
+      const std::int64_t begin = n * tid / nth;
+      const std::int64_t end = n * (tid + 1) / nth;
+      auto &local = hist[tid];
+      for (std::int64_t i = begin; i < end; ++i) {
+        ++local[((static_cast<unsigned int>(data[i]) >> shift) & 0xFFU) ^ flip];
+      }
+#pragma omp barrier
+#pragma omp single
+      {
+        // A pass that puts everything in one bucket leaves the order as it is, which only the counts of
+        // all the threads together can tell
+        std::int64_t offset = 0;
+        for (std::size_t digit = 0; digit < 256; ++digit) {
+          std::int64_t total = 0;
+          for (const auto &h : hist) {
+            total += h[digit];
+          }
+          skip = skip || total == n;
+        }
+        // Exclusive scan in (digit, thread) order keeps the pass stable
+        for (std::size_t digit = 0; digit < 256 && !skip; ++digit) {
+          for (auto &h : hist) {
+            const std::int64_t count = h[digit];
+            h[digit] = offset;
+            offset += count;
+          }
+        }
+      }
+      if (!skip) {
+        for (std::int64_t i = begin; i < end; ++i) {
+          buffer[local[((static_cast<unsigned int>(data[i]) >> shift) & 0xFFU) ^ flip]++] = data[i];
+        }
+      }
+    }
+    if (!skip) {
+      std::swap(data, buffer);
+    }
+  }
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::MergeParts(int parts, const std::function<bool(int)> &merge_part) {
+  bool ok = true;
+  // A thread can take several parts, so its copy of ok has to keep the failures of all of them
+#pragma omp parallel for schedule(dynamic, 1) reduction(&& : ok)
+  for (int t = 0; t < parts; ++t) {
+    ok = merge_part(t) && ok;
+  }
+  return ok;
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::PreProcessingImpl() {
+  input_path_ = std::string(reinterpret_cast<char *>(task_data->inputs[0]), task_data->inputs_count[0]);
+  output_path_ = std::string(reinterpret_cast<char *>(task_data->outputs[0]), task_data->outputs_count[0]);
+  budget_ = *reinterpret_cast<std::size_t *>(task_data->inputs[1]);
+  size_ = std::filesystem::file_size(input_path_) / sizeof(int);
+
+  runs_dir_ = output_path_;
+  runs_dir_ += ".runs";
+  return true;
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::ValidationImpl() {
+  if (task_data->inputs.size() != 2 || task_data->inputs_count.size() != 2 || task_data->outputs.size() != 1 ||
+      task_data->outputs_count.size() != 1 || task_data->inputs_count[1] != 1) {
+    return false;
+  }
+  if (task_data->inputs[0] == nullptr || task_data->inputs[1] == nullptr || task_data->outputs[0] == nullptr ||
+      task_data->inputs_count[0] == 0 || task_data->outputs_count[0] == 0) {
+    return false;
+  }
+  const std::filesystem::path input(
+      std::string(reinterpret_cast<char *>(task_data->inputs[0]), task_data->inputs_count[0]));
+  std::error_code ec;
+  const auto bytes = std::filesystem::file_size(input, ec);
+  return !ec && bytes % sizeof(int) == 0 && *reinterpret_cast<std::size_t *>(task_data->inputs[1]) >= kMinBudget;
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::RunImpl() {
+  runs_.clear();
+  std::filesystem::remove_all(runs_dir_);
+  std::filesystem::create_directories(runs_dir_);
+
+  if (!SpillRuns()) {
+    return false;
+  }
+  if (runs_.empty()) {
+    return std::ofstream(output_path_, std::ios::binary | std::ios::trunc).good();
+  }
+  if (runs_.size() == 1) {
+    std::filesystem::rename(runs_.front().path, output_path_);
+    return true;
+  }
+  return MergeRuns();
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::PostProcessingImpl() {
+  runs_.clear();
+  std::filesystem::remove_all(runs_dir_);
+  return true;
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::SpillRuns() {
+  // Four chunk-sized buffers are alive at once: the one being read ahead, the one being
+  // sorted, the radix scratch buffer and the run that is being written behind.
+  const std::size_t chunk = std::max<std::size_t>(1, budget_ / (4 * sizeof(int)));
+
+  std::ifstream in(input_path_, std::ios::binary);
+  std::vector<int> buffer;
+  std::future<std::vector<int>> reading;
+  std::future<bool> writing;
+  bool ok = true;
+
+  std::uint64_t offset = 0;
+  if (size_ != 0) {
+    reading = std::async(std::launch::async, ReadBlock, std::ref(in), std::min<std::uint64_t>(chunk, size_));
+  }
+  while (offset < size_) {
+    std::vector<int> data = reading.get();
+    const std::uint64_t expected = std::min<std::uint64_t>(chunk, size_ - offset);
+    if (data.size() != expected) {
+      ok = false;
+      break;
+    }
+    offset += data.size();
+    if (offset < size_) {
+      reading = std::async(std::launch::async, ReadBlock, std::ref(in), std::min<std::uint64_t>(chunk, size_ - offset));
+    }
+
+    RadixSort(data, buffer);
+
+    if (writing.valid() && !writing.get()) {
+      ok = false;
+      break;
+    }
+    runs_.push_back({runs_dir_ / ("run_" + std::to_string(runs_.size()) + ".bin"), data.size()});
+    writing = std::async(std::launch::async,
+                         [path = runs_.back().path, run = std::move(data)] { return WriteBlock(path, run); });
+  }
+
+  if (reading.valid()) {
+    reading.wait();
+  }
+  if (writing.valid()) {
+    ok = writing.get() && ok;
+  }
+  return ok;
+}
+
+bool external_radix_sort_omp::ExternalRadixSortOMP::MergeRuns() {
+  const int parts = omp_get_max_threads();
+  const std::size_t k = runs_.size();
+
+  // Splitters are drawn from evenly spaced samples of every run, then located in each run by
+  // binary search, so that part t owns [bounds[t][r], bounds[t + 1][r]) of run r.
+  std::vector<int> samples;
+  samples.reserve(k * kSamplesPerRun);
+  std::vector<std::vector<std::uint64_t>> bounds(parts + 1, std::vector<std::uint64_t>(k, 0));
+  for (std::size_t r = 0; r < k; ++r) {
+    std::ifstream in(runs_[r].path, std::ios::binary);
+    for (std::size_t s = 0; s < kSamplesPerRun; ++s) {
+      samples.push_back(ReadValue(in, runs_[r].size * ((2 * s) + 1) / (2 * kSamplesPerRun)));
+    }
+    bounds[parts][r] = runs_[r].size;
+  }
+  std::ranges::sort(samples);
+
+#pragma omp parallel for
+  for (int r = 0; r < static_cast<int>(k); ++r) {
+    std::ifstream in(runs_[r].path, std::ios::binary);
+    for (int t = 1; t < parts; ++t) {
+      bounds[t][r] = LowerBound(in, runs_[r].size, samples[samples.size() * t / parts]);
+    }
+  }
+
+  {
+    std::ofstream out(output_path_, std::ios::binary | std::ios::trunc);
+  }
+  std::filesystem::resize_file(output_path_, size_ * sizeof(int));
+
+  // Every part keeps two blocks per run and two output blocks in flight
+  const std::size_t block = std::max(kMinMergeBlock, budget_ / (sizeof(int) * parts * ((2 * k) + 2)));
+  return MergeParts(parts, [&](int t) {
+    std::uint64_t offset = 0;
+    std::uint64_t expected = 0;
+    std::vector<std::unique_ptr<BlockReader>> readers;
+    for (std::size_t r = 0; r < k; ++r) {
+      offset += bounds[t][r];
+      expected += bounds[t + 1][r] - bounds[t][r];
+      if (bounds[t][r] < bounds[t + 1][r]) {
+        readers.push_back(std::make_unique<BlockReader>(runs_[r].path, bounds[t][r], bounds[t + 1][r], block));
+      }
+    }
+    if (expected == 0) {
+      return true;
+    }
+
+    using Head = std::pair<int, std::size_t>;
+    std::priority_queue<Head, std::vector<Head>, std::greater<>> heads;
+    for (std::size_t i = 0; i < readers.size(); ++i) {
+      if (!readers[i]->Empty()) {
+        heads.emplace(readers[i]->Front(), i);
+      }
+    }
+
+    BlockWriter writer(output_path_, offset, block);
+    while (!heads.empty()) {
+      const auto [value, i] = heads.top();
+      heads.pop();
+      writer.Push(value);
+      readers[i]->Pop();
+      if (!readers[i]->Empty()) {
+        heads.emplace(readers[i]->Front(), i);
+      }
+    }
+    return writer.Finish() == expected;
+  });
+}
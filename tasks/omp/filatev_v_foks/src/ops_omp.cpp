@@ -1,10 +1,14 @@
 #include "omp/filatev_v_foks/include/ops_omp.hpp"
 
+#include <omp.h>
+
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 bool filatev_v_foks_omp::Focks::PreProcessingImpl() {
   size_block_ = task_data->inputs_count[4];
   size_a_.n = task_data->inputs_count[0];
@@ -19,10 +23,11 @@ bool filatev_v_foks_omp::Focks::PreProcessingImpl() {
   size_ = std::max(size_, size_b_.n);
   size_ = std::max(size_, size_b_.m);
 
-  size_ = (size_ % size_block_ == 0) ? size_ : ((size_ % size_block_) + 1) * size_block_;
+  size_ = (size_ % size_block_ == 0) ? size_ : ((size_ / size_block_) + 1) * size_block_;
 
   matrix_a_.assign(size_ * size_, 0);
   matrix_b_.assign(size_ * size_, 0);
+  matrix_c_.assign(size_ * size_, 0);
 
   auto *temp_a = reinterpret_cast<double *>(task_data->inputs[0]);
   auto *temp_b = reinterpret_cast<double *>(task_data->inputs[1]);
@@ -34,6 +39,11 @@ bool filatev_v_foks_omp::Focks::PreProcessingImpl() {
     std::copy(temp_b + (i * size_b_.n), temp_b + ((i + 1) * size_b_.n), matrix_b_.data() + (i * size_));
   }
 
+  workspaces_.resize(omp_get_max_threads());
+  for (auto &workspace : workspaces_) {
+    workspace.Reserve(size_block_, size_block_, size_block_);
+  }
+
   return true;
 }
 
@@ -45,36 +55,24 @@ bool filatev_v_foks_omp::Focks::ValidationImpl() {
 }
 
 bool filatev_v_foks_omp::Focks::RunImpl() {
-  matrix_c_.assign(size_ * size_, 0);
-
-  int grid_size = (int)(size_ / size_block_);
-
-#pragma omp parallel for
-  for (int step_i_j = 0; step_i_j < grid_size * grid_size * grid_size; ++step_i_j) {
-    int step = step_i_j / (grid_size * grid_size);
-    int i = (step_i_j % (grid_size * grid_size)) / grid_size;
-    int j = step_i_j % grid_size;
-
-    size_t root = (i + step) % grid_size;
-    std::vector<double> local_block(size_block_ * size_block_, 0);
-
-    for (size_t bi = 0; bi < size_block_; ++bi) {
-      for (size_t bj = 0; bj < size_block_; ++bj) {
-        for (size_t bk = 0; bk < size_block_; ++bk) {
-          local_block[(bi * size_block_) + bj] +=
-              matrix_a_[((i * size_block_ + bi) * size_) + (root * size_block_) + bk] *
-              matrix_b_[((root * size_block_ + bk) * size_) + (j * size_block_) + bj];
-        }
-      }
-    }
-
-#pragma omp critical
-    {
-      for (size_t bi = 0; bi < size_block_; ++bi) {
-        for (size_t bj = 0; bj < size_block_; ++bj) {
-          matrix_c_[((i * size_block_ + bi) * size_) + (j * size_block_) + bj] += local_block[(bi * size_block_) + bj];
-        }
-      }
+  const size_t grid_size = size_ / size_block_;
+  const auto blocks = static_cast<int>(grid_size * grid_size);
+
+  // Every block of C has a single owner that runs all the Fox steps for it,
+  // so the steps accumulate straight into C without any locking
+#pragma omp parallel for schedule(static)
+  for (int block = 0; block < blocks; ++block) {
+    const size_t i = static_cast<size_t>(block) / grid_size;
+    const size_t j = static_cast<size_t>(block) % grid_size;
+    auto &workspace = workspaces_[omp_get_thread_num()];
+    double *c_block = matrix_c_.data() + (i * size_block_ * size_) + (j * size_block_);
+
+    for (size_t step = 0; step < grid_size; ++step) {
+      const size_t root = (i + step) % grid_size;
+      ppc::linalg::Gemm(size_block_, size_block_, size_block_, 1.0,
+                        matrix_a_.data() + (i * size_block_ * size_) + (root * size_block_), size_,
+                        matrix_b_.data() + (root * size_block_ * size_) + (j * size_block_), size_,
+                        step == 0 ? 0.0 : 1.0, c_block, size_, workspace);
     }
   }
 
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <vector>
 
+#include "core/linalg/include/blocking.hpp"
+
 bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   if (input_size % 2 != 0) {
@@ -24,14 +26,9 @@ bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
     return false;
   }
 
-  block_size_ = n_ / 2;
-  for (int i = 1; i <= n_; ++i) {
-    if (n_ % i == 0) {
-      block_size_ = i;
-      break;
-    }
-  }
-  return block_size_ > 0;
+  // The stages clip the last block, so the tile size is chosen for the caches alone and need not divide n
+  block_size_ = static_cast<int>(ppc::linalg::ChooseBlockSize(n_, sizeof(double)));
+  return n_ > 0;
 }
 
 bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::ValidationImpl() {
@@ -47,21 +44,28 @@ bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::ValidationImpl() {
 bool gromov_a_fox_algorithm_omp::TestTaskOpenMP::RunImpl() {
   int num_blocks = (n_ + block_size_ - 1) / block_size_;
 
-  std::vector<double>& a_ref = A_;
-  std::vector<double>& b_ref = B_;
+  const std::vector<double>& a_ref = A_;
+  const std::vector<double>& b_ref = B_;
   std::vector<double>& output_ref = output_;
   int n_ref = n_;
   int block_size_ref = block_size_;
 
-  for (int stage = 0; stage < num_blocks; ++stage) {
-#pragma omp parallel for default(none) shared(a_ref, b_ref, output_ref, n_ref, block_size_ref, stage)
-    for (int i = 0; i < n_ref; i += block_size_ref) {
-      for (int j = 0; j < n_ref; j += block_size_ref) {
-        for (int bi = i; bi < i + block_size_ref && bi < n_ref; ++bi) {
-          for (int bj = j; bj < j + block_size_ref && bj < n_ref; ++bj) {
-            int start_k = stage * block_size_ref;
-            for (int bk = start_k; bk < std::min((stage + 1) * block_size_ref, n_ref); ++bk) {
-              output_ref[(bi * n_ref) + bj] += a_ref[(bi * n_ref) + bk] * b_ref[(bk * n_ref) + bj];
+  // Each block of the output is owned by one thread, which runs every stage for it: no two threads
+  // ever write the same element, and the stages need no barrier between them
+#pragma omp parallel for collapse(2) default(none) shared(a_ref, b_ref, output_ref, n_ref, block_size_ref, num_blocks)
+  for (int block_i = 0; block_i < num_blocks; ++block_i) {
+    for (int block_j = 0; block_j < num_blocks; ++block_j) {
+      const int i_end = std::min((block_i + 1) * block_size_ref, n_ref);
+      const int j_begin = block_j * block_size_ref;
+      const int j_end = std::min(j_begin + block_size_ref, n_ref);
+      for (int stage = 0; stage < num_blocks; ++stage) {
+        const int k_begin = ((block_i + stage) % num_blocks) * block_size_ref;
+        const int k_end = std::min(k_begin + block_size_ref, n_ref);
+        for (int bi = block_i * block_size_ref; bi < i_end; ++bi) {
+          for (int bk = k_begin; bk < k_end; ++bk) {
+            const double a_value = a_ref[(bi * n_ref) + bk];
+            for (int bj = j_begin; bj < j_end; ++bj) {
+              output_ref[(bi * n_ref) + bj] += a_value * b_ref[(bk * n_ref) + bj];
             }
           }
         }
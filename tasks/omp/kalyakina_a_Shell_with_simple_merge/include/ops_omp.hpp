@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -8,7 +9,6 @@
 namespace kalyakina_a_shell_with_simple_merge_omp {
 
 class ShellSortOpenMP : public ppc::core::Task {
-  static std::vector<unsigned int> CalculationOfGapLengths(unsigned int size);
   void ShellSort(unsigned int left, unsigned int right);
   void SimpleMergeSort(unsigned int left, unsigned int middle, unsigned int right);
 
@@ -22,7 +22,7 @@ class ShellSortOpenMP : public ppc::core::Task {
  private:
   std::vector<int> input_;
   std::vector<int> output_;
-  std::vector<unsigned int> Sedgwick_sequence_;
+  std::vector<std::size_t> Sedgwick_sequence_;
 };
 
 }  // namespace kalyakina_a_shell_with_simple_merge_omp
\ No newline at end of file
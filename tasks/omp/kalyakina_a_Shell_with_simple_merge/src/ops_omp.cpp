@@ -4,39 +4,14 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
-std::vector<unsigned int> kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::CalculationOfGapLengths(
-    unsigned int size) {
-  std::vector<unsigned int> result;
-  unsigned int local_res = 1;
-  for (unsigned int i = 1; (local_res * 3 <= size) || (local_res == 1); i++) {
-    result.push_back(local_res);
-    if (i % 2 != 0) {
-      local_res = static_cast<unsigned int>((8 * pow(2, i)) - (6 * pow(2, static_cast<float>(i + 1) / 2)) + 1);
-    } else {
-      local_res = static_cast<unsigned int>((9 * pow(2, i)) - (9 * pow(2, static_cast<float>(i) / 2)) + 1);
-    }
-  }
-  return result;
-}
+#include "core/sort/include/shell_sort.hpp"
 
 void kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::ShellSort(unsigned int left, unsigned int right) {
-  for (unsigned int k = Sedgwick_sequence_.size(); k > 0;) {
-    unsigned int gap = Sedgwick_sequence_[--k];
-    for (unsigned int i = left; i < left + gap; i++) {
-      for (unsigned int j = i; j < right; j += gap) {
-        unsigned int index = j;
-        int tmp = output_[index];
-        while ((index >= i + gap) && (tmp < output_[index - gap])) {
-          output_[index] = output_[index - gap];
-          index -= gap;
-        }
-        output_[index] = tmp;
-      }
-    }
-  }
+  ppc::sort::ShellSort(output_.data() + left, right - left, Sedgwick_sequence_);
 }
 
 void kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::SimpleMergeSort(unsigned int left, unsigned int middle,
@@ -85,7 +60,7 @@ bool kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP::RunImpl() {
   unsigned int part = output_.size() / num;
   unsigned int reminder = output_.size() % num;
   unsigned int left = 0;
-  Sedgwick_sequence_ = CalculationOfGapLengths(output_.size() / num);
+  Sedgwick_sequence_ = ppc::sort::MakeGaps(ppc::sort::GapSequence::kSedgewick, part + 1);
   for (unsigned int i = 0; i < num; i++) {
     unsigned int right = (i < reminder) ? left + part + 1 : left + part;
     bounds.emplace_back(left, right);
@@ -1,12 +1,23 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <iostream>
 #include <memory>
+#include <random>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
+#include "core/sparse/include/split_complex.hpp"
+#include "core/sparse/include/spmv.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/kondratev_ya_ccs_complex_multiplication/include/ops_omp.hpp"
 
@@ -47,6 +58,41 @@ void CheckResult(kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix &matrix,
   CheckRowIndices(matrix, count);
   CheckValues(matrix, count, value);
 }
+
+// Compressed arrays of outer slices with about per_slice random entries each among inner positions
+void FillRandom(std::vector<int> &ptr, std::vector<int> &index, std::vector<std::complex<double>> &values,
+                std::size_t outer, std::size_t inner, std::size_t per_slice, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<std::size_t> position(0, inner - 1);
+  std::uniform_real_distribution<double> part(-1.0, 1.0);
+  ptr.assign(1, 0);
+  std::vector<bool> used(inner);
+  std::vector<int> slice;
+  for (std::size_t o = 0; o < outer; ++o) {
+    slice.clear();
+    for (std::size_t e = 0; e < per_slice; ++e) {
+      const std::size_t i = position(gen);
+      if (!used[i]) {
+        used[i] = true;
+        slice.push_back(static_cast<int>(i));
+      }
+    }
+    std::ranges::sort(slice);
+    for (const int i : slice) {
+      used[i] = false;
+      index.push_back(i);
+      values.emplace_back(part(gen), part(gen));
+    }
+    ptr.push_back(static_cast<int>(values.size()));
+  }
+}
+
+double Seconds(const std::function<void()> &run) {
+  const auto start = std::chrono::high_resolution_clock::now();
+  run();
+  const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+  return elapsed.count();
+}
 }  // namespace
 
 TEST(kondratev_ya_ccs_complex_multiplication_omp, test_pipeline_run) {
@@ -125,3 +171,64 @@ TEST(kondratev_ya_ccs_complex_multiplication_omp, test_task_run) {
 
   CheckResult(c, kCount, {4.0, 7.0});
 }
+
+// The products of ppc::sparse on std::complex values against the same products on split real and
+// imaginary arrays, for the same random matrices; the conversions are not timed
+TEST(kondratev_ya_ccs_complex_multiplication_omp, split_layout_against_complex_layout) {
+  using Complex = std::complex<double>;
+  constexpr std::size_t kSize = 20000;
+  constexpr std::size_t kPerColumn = 40;
+  constexpr double kTolerance = 1e-9;
+
+  ppc::sparse::CcsMatrix<Complex> a{.rows = kSize, .cols = kSize, .col_ptr = {}, .row_index = {}, .values = {}};
+  ppc::sparse::CcsMatrix<Complex> b = a;
+  FillRandom(a.col_ptr, a.row_index, a.values, kSize, kSize, kPerColumn, 1);
+  FillRandom(b.col_ptr, b.row_index, b.values, kSize, kSize, kPerColumn, 2);
+  const auto a_split = ppc::sparse::Split(a.View());
+  const auto b_split = ppc::sparse::Split(b.View());
+
+  ppc::sparse::CcsMatrix<Complex> c;
+  ppc::sparse::SplitCcsMatrix<double> c_split;
+  const double spgemm = Seconds([&] { ppc::sparse::SpGemm(a.View(), b.View(), c, ppc::linalg::OmpFor{}); });
+  const double spgemm_split =
+      Seconds([&] { ppc::sparse::SpGemm(a_split.View(), b_split.View(), c_split, ppc::linalg::OmpFor{}); });
+  ASSERT_EQ(c_split.col_ptr, c.col_ptr);
+  ASSERT_EQ(c_split.row_index, c.row_index);
+  for (std::size_t p = 0; p < c.values.size(); ++p) {
+    ASSERT_LE(std::abs(Complex(c_split.re[p], c_split.im[p]) - c.values[p]), kTolerance) << p;
+  }
+
+  // A read by rows is A^T, which is as good a matrix to multiply a vector by
+  const auto a_rows = ppc::sparse::TransposedView(a.View());
+  const auto a_rows_split = ppc::sparse::Split(a_rows);
+  std::vector<Complex> x(kSize);
+  std::vector<double> x_re(kSize);
+  std::vector<double> x_im(kSize);
+  for (std::size_t j = 0; j < kSize; ++j) {
+    x[j] = {std::cos(static_cast<double>(j)), std::sin(static_cast<double>(j))};
+    x_re[j] = x[j].real();
+    x_im[j] = x[j].imag();
+  }
+  std::vector<Complex> y(kSize);
+  std::vector<double> y_re(kSize);
+  std::vector<double> y_im(kSize);
+  constexpr int kSpmvRepeats = 50;
+  const double spmv = Seconds([&] {
+    for (int r = 0; r < kSpmvRepeats; ++r) {
+      ppc::sparse::SpMV(a_rows, x.data(), y.data(), ppc::linalg::OmpFor{});
+    }
+  });
+  const double spmv_split = Seconds([&] {
+    for (int r = 0; r < kSpmvRepeats; ++r) {
+      ppc::sparse::SpMV(a_rows_split.View(), x_re.data(), x_im.data(), y_re.data(), y_im.data(), ppc::linalg::OmpFor{});
+    }
+  });
+  for (std::size_t i = 0; i < kSize; ++i) {
+    ASSERT_LE(std::abs(Complex(y_re[i], y_im[i]) - y[i]), kTolerance) << i;
+  }
+
+  std::cout << "kondratev_ya_ccs_complex_multiplication_omp: case=spgemm_complex time=" << spgemm << '\n'
+            << "kondratev_ya_ccs_complex_multiplication_omp: case=spgemm_split time=" << spgemm_split << '\n'
+            << "kondratev_ya_ccs_complex_multiplication_omp: case=spmv_complex time=" << spmv << '\n'
+            << "kondratev_ya_ccs_complex_multiplication_omp: case=spmv_split time=" << spmv_split << '\n';
+}
@@ -1,12 +1,12 @@
 #include "omp/kondratev_ya_ccs_complex_multiplication/include/ops_omp.hpp"
 
-#include <omp.h>
-
-#include <algorithm>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <utility>
-#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/spgemm.hpp"
 
 bool kondratev_ya_ccs_complex_multiplication_omp::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
@@ -47,47 +47,23 @@ bool kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP::PostProcessingImp
   return true;
 }
 
+ppc::sparse::CcsView<std::complex<double>> kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix::View() const {
+  return {.rows = static_cast<std::size_t>(rows),
+          .cols = static_cast<std::size_t>(cols),
+          .col_ptr = col_ptrs.data(),
+          .row_index = row_index.data(),
+          .values = values.data()};
+}
+
 kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix
 kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-  result.col_ptrs.resize(other.cols + 1, 0);
-
-  std::vector<std::vector<std::pair<int, std::complex<double>>>> temp_cols(other.cols);
-
-#pragma omp parallel for
-  for (int result_col = 0; result_col < other.cols; result_col++) {
-    std::vector<std::complex<double>> local_temp_col(rows, std::complex<double>(0.0, 0.0));
-
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
-
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        local_temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(local_temp_col[i])) {
-        temp_cols[result_col].emplace_back(i, local_temp_col[i]);
-      }
-    }
-  }
-
-  int nonzero_elements_processed = 0;
-  for (int col = 0; col < other.cols; col++) {
-    result.col_ptrs[col] = nonzero_elements_processed;
-
-    for (const auto &[row, value] : temp_cols[col]) {
-      result.row_index.emplace_back(row);
-      result.values.emplace_back(value);
-      nonzero_elements_processed++;
-    }
-  }
-  result.col_ptrs[other.cols] = nonzero_elements_processed;
+  ppc::sparse::CcsMatrix<std::complex<double>> product;
+  ppc::sparse::SpGemm(View(), other.View(), product, ppc::linalg::OmpFor{});
+  ppc::sparse::Prune(product, [](const std::complex<double> &value) { return !IsZero(value); });
 
+  CCSMatrix result({rows, other.cols});
+  result.values = std::move(product.values);
+  result.row_index = std::move(product.row_index);
+  result.col_ptrs = std::move(product.col_ptr);
   return result;
-}
\ No newline at end of file
+}
@@ -1,9 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <random>
 #include <vector>
 
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/matrix_io.hpp"
+#include "core/sparse/include/reorder.hpp"
+
 #include "core/task/include/task.hpp"
+#include "core/util/include/util.hpp"
 #include "omp/konkov_i_sparse_matmul_ccs_omp/include/ops_omp.hpp"
 
 TEST(konkov_i_SparseMatmulTest_omp, SimpleTest) {
@@ -91,4 +99,282 @@ TEST(konkov_i_SparseMatmulTest_omp, IdentityMatrixTest) {
   EXPECT_EQ(task.C_values, task.B_values);
   EXPECT_EQ(task.C_row_indices, task.B_row_indices);
   EXPECT_EQ(task.C_col_ptr, task.B_col_ptr);
-}
\ No newline at end of file
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, ReorderedProductTest) {
+  // Random square A and B with small integer values, so that every order of the sums gives the same C
+  std::mt19937 gen(7);
+  std::bernoulli_distribution coin(0.1);
+  std::uniform_int_distribution<int> value(1, 9);
+  constexpr int kN = 60;
+  auto fill = [&](std::vector<double>& values, std::vector<int>& row_indices, std::vector<int>& col_ptr) {
+    col_ptr = {0};
+    for (int j = 0; j < kN; ++j) {
+      for (int i = 0; i < kN; ++i) {
+        if (coin(gen)) {
+          row_indices.push_back(i);
+          values.push_back(value(gen));
+        }
+      }
+      col_ptr.push_back(static_cast<int>(values.size()));
+    }
+  };
+
+  struct Product {
+    std::vector<double> values;
+    std::vector<int> row_indices, col_ptr;
+  };
+  auto run = [&](ppc::sparse::Reordering reordering) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+    gen.seed(7);
+    fill(task.A_values, task.A_row_indices, task.A_col_ptr);
+    fill(task.B_values, task.B_row_indices, task.B_col_ptr);
+    task.rowsA = task.colsA = task.rowsB = task.colsB = kN;
+    task.reordering = reordering;
+    EXPECT_TRUE(task.ValidationImpl());
+    EXPECT_TRUE(task.PreProcessingImpl());
+    EXPECT_TRUE(task.RunImpl());
+    EXPECT_TRUE(task.PostProcessingImpl());
+    return Product{.values = task.C_values, .row_indices = task.C_row_indices, .col_ptr = task.C_col_ptr};
+  };
+
+  const auto expected = run(ppc::sparse::Reordering::kNone);
+  ASSERT_FALSE(expected.values.empty());
+  for (const auto reordering : {ppc::sparse::Reordering::kDegree, ppc::sparse::Reordering::kReverseCuthillMcKee}) {
+    const Product c = run(reordering);
+    EXPECT_EQ(c.col_ptr, expected.col_ptr);
+    EXPECT_EQ(c.row_indices, expected.row_indices);
+    EXPECT_EQ(c.values, expected.values);
+  }
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, MatrixMarketInputTest) {
+  const auto a = ppc::sparse::CooToCcs(ppc::sparse::ReadMatrixMarket<double>(
+      ppc::util::GetAbsolutePath("omp/konkov_i_sparse_matmul_ccs_omp/data/grid_laplacian.mtx")));
+  ASSERT_EQ(a.rows, 16);
+  ASSERT_EQ(a.values.size(), 64);
+
+  ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+  konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+  task.A_values = task.B_values = a.values;
+  task.A_row_indices = task.B_row_indices = a.row_index;
+  task.A_col_ptr = task.B_col_ptr = a.col_ptr;
+  task.rowsA = task.colsA = task.rowsB = task.colsB = static_cast<int>(a.rows);
+  task.reordering = ppc::sparse::Reordering::kReverseCuthillMcKee;
+  EXPECT_TRUE(task.ValidationImpl());
+  EXPECT_TRUE(task.PreProcessingImpl());
+  EXPECT_TRUE(task.RunImpl());
+  EXPECT_TRUE(task.PostProcessingImpl());
+
+  // Dense check of the square of the Laplacian
+  std::vector<double> dense(a.rows * a.cols);
+  for (std::size_t j = 0; j < a.cols; ++j) {
+    for (int p = a.col_ptr[j]; p < a.col_ptr[j + 1]; ++p) {
+      dense[(static_cast<std::size_t>(a.row_index[p]) * a.cols) + j] = a.values[p];
+    }
+  }
+  for (std::size_t j = 0; j < a.cols; ++j) {
+    auto p = static_cast<std::size_t>(task.C_col_ptr[j]);
+    for (std::size_t i = 0; i < a.rows; ++i) {
+      double expected = 0.0;
+      for (std::size_t k = 0; k < a.rows; ++k) {
+        expected += dense[(i * a.cols) + k] * dense[(k * a.cols) + j];
+      }
+      if (expected != 0.0) {
+        ASSERT_LT(p, static_cast<std::size_t>(task.C_col_ptr[j + 1]));
+        EXPECT_EQ(task.C_row_indices[p], static_cast<int>(i));
+        EXPECT_EQ(task.C_values[p], expected);
+        ++p;
+      }
+    }
+    EXPECT_EQ(p, static_cast<std::size_t>(task.C_col_ptr[j + 1]));
+  }
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, BlockProductTest) {
+  // A and B of 3 x 3 clusters on a 3-aligned grid, with small integer values, and a few scattered entries
+  std::mt19937 gen(11);
+  std::bernoulli_distribution cluster(0.15);
+  std::bernoulli_distribution single(0.01);
+  std::uniform_int_distribution<int> value(1, 9);
+  constexpr int kN = 61;
+  auto fill = [&](std::vector<double>& values, std::vector<int>& row_indices, std::vector<int>& col_ptr) {
+    std::vector<double> dense(kN * kN, 0.0);
+    for (int bi = 0; bi < kN; bi += 3) {
+      for (int bj = 0; bj < kN; bj += 3) {
+        const bool full = cluster(gen);
+        for (int i = bi; i < std::min(kN, bi + 3); ++i) {
+          for (int j = bj; j < std::min(kN, bj + 3); ++j) {
+            if (full || single(gen)) {
+              dense[(i * kN) + j] = value(gen);
+            }
+          }
+        }
+      }
+    }
+    col_ptr = {0};
+    for (int j = 0; j < kN; ++j) {
+      for (int i = 0; i < kN; ++i) {
+        if (dense[(i * kN) + j] != 0.0) {
+          row_indices.push_back(i);
+          values.push_back(dense[(i * kN) + j]);
+        }
+      }
+      col_ptr.push_back(static_cast<int>(values.size()));
+    }
+  };
+
+  struct Product {
+    std::vector<double> values;
+    std::vector<int> row_indices, col_ptr;
+  };
+  auto run = [&](std::size_t bsr_block, ppc::sparse::Reordering reordering) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+    gen.seed(11);
+    fill(task.A_values, task.A_row_indices, task.A_col_ptr);
+    fill(task.B_values, task.B_row_indices, task.B_col_ptr);
+    task.rowsA = task.colsA = task.rowsB = task.colsB = kN;
+    task.bsr_block = bsr_block;
+    task.reordering = reordering;
+    EXPECT_TRUE(task.ValidationImpl());
+    EXPECT_TRUE(task.PreProcessingImpl());
+    EXPECT_TRUE(task.RunImpl());
+    EXPECT_TRUE(task.PostProcessingImpl());
+    return Product{.values = task.C_values, .row_indices = task.C_row_indices, .col_ptr = task.C_col_ptr};
+  };
+
+  const Product expected = run(1, ppc::sparse::Reordering::kNone);
+  ASSERT_FALSE(expected.values.empty());
+  // 0 picks the block size of the clusters; the others pad them, and 12 is beyond the dense kernels
+  for (const std::size_t bsr_block : {0, 2, 3, 4, 8, 12}) {
+    const Product c = run(bsr_block, ppc::sparse::Reordering::kNone);
+    EXPECT_EQ(c.col_ptr, expected.col_ptr) << bsr_block;
+    EXPECT_EQ(c.row_indices, expected.row_indices) << bsr_block;
+    EXPECT_EQ(c.values, expected.values) << bsr_block;
+  }
+  const Product reordered = run(4, ppc::sparse::Reordering::kDegree);
+  EXPECT_EQ(reordered.col_ptr, expected.col_ptr);
+  EXPECT_EQ(reordered.row_indices, expected.row_indices);
+  EXPECT_EQ(reordered.values, expected.values);
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, MaskedTriangleCountTest) {
+  // L the strictly lower part of the adjacency of a random undirected graph: the entries of (L * L) .* L
+  // add up to its number of triangles
+  constexpr int kN = 80;
+  std::mt19937 gen(13);
+  std::bernoulli_distribution edge(0.1);
+  std::vector<std::vector<bool>> adjacent(kN, std::vector<bool>(kN));
+  ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+  konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+  task.A_col_ptr = {0};
+  for (int j = 0; j < kN; ++j) {
+    for (int i = j + 1; i < kN; ++i) {
+      if (edge(gen)) {
+        adjacent[i][j] = adjacent[j][i] = true;
+        task.A_row_indices.push_back(i);
+        task.A_values.push_back(1.0);
+      }
+    }
+    task.A_col_ptr.push_back(static_cast<int>(task.A_values.size()));
+  }
+  task.B_values = task.A_values;
+  task.B_row_indices = task.M_row_indices = task.A_row_indices;
+  task.B_col_ptr = task.M_col_ptr = task.A_col_ptr;
+  task.rowsA = task.colsA = task.rowsB = task.colsB = kN;
+  ASSERT_TRUE(task.ValidationImpl());
+  ASSERT_TRUE(task.PreProcessingImpl());
+  ASSERT_TRUE(task.RunImpl());
+  ASSERT_TRUE(task.PostProcessingImpl());
+
+  int expected = 0;
+  for (int x = 0; x < kN; ++x) {
+    for (int y = x + 1; y < kN; ++y) {
+      for (int z = y + 1; z < kN; ++z) {
+        expected += adjacent[x][y] && adjacent[y][z] && adjacent[x][z] ? 1 : 0;
+      }
+    }
+  }
+  ASSERT_GT(expected, 0);
+  double triangles = 0.0;
+  for (std::size_t j = 0; j < kN; ++j) {
+    for (int p = task.C_col_ptr[j]; p < task.C_col_ptr[j + 1]; ++p) {
+      // Only positions of the mask
+      EXPECT_GT(task.C_row_indices[p], static_cast<int>(j));
+      triangles += task.C_values[p];
+    }
+  }
+  EXPECT_EQ(triangles, expected);
+
+  // A mask is of the product as given, so it does not go with reordering
+  task.reordering = ppc::sparse::Reordering::kDegree;
+  EXPECT_FALSE(task.ValidationImpl());
+}
+
+TEST(konkov_i_SparseMatmulTest_omp, AccumulatedProductTest) {
+  // C = 2 * A * B - C on random matrices with small integer values, against the dense result
+  constexpr int kN = 50;
+  std::mt19937 gen(17);
+  std::bernoulli_distribution coin(0.1);
+  std::uniform_int_distribution<int> value(1, 9);
+  std::vector<double> dense_a(kN * kN);
+  std::vector<double> dense_b(kN * kN);
+  std::vector<double> dense_c(kN * kN);
+  for (auto* dense : {&dense_a, &dense_b, &dense_c}) {
+    for (auto& x : *dense) {
+      x = coin(gen) ? value(gen) : 0.0;
+    }
+  }
+  auto to_ccs = [](const std::vector<double>& dense, std::vector<double>& values, std::vector<int>& row_indices,
+                   std::vector<int>& col_ptr) {
+    values.clear();
+    row_indices.clear();
+    col_ptr = {0};
+    for (int j = 0; j < kN; ++j) {
+      for (int i = 0; i < kN; ++i) {
+        if (dense[(j * kN) + i] != 0.0) {
+          row_indices.push_back(i);
+          values.push_back(dense[(j * kN) + i]);
+        }
+      }
+      col_ptr.push_back(static_cast<int>(values.size()));
+    }
+  };
+  std::vector<double> expected = dense_c;
+  for (auto& x : expected) {
+    x = -x;
+  }
+  for (int j = 0; j < kN; ++j) {
+    for (int k = 0; k < kN; ++k) {
+      for (int i = 0; i < kN; ++i) {
+        expected[(j * kN) + i] += 2.0 * dense_a[(k * kN) + i] * dense_b[(j * kN) + k];
+      }
+    }
+  }
+  std::vector<double> expected_values;
+  std::vector<int> expected_row_indices;
+  std::vector<int> expected_col_ptr;
+  to_ccs(expected, expected_values, expected_row_indices, expected_col_ptr);
+
+  // Accumulated in the product directly, and after the reordered product is permuted back
+  for (const auto reordering : {ppc::sparse::Reordering::kNone, ppc::sparse::Reordering::kReverseCuthillMcKee}) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+    to_ccs(dense_a, task.A_values, task.A_row_indices, task.A_col_ptr);
+    to_ccs(dense_b, task.B_values, task.B_row_indices, task.B_col_ptr);
+    to_ccs(dense_c, task.C_values, task.C_row_indices, task.C_col_ptr);
+    task.rowsA = task.colsA = task.rowsB = task.colsB = kN;
+    task.alpha = 2.0;
+    task.beta = -1.0;
+    task.reordering = reordering;
+    ASSERT_TRUE(task.ValidationImpl());
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    ASSERT_TRUE(task.PostProcessingImpl());
+    EXPECT_EQ(task.C_col_ptr, expected_col_ptr);
+    EXPECT_EQ(task.C_row_indices, expected_row_indices);
+    EXPECT_EQ(task.C_values, expected_values);
+  }
+}
@@ -1,8 +1,11 @@
 #pragma once
 #include <omp.h>
 
+#include <cstddef>
 #include <vector>
 
+#include "core/sparse/include/reorder.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konkov_i_sparse_matmul_ccs_omp {
@@ -20,6 +23,38 @@ class SparseMatmulTask : public ppc::core::Task {
   std::vector<int> A_row_indices, B_row_indices, C_row_indices;
   std::vector<int> A_col_ptr, B_col_ptr, C_col_ptr;
   int rowsA, colsA, rowsB, colsB;
+  // Optional reordering of the inputs in PreProcessing: kDegree sorts the rows of A by length,
+  // kReverseCuthillMcKee (square A only) permutes A and B symmetrically to narrow their bands. The product
+  // is computed on the reordered matrices and permuted back.
+  ppc::sparse::Reordering reordering = ppc::sparse::Reordering::kNone;
+  // Tiles of the product: 1 multiplies entry by entry in CCS; a larger size converts A and B to BSR with
+  // tiles of that size in PreProcessing and multiplies the tiles with dense kernels; 0 picks a size with
+  // ppc::sparse::ChooseBsrBlock, or 1 if the tiles of A or B would hold too many padding zeros
+  std::size_t bsr_block = 1;
+  // Optional mask M, rowsA x colsB in CCS without values and with the rows sorted within every column: when
+  // M_col_ptr is set only the entries of A * B at the positions of M are computed, see
+  // ppc::sparse::MaskedSpGemm. The mask is of the product as given, so it does not go with reordering or tiles.
+  std::vector<int> M_row_indices, M_col_ptr;
+  // C = alpha * A * B + beta * C, where the C on the right is what C_* hold before PreProcessing, rowsA x colsB
+  // with the rows sorted within every column; with beta == 0 they are not read
+  double alpha = 1.0;
+  double beta = 0.0;
+
+ private:
+  // A and B as the product reads them, reordered or not
+  [[nodiscard]] ppc::sparse::CcsView<double> InputA() const;
+  [[nodiscard]] ppc::sparse::CcsView<double> InputB() const;
+  [[nodiscard]] ppc::sparse::CcsView<double> Mask() const;
+
+  // Reordered copies of A and B, their product, and the permutations of its rows and columns to undo
+  // (empty where a dimension is not reordered)
+  ppc::sparse::CcsMatrix<double> a_, b_, c_;
+  std::vector<int> row_perm_, col_perm_;
+  // The C that beta scales, taken from C_* in PreProcessing
+  ppc::sparse::CcsMatrix<double> c_in_;
+  // Tile size in use and the tiles of A^T and B^T, whose product is C^T
+  std::size_t block_ = 1;
+  ppc::sparse::BsrMatrix<double> a_t_tiles_, b_t_tiles_;
 };
 
 }  // namespace konkov_i_sparse_matmul_ccs_omp
\ No newline at end of file
@@ -1,12 +1,26 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
 #include <memory>
+#include <random>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/konkov_i_sparse_matmul_ccs_omp/include/ops_omp.hpp"
+#include "omp/sadikov_I_SparseMatrixMultiplication/include/ops_omp.hpp"
+#include "omp/solovev_a_ccs_mmult_sparse/include/ccs_mmult_sparse_omp.hpp"
 
 TEST(konkov_i_SparseMatmulPerfTest_omp, test_pipeline_run) {
   constexpr int kSize = 5000;
@@ -116,4 +130,270 @@ TEST(konkov_i_SparseMatmulPerfTest_omp, test_task_run) {
     ASSERT_NEAR(val, expected_value, 1e-9);
   }
   ASSERT_EQ(task->C_col_ptr.back(), kSize);
-}
\ No newline at end of file
+}
+
+namespace {
+
+// n x n CCS arrays of cluster x cluster squares of random values, per_column of them in every column of
+// squares, at distinct rows of squares
+void FillClustered(konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask& task, bool is_a, int n, int cluster,
+                   int per_column, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::vector<int> block_rows(n / cluster);
+  for (std::size_t i = 0; i < block_rows.size(); ++i) {
+    block_rows[i] = static_cast<int>(i);
+  }
+  auto& values = is_a ? task.A_values : task.B_values;
+  auto& row_indices = is_a ? task.A_row_indices : task.B_row_indices;
+  auto& col_ptr = is_a ? task.A_col_ptr : task.B_col_ptr;
+  col_ptr = {0};
+  std::vector<int> chosen(per_column);
+  for (int bj = 0; bj < n / cluster; ++bj) {
+    std::ranges::shuffle(block_rows, gen);
+    std::copy_n(block_rows.begin(), per_column, chosen.begin());
+    std::ranges::sort(chosen);
+    for (int j = 0; j < cluster; ++j) {
+      for (const int bi : chosen) {
+        for (int i = 0; i < cluster; ++i) {
+          row_indices.push_back((bi * cluster) + i);
+          values.push_back(value(gen));
+        }
+      }
+      col_ptr.push_back(static_cast<int>(values.size()));
+    }
+  }
+  (is_a ? task.rowsA : task.rowsB) = n;
+  (is_a ? task.colsA : task.colsB) = n;
+}
+
+// n x n CCS arrays in the layout of solovev_a_ccs_mmult_sparse, whose values are complex
+solovev_a_matrix_omp::MatrixInCcsSparse ToSolovev(const std::vector<double>& values,
+                                                  const std::vector<int>& row_indices, const std::vector<int>& col_ptr,
+                                                  int n) {
+  solovev_a_matrix_omp::MatrixInCcsSparse m(n, n, static_cast<int>(values.size()));
+  std::ranges::copy(values, m.val.begin());
+  m.row = row_indices;
+  m.col_p = col_ptr;
+  return m;
+}
+
+// Row-major dense copy of n x n CCS arrays, the layout sadikov_I_SparseMatrixMultiplication takes and returns
+std::vector<double> ToDense(const std::vector<double>& values, const std::vector<int>& row_indices,
+                            const std::vector<int>& col_ptr, int n) {
+  std::vector<double> dense(static_cast<std::size_t>(n) * n);
+  for (int j = 0; j < n; ++j) {
+    for (int p = col_ptr[j]; p < col_ptr[j + 1]; ++p) {
+      dense[(static_cast<std::size_t>(row_indices[p]) * n) + j] = values[p];
+    }
+  }
+  return dense;
+}
+
+}  // namespace
+
+// The task on matrices of 4 x 4 clusters multiplied entry by entry in CCS, in BSR with tiles of the
+// clusters and of twice their size, and with the size picked by the task; the conversions to BSR in
+// PreProcessing are timed apart from the products. The CCS product is then checked against the other
+// CCS tasks of the OpenMP track, solovev_a_ccs_mmult_sparse and sadikov_I_SparseMatrixMultiplication.
+TEST(konkov_i_SparseMatmulPerfTest_omp, bsr_against_ccs) {
+  constexpr int kSize = 40000;
+  // sadikov_I takes dense matrices and visits every pair of a row of A and a column of B
+  constexpr int kDenseSize = 1024;
+  constexpr int kCluster = 4;
+  constexpr int kPerColumn = 6;
+  auto seconds = [](const auto& f) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+  };
+
+  std::vector<double> expected;
+  std::vector<int> expected_row_indices;
+  std::vector<int> expected_col_ptr;
+  for (const std::size_t bsr_block : {1, 4, 8, 0}) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+    FillClustered(task, true, kSize, kCluster, kPerColumn, 1);
+    FillClustered(task, false, kSize, kCluster, kPerColumn, 2);
+    task.bsr_block = bsr_block;
+    ASSERT_TRUE(task.ValidationImpl());
+    const double convert = seconds([&] { ASSERT_TRUE(task.PreProcessingImpl()); });
+    const double multiply = seconds([&] { ASSERT_TRUE(task.RunImpl()); });
+    ASSERT_TRUE(task.PostProcessingImpl());
+    if (expected.empty()) {
+      expected = task.C_values;
+      expected_row_indices = task.C_row_indices;
+      expected_col_ptr = task.C_col_ptr;
+    }
+    ASSERT_EQ(task.C_values.size(), expected.size());
+    for (std::size_t p = 0; p < expected.size(); ++p) {
+      ASSERT_NEAR(task.C_values[p], expected[p], 1e-9);
+    }
+    std::cout << "konkov_i_sparse_matmul_ccs_omp: case=bsr_block_" << bsr_block << " preprocessing=" << convert
+              << " run=" << multiply << '\n';
+  }
+
+  {
+    ppc::core::TaskDataPtr inputs_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask inputs(inputs_data);
+    FillClustered(inputs, true, kSize, kCluster, kPerColumn, 1);
+    FillClustered(inputs, false, kSize, kCluster, kPerColumn, 2);
+    auto a = ToSolovev(inputs.A_values, inputs.A_row_indices, inputs.A_col_ptr, kSize);
+    auto b = ToSolovev(inputs.B_values, inputs.B_row_indices, inputs.B_col_ptr, kSize);
+    solovev_a_matrix_omp::MatrixInCcsSparse c;
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs = {reinterpret_cast<uint8_t*>(&a), reinterpret_cast<uint8_t*>(&b)};
+    task_data->outputs = {reinterpret_cast<uint8_t*>(&c)};
+    solovev_a_matrix_omp::OMPMatMultCcs task(task_data);
+    ASSERT_TRUE(task.ValidationImpl());
+    ASSERT_TRUE(task.PreProcessingImpl());
+    const double multiply = seconds([&] { ASSERT_TRUE(task.RunImpl()); });
+    ASSERT_TRUE(task.PostProcessingImpl());
+    ASSERT_EQ(c.col_p, expected_col_ptr);
+    ASSERT_EQ(c.row, expected_row_indices);
+    for (std::size_t p = 0; p < expected.size(); ++p) {
+      ASSERT_NEAR(c.val[p].real(), expected[p], 1e-9);
+    }
+    std::cout << "konkov_i_sparse_matmul_ccs_omp: case=solovev_a_ccs_mmult_sparse run=" << multiply << '\n';
+  }
+
+  {
+    // sadikov_I keeps only the entries of the product above 1e-6, so the values are made positive
+    ppc::core::TaskDataPtr own_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask own(own_data);
+    FillClustered(own, true, kDenseSize, kCluster, kPerColumn, 1);
+    FillClustered(own, false, kDenseSize, kCluster, kPerColumn, 2);
+    for (auto* values : {&own.A_values, &own.B_values}) {
+      std::ranges::transform(*values, values->begin(), [](double v) { return std::abs(v); });
+    }
+    std::vector<double> a = ToDense(own.A_values, own.A_row_indices, own.A_col_ptr, kDenseSize);
+    std::vector<double> b = ToDense(own.B_values, own.B_row_indices, own.B_col_ptr, kDenseSize);
+    own.bsr_block = 1;
+    ASSERT_TRUE(own.ValidationImpl());
+    ASSERT_TRUE(own.PreProcessingImpl());
+    const double own_multiply = seconds([&] { ASSERT_TRUE(own.RunImpl()); });
+    ASSERT_TRUE(own.PostProcessingImpl());
+    const std::vector<double> own_c = ToDense(own.C_values, own.C_row_indices, own.C_col_ptr, kDenseSize);
+
+    std::vector<double> c(a.size());
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    task_data->inputs = {reinterpret_cast<uint8_t*>(a.data()), reinterpret_cast<uint8_t*>(b.data())};
+    task_data->inputs_count = {kDenseSize, kDenseSize, kDenseSize, kDenseSize};
+    task_data->outputs = {reinterpret_cast<uint8_t*>(c.data())};
+    task_data->outputs_count = {static_cast<std::uint32_t>(c.size())};
+    sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP task(task_data);
+    ASSERT_TRUE(task.ValidationImpl());
+    ASSERT_TRUE(task.PreProcessingImpl());
+    const double multiply = seconds([&] { ASSERT_TRUE(task.RunImpl()); });
+    ASSERT_TRUE(task.PostProcessingImpl());
+    for (std::size_t i = 0; i < c.size(); ++i) {
+      ASSERT_NEAR(c[i], own_c[i], 1e-9);
+    }
+    std::cout << "konkov_i_sparse_matmul_ccs_omp: case=ccs_" << kDenseSize << " run=" << own_multiply << '\n';
+    std::cout << "konkov_i_sparse_matmul_ccs_omp: case=sadikov_I_SparseMatrixMultiplication_" << kDenseSize
+              << " run=" << multiply << '\n';
+  }
+}
+
+// Triangle counting, (L * L) .* L for the strictly lower part L of a random graph's adjacency: the masked
+// product against the full product, which the mask then would have to cut down to the same entries
+TEST(konkov_i_SparseMatmulPerfTest_omp, masked_against_full_product) {
+  constexpr int kVertices = 200000;
+  constexpr int kDegree = 16;
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> vertex(0, kVertices - 1);
+  std::vector<std::vector<int>> lower(kVertices);
+  for (int e = 0; e < kVertices * kDegree / 2; ++e) {
+    const int x = vertex(gen);
+    const int y = vertex(gen);
+    if (x != y) {
+      lower[std::min(x, y)].push_back(std::max(x, y));
+    }
+  }
+  std::vector<double> values;
+  std::vector<int> row_indices;
+  std::vector<int> col_ptr{0};
+  for (auto& column : lower) {
+    std::ranges::sort(column);
+    const auto [first, last] = std::ranges::unique(column);
+    column.erase(first, last);
+    row_indices.insert(row_indices.end(), column.begin(), column.end());
+    values.resize(row_indices.size(), 1.0);
+    col_ptr.push_back(static_cast<int>(row_indices.size()));
+  }
+
+  std::array<double, 2> triangles{};
+  for (const bool masked : {false, true}) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+    task.A_values = task.B_values = values;
+    task.A_row_indices = task.B_row_indices = row_indices;
+    task.A_col_ptr = task.B_col_ptr = col_ptr;
+    if (masked) {
+      task.M_row_indices = row_indices;
+      task.M_col_ptr = col_ptr;
+    }
+    task.rowsA = task.colsA = task.rowsB = task.colsB = kVertices;
+    ASSERT_TRUE(task.ValidationImpl());
+    ASSERT_TRUE(task.PreProcessingImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> run = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    // The full product counted at the positions of L, which the masked one holds only
+    for (int j = 0; j < kVertices; ++j) {
+      auto q = static_cast<std::size_t>(col_ptr[j]);
+      for (int p = task.C_col_ptr[j]; p < task.C_col_ptr[j + 1]; ++p) {
+        while (q < static_cast<std::size_t>(col_ptr[j + 1]) && row_indices[q] < task.C_row_indices[p]) {
+          ++q;
+        }
+        if (q < static_cast<std::size_t>(col_ptr[j + 1]) && row_indices[q] == task.C_row_indices[p]) {
+          triangles[masked ? 1 : 0] += task.C_values[p];
+        }
+      }
+    }
+    std::cout << "konkov_i_sparse_matmul_ccs_omp: case=" << (masked ? "masked" : "full")
+              << " nnz=" << task.C_values.size() << " run=" << run.count() << '\n';
+  }
+  EXPECT_EQ(triangles[0], triangles[1]);
+}
+
+// The benchmark matrix: every structure of ppc::sparse::SparseBenchmarkSuite through the task as it is
+// configured by default, timing PreProcessing and Run together
+TEST(konkov_i_SparseMatmulPerfTest_omp, structured_matrices) {
+  for (const auto& c : ppc::sparse::SparseBenchmarkSuite(1 << 15, 16, 1, ppc::linalg::OmpFor{})) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs_omp::SparseMatmulTask task(task_data);
+    task.A_values = c.a.values;
+    task.A_row_indices = c.a.row_index;
+    task.A_col_ptr = c.a.col_ptr;
+    task.B_values = c.b.values;
+    task.B_row_indices = c.b.row_index;
+    task.B_col_ptr = c.b.col_ptr;
+    task.rowsA = static_cast<int>(c.a.rows);
+    task.colsA = static_cast<int>(c.a.cols);
+    task.rowsB = static_cast<int>(c.b.rows);
+    task.colsB = static_cast<int>(c.b.cols);
+    ASSERT_TRUE(task.ValidationImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    // The task leaves the entries that sum to zero out of C
+    ppc::sparse::CcsMatrix<double> expected;
+    ppc::sparse::SpGemm(c.a.View(), c.b.View(), expected);
+    ppc::sparse::Prune(expected, [](double value) { return value != 0.0; });
+    ASSERT_EQ(task.C_col_ptr, expected.col_ptr) << c.name;
+    ASSERT_EQ(task.C_row_indices, expected.row_index) << c.name;
+    for (std::size_t p = 0; p < expected.values.size(); ++p) {
+      ASSERT_NEAR(task.C_values[p], expected.values[p], 1e-9) << c.name << " " << p;
+    }
+    std::cout << ppc::sparse::FormatSparseRate("konkov_i_sparse_matmul_ccs_omp", c.name,
+                                               ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View()),
+                                               c.a.values.size() + c.b.values.size() + task.C_values.size(),
+                                               elapsed.count())
+              << '\n';
+  }
+}
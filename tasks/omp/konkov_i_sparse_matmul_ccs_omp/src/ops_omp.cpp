@@ -2,82 +2,167 @@
 
 #include <omp.h>
 
-#include <algorithm>
 #include <cstddef>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/bsr_spgemm.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/masked_spgemm.hpp"
+#include "core/sparse/include/reorder.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konkov_i_sparse_matmul_ccs_omp {
 
+namespace {
+
+ppc::sparse::CcsView<double> MakeView(int rows, int cols, const std::vector<int>& col_ptr,
+                                      const std::vector<int>& row_indices, const std::vector<double>& values) {
+  return {.rows = static_cast<std::size_t>(rows),
+          .cols = static_cast<std::size_t>(cols),
+          .col_ptr = col_ptr.data(),
+          .row_index = row_indices.data(),
+          .values = values.data()};
+}
+
+}  // namespace
+
 SparseMatmulTask::SparseMatmulTask(ppc::core::TaskDataPtr task_data) : ppc::core::Task(std::move(task_data)) {}
 
 bool SparseMatmulTask::ValidationImpl() {
   if (colsA != rowsB || rowsA <= 0 || colsB <= 0) {
     return false;
   }
-  if (A_col_ptr.empty() || B_col_ptr.empty()) {
+  if (A_col_ptr.size() != static_cast<std::size_t>(colsA) + 1 ||
+      B_col_ptr.size() != static_cast<std::size_t>(colsB) + 1) {
     return false;
   }
-  return true;
+  if (!M_col_ptr.empty() && (M_col_ptr.size() != static_cast<std::size_t>(colsB) + 1 ||
+                             M_row_indices.size() != static_cast<std::size_t>(M_col_ptr.back()) ||
+                             reordering != ppc::sparse::Reordering::kNone || bsr_block != 1)) {
+    return false;
+  }
+  if (beta != 0.0 && (C_col_ptr.size() != static_cast<std::size_t>(colsB) + 1 ||
+                      C_row_indices.size() != static_cast<std::size_t>(C_col_ptr.back()) ||
+                      C_values.size() != C_row_indices.size())) {
+    return false;
+  }
+  return reordering != ppc::sparse::Reordering::kReverseCuthillMcKee || rowsA == colsA;
 }
 
 bool SparseMatmulTask::PreProcessingImpl() {
-  C_col_ptr.resize(colsB + 1, 0);
+  c_in_ = {};
+  if (beta != 0.0) {
+    c_in_.rows = rowsA;
+    c_in_.cols = colsB;
+    c_in_.col_ptr = std::move(C_col_ptr);
+    c_in_.row_index = std::move(C_row_indices);
+    c_in_.values = std::move(C_values);
+  }
+  C_col_ptr.assign(colsB + 1, 0);
   C_row_indices.clear();
   C_values.clear();
-  return true;
-}
-
-bool SparseMatmulTask::RunImpl() {
-  std::vector<std::unordered_map<int, double>> column_map(colsB);
-
-#pragma omp parallel for
-  for (int col_b = 0; col_b < colsB; ++col_b) {
-    for (int j = B_col_ptr[col_b]; j < B_col_ptr[col_b + 1]; ++j) {
-      int row_b = B_row_indices[j];
-      double val_b = B_values[j];
-
-      if (row_b >= colsA) {
-        continue;
-      }
-
-      for (int k = A_col_ptr[row_b]; k < A_col_ptr[row_b + 1]; ++k) {
-        if (static_cast<size_t>(k) >= A_row_indices.size()) {
-          continue;
-        }
 
-        int row_a = A_row_indices[k];
-        double val_a = A_values[k];
-
-#pragma omp critical
-        column_map[col_b][row_a] += val_a * val_b;
+  row_perm_.clear();
+  col_perm_.clear();
+  if (reordering != ppc::sparse::Reordering::kNone) {
+    const auto a = MakeView(rowsA, colsA, A_col_ptr, A_row_indices, A_values);
+    row_perm_ = ppc::sparse::Reorder(a, reordering);
+    // A symmetric permutation moves the columns of A with its rows and, through them, the rows of B;
+    // the columns of B follow if B is square too
+    std::vector<int> inner_perm;
+    if (reordering == ppc::sparse::Reordering::kReverseCuthillMcKee) {
+      inner_perm = row_perm_;
+      if (rowsB == colsB) {
+        col_perm_ = row_perm_;
       }
     }
+    a_ = ppc::sparse::Permute(a, row_perm_, inner_perm, ppc::linalg::OmpFor{});
+    b_ = ppc::sparse::Permute(MakeView(rowsB, colsB, B_col_ptr, B_row_indices, B_values), inner_perm, col_perm_,
+                              ppc::linalg::OmpFor{});
   }
 
-  C_col_ptr.resize(colsB + 1, 0);
-  int count = 0;
-
-  for (int col = 0; col < colsB; ++col) {
-    std::vector<int> rows;
-    for (const auto& pair : column_map[col]) {
-      if (pair.second != 0) {
-        rows.push_back(pair.first);
-      }
+  // The CCS arrays of A and B are the CRS arrays of A^T and B^T, which are tiled for C^T = B^T * A^T
+  const auto a_t = ppc::sparse::TransposedView(InputA());
+  const auto b_t = ppc::sparse::TransposedView(InputB());
+  block_ = bsr_block;
+  if (block_ == 0) {
+    block_ = ppc::sparse::ChooseBsrBlock(a_t, ppc::sparse::kBsrMaxFill, ppc::linalg::OmpFor{});
+    if (block_ > 1 && ppc::sparse::BsrFill(b_t, block_, ppc::linalg::OmpFor{}) > ppc::sparse::kBsrMaxFill) {
+      block_ = 1;
     }
-    std::ranges::sort(rows);
+  }
+  if (block_ > 1) {
+    a_t_tiles_ = ppc::sparse::CrsToBsr(a_t, block_, ppc::linalg::OmpFor{});
+    b_t_tiles_ = ppc::sparse::CrsToBsr(b_t, block_, ppc::linalg::OmpFor{});
+  }
+  return true;
+}
 
-    for (int row : rows) {
-      C_values.push_back(column_map[col][row]);
-      C_row_indices.push_back(row);
-      count++;
-    }
-    C_col_ptr[col + 1] = count;
+ppc::sparse::CcsView<double> SparseMatmulTask::InputA() const {
+  if (reordering != ppc::sparse::Reordering::kNone) {
+    return a_.View();
+  }
+  return MakeView(rowsA, colsA, A_col_ptr, A_row_indices, A_values);
+}
+
+ppc::sparse::CcsView<double> SparseMatmulTask::InputB() const {
+  if (reordering != ppc::sparse::Reordering::kNone) {
+    return b_.View();
   }
+  return MakeView(rowsB, colsB, B_col_ptr, B_row_indices, B_values);
+}
+
+ppc::sparse::CcsView<double> SparseMatmulTask::Mask() const {
+  // MaskedSpGemm reads the positions of the mask only
+  return {.rows = static_cast<std::size_t>(rowsA),
+          .cols = static_cast<std::size_t>(colsB),
+          .col_ptr = M_col_ptr.data(),
+          .row_index = M_row_indices.data(),
+          .values = nullptr};
+}
 
+bool SparseMatmulTask::RunImpl() {
+  const bool accumulate = alpha != 1.0 || beta != 0.0;
+  bool accumulated = false;
+  if (!M_col_ptr.empty()) {
+    ppc::sparse::MaskedSpGemm(InputA(), InputB(), Mask(), c_, ppc::linalg::OmpFor{});
+  } else if (block_ > 1) {
+    ppc::sparse::BsrMatrix<double> c_t;
+    ppc::sparse::SpGemm(b_t_tiles_.View(), a_t_tiles_.View(), c_t, ppc::linalg::OmpFor{});
+    // The nonzeros of C^T in CRS, without the zeros of the tiles, are those of C in CCS
+    ppc::sparse::CrsMatrix<double> c = ppc::sparse::BsrToCrs(c_t.View(), ppc::linalg::OmpFor{});
+    c_.rows = c.cols;
+    c_.cols = c.rows;
+    c_.col_ptr = std::move(c.row_ptr);
+    c_.row_index = std::move(c.col_index);
+    c_.values = std::move(c.values);
+  } else if (accumulate && reordering == ppc::sparse::Reordering::kNone) {
+    // alpha applied as the product is stored and the product merged into C in one go; C_* are kept in
+    // c_in_ so that Run can be repeated
+    c_ = c_in_;
+    ppc::sparse::SpGemmAxpby(alpha, InputA(), InputB(), beta, c_, ppc::linalg::OmpFor{});
+    accumulated = true;
+  } else {
+    ppc::sparse::SpGemm(InputA(), InputB(), c_, ppc::linalg::OmpFor{});
+  }
+  if (reordering != ppc::sparse::Reordering::kNone) {
+    c_ = ppc::sparse::Permute(c_.View(), ppc::sparse::InversePermutation(row_perm_),
+                              ppc::sparse::InversePermutation(col_perm_), ppc::linalg::OmpFor{});
+  }
+  if (accumulate && !accumulated) {
+    ppc::sparse::CcsMatrix<double> sum = c_in_;
+    ppc::sparse::Axpby(alpha, c_.View(), beta, sum, ppc::linalg::OmpFor{});
+    c_ = std::move(sum);
+  }
+  // Products and sums that cancel out exactly are not stored
+  ppc::sparse::Prune(c_, [](double value) { return value != 0.0; });
+  C_values = std::move(c_.values);
+  C_row_indices = std::move(c_.row_index);
+  C_col_ptr = std::move(c_.col_ptr);
   return true;
 }
 
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korotin_e_crs_multiplication_omp {
@@ -19,6 +21,8 @@ class CrsMultiplicationOMP : public ppc::core::Task {
   std::vector<double> A_val_, B_val_, output_val_;
   std::vector<unsigned int> A_col_, A_rI_, B_col_, B_rI_, output_col_, output_rI_;
   unsigned int A_N_, A_Nz_, B_N_, B_Nz_;
+  // B by columns, built by the first Run after PreProcessing and reused by the next ones
+  std::optional<ppc::sparse::CcsMatrix<double, unsigned int>> B_t_;
 };
 
 std::vector<double> GetRandomMatrix(unsigned int m, unsigned int n);
@@ -1,11 +1,17 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/korotin_e_crs_multiplication/include/ops_omp.hpp"
 
@@ -152,3 +158,63 @@ TEST(korotin_e_crs_multiplication_omp, test_task_run) {
   ASSERT_EQ(c_col, out_col);
   ASSERT_EQ(c_val, out_val);
 }
+
+// The benchmark matrix: every structure of ppc::sparse::SparseBenchmarkSuite through the task, timing
+// PreProcessing and Run together. The task takes A and B in CRS and computes every row of A against every
+// column of B, so the matrices are kept small. Sums that come out exactly zero are left out of C, so C is
+// compared with the product of ppc::sparse::SpGemm as a dense matrix.
+TEST(korotin_e_crs_multiplication_omp, structured_matrices) {
+  auto to_dense = [](std::size_t rows, std::size_t cols, const std::vector<unsigned int> &row_ptr,
+                     const std::vector<unsigned int> &col_index, const std::vector<double> &values) {
+    std::vector<double> dense(rows * cols);
+    for (std::size_t i = 0; i < rows; ++i) {
+      for (unsigned int p = row_ptr[i]; p < row_ptr[i + 1]; ++p) {
+        dense[(i * cols) + col_index[p]] = values[p];
+      }
+    }
+    return dense;
+  };
+  for (const auto &c : ppc::sparse::SparseBenchmarkSuite<double, unsigned int>(512, 8)) {
+    ppc::sparse::CcsMatrix<double, unsigned int> expected;
+    ppc::sparse::SpGemm(c.a.View(), c.b.View(), expected);
+    const auto expected_crs = ppc::sparse::CcsToCrs(expected.View());
+
+    auto a = ppc::sparse::CcsToCrs(c.a.View());
+    auto b = ppc::sparse::CcsToCrs(c.b.View());
+    std::vector<unsigned int> out_ri(a.row_ptr.size(), 0);
+    std::vector<unsigned int> out_col(expected.values.size());
+    std::vector<double> out_val(expected.values.size());
+
+    auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+    for (auto *matrix : {&a, &b}) {
+      task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix->row_ptr.data()));
+      task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix->col_index.data()));
+      task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix->values.data()));
+      task_data_omp->inputs_count.emplace_back(matrix->row_ptr.size());
+      task_data_omp->inputs_count.emplace_back(matrix->col_index.size());
+      task_data_omp->inputs_count.emplace_back(matrix->values.size());
+    }
+    task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_ri.data()));
+    task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_col.data()));
+    task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_val.data()));
+    task_data_omp->outputs_count.emplace_back(out_ri.size());
+
+    korotin_e_crs_multiplication_omp::CrsMultiplicationOMP task(task_data_omp);
+    ASSERT_TRUE(task.ValidationImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    const std::vector<double> result = to_dense(c.a.rows, c.b.cols, out_ri, out_col, out_val);
+    const std::vector<double> expected_dense =
+        to_dense(c.a.rows, c.b.cols, expected_crs.row_ptr, expected_crs.col_index, expected_crs.values);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      ASSERT_NEAR(result[i], expected_dense[i], 1e-9) << c.name << " " << i;
+    }
+    std::cout << ppc::sparse::FormatSparseRate("korotin_e_crs_multiplication_omp", c.name,
+                                               ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View()),
+                                               c.a.values.size() + c.b.values.size() + out_ri.back(), elapsed.count())
+              << '\n';
+  }
+}
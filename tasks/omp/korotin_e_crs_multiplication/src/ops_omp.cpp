@@ -7,6 +7,10 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::PreProcessingImpl() {
   A_N_ = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<unsigned int *>(task_data->inputs[0]);
@@ -32,6 +36,7 @@ bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::PreProcessingImpl()
 
   unsigned int output_size = task_data->outputs_count[0];
   output_rI_ = std::vector<unsigned int>(output_size);
+  B_t_.reset();
 
   return true;
 }
@@ -46,29 +51,20 @@ bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::ValidationImpl() {
 }
 
 bool korotin_e_crs_multiplication_omp::CrsMultiplicationOMP::RunImpl() {
-  std::vector<unsigned int> tr_i(*std::ranges::max_element(B_col_.begin(), B_col_.end()) + 2, 0);
+  if (!B_t_) {
+    const ppc::sparse::CrsView<double, unsigned int> b{
+        .rows = B_N_ - 1,
+        .cols = B_col_.empty() ? 0 : *std::ranges::max_element(B_col_) + std::size_t{1},
+        .row_ptr = B_rI_.data(),
+        .col_index = B_col_.data(),
+        .values = B_val_.data()};
+    B_t_ = ppc::sparse::CrsToCcs(b, ppc::linalg::OmpFor{});
+  }
+  const std::vector<unsigned int> &tr_i = B_t_->col_ptr;
+  const std::vector<unsigned int> &tcol = B_t_->row_index;
+  const std::vector<double> &tval = B_t_->values;
   unsigned int i = 0;
   unsigned int j = 0;
-  for (i = 0; i < B_Nz_; i++) {
-    tr_i[B_col_[i] + 1]++;
-  }
-  for (i = 1; i < tr_i.size(); i++) {
-    tr_i[i] += tr_i[i - 1];
-  }
-
-  std::vector<unsigned int> tcol(B_Nz_, 0);
-  std::vector<double> tval(B_Nz_, 0);
-  for (i = 0; i < B_N_ - 1; i++) {
-    for (j = B_rI_[i]; j < B_rI_[i + 1]; j++) {
-      tval[tr_i[B_col_[j]]] = B_val_[j];
-      tcol[tr_i[B_col_[j]]] = i;
-      tr_i[B_col_[j]]++;
-    }
-  }
-  for (i = tr_i.size() - 1; i > 0; i--) {
-    tr_i[i] = tr_i[i - 1];
-  }
-  tr_i[0] = 0;
 
   unsigned int ai = 0;
   unsigned int bt = 0;
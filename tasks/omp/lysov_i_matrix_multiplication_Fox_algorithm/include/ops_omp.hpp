@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lysov_i_matrix_multiplication_fox_algorithm_omp {
@@ -11,7 +12,8 @@ void TrivialMatrixMultiplication(const std::vector<double> &matrix_a, const std:
                                  std::vector<double> &result_matrix, std::size_t matrix_size);
 std::vector<double> GetRandomMatrix(size_t size, int min_gen_value, int max_gen_value);
 void ProcessBlock(const std::vector<double> &a, const std::vector<double> &b, std::vector<double> &c, std::size_t i,
-                  std::size_t j, std::size_t a_block_row, std::size_t block_size, std::size_t n);
+                  std::size_t j, std::size_t a_block_row, std::size_t block_size, std::size_t n,
+                  ppc::linalg::GemmWorkspace<double> &workspace);
 
 class TestTaskOpenMP : public ppc::core::Task {
  public:
@@ -27,6 +29,7 @@ class TestTaskOpenMP : public ppc::core::Task {
   std::vector<double> c_;
   std::size_t n_;
   std::size_t block_size_;
+  std::vector<ppc::linalg::GemmWorkspace<double>> workspaces_;
 };
 
 }  // namespace lysov_i_matrix_multiplication_fox_algorithm_omp
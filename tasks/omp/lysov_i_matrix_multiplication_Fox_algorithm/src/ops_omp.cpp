@@ -7,11 +7,14 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+
 void lysov_i_matrix_multiplication_fox_algorithm_omp::ProcessBlock(const std::vector<double> &a,
                                                                    const std::vector<double> &b, std::vector<double> &c,
                                                                    std::size_t i, std::size_t j,
                                                                    std::size_t a_block_row, std::size_t block_size,
-                                                                   std::size_t n) {
+                                                                   std::size_t n,
+                                                                   ppc::linalg::GemmWorkspace<double> &workspace) {
   std::size_t block_h = std::min(block_size, n - (i * block_size));
   std::size_t block_w = std::min(block_size, n - (j * block_size));
   std::size_t block_k = std::min(block_size, n - (a_block_row * block_size));
@@ -20,22 +23,7 @@ void lysov_i_matrix_multiplication_fox_algorithm_omp::ProcessBlock(const std::ve
   const double *a_ptr = &a[((i * block_size) * n) + (a_block_row * block_size)];
   const double *b_ptr = &b[((a_block_row * block_size) * n) + (j * block_size)];
 
-  for (std::size_t ii = 0; ii < block_h; ++ii) {
-    for (std::size_t jj = 0; jj < block_w; ++jj) {
-      double sum = 0.0;
-      const double *a_row = a_ptr + (ii * n);
-      const double *b_col = b_ptr + (jj);
-
-      for (std::size_t kk = 0; kk + 1 < block_k; kk += 2) {
-        sum += a_row[kk] * b_col[kk * n] + a_row[kk + 1] * b_col[(kk + 1) * n];
-      }
-      if (block_k % 2 != 0) {
-        sum += a_row[block_k - 1] * b_col[(block_k - 1) * n];
-      }
-
-      c_ptr[(ii * n) + jj] += sum;
-    }
-  }
+  ppc::linalg::Gemm(block_h, block_w, block_k, 1.0, a_ptr, n, b_ptr, n, 1.0, c_ptr, n, workspace);
 }
 // Init value
 bool lysov_i_matrix_multiplication_fox_algorithm_omp::TestTaskOpenMP::PreProcessingImpl() {
@@ -45,6 +33,10 @@ bool lysov_i_matrix_multiplication_fox_algorithm_omp::TestTaskOpenMP::PreProcess
   b_.resize(n_ * n_);
   c_.clear();
   c_.resize(n_ * n_, 0.0);
+  workspaces_.resize(omp_get_max_threads());
+  for (auto &workspace : workspaces_) {
+    workspace.Reserve(block_size_, block_size_, block_size_);
+  }
   std::copy(reinterpret_cast<double *>(task_data->inputs[1]),
             reinterpret_cast<double *>(task_data->inputs[1]) + (n_ * n_), a_.begin());
   std::copy(reinterpret_cast<double *>(task_data->inputs[2]),
@@ -66,13 +58,15 @@ bool lysov_i_matrix_multiplication_fox_algorithm_omp::TestTaskOpenMP::Validation
 
 bool lysov_i_matrix_multiplication_fox_algorithm_omp::TestTaskOpenMP::RunImpl() {
   int num_blocks = static_cast<int>((n_ + block_size_ - 1) / block_size_);
-#pragma omp parallel
-  for (int step = 0; step < num_blocks; ++step) {
-#pragma omp for schedule(static) nowait
-    for (int i = 0; i < num_blocks; ++i) {
-      for (int j = 0; j < num_blocks; ++j) {
+  // Every block of C is owned by one thread, which runs all the Fox steps for it,
+  // so the steps accumulate into C with no synchronization at all
+#pragma omp parallel for collapse(2) schedule(static)
+  for (int i = 0; i < num_blocks; ++i) {
+    for (int j = 0; j < num_blocks; ++j) {
+      auto &workspace = workspaces_[omp_get_thread_num()];
+      for (int step = 0; step < num_blocks; ++step) {
         int a_block_row = (i + step) % num_blocks;
-        ProcessBlock(a_, b_, c_, i, j, a_block_row, block_size_, n_);
+        ProcessBlock(a_, b_, c_, i, j, a_block_row, block_size_, n_, workspace);
       }
     }
   }
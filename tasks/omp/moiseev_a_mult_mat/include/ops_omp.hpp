@@ -18,8 +18,6 @@ class MultMatOMP : public ppc::core::Task {
  private:
   std::vector<double> matrix_a_, matrix_b_, matrix_c_;
   int matrix_size_{};
-  int num_blocks_{};
-  int block_size_{};
 };
 
 }  // namespace moiseev_a_mult_mat_omp
@@ -17,14 +17,14 @@ class CanonMatrix {
  public:
   CanonMatrix() = default;
   CanonMatrix(const std::vector<double>& initial_vector);
-  void SetBaseMatrix(const std::vector<double>& initial_vector);
+  void SetBaseMatrix(std::vector<double>&& initial_vector);
   void Transpose();
   void StairShift();
   void PreRoutine(MatrixType type);
   [[nodiscard]] const std::vector<double>& GetMatrix() const;
   [[nodiscard]] size_t GetSize() const;
-  CanonMatrix MultiplicateMatrix(const CanonMatrix& canon_matrix, size_t offset);
-  void operator+=(const CanonMatrix& canon_matrix);
+  // Writes the given row of the full product, summed over all the offsets, to row_out
+  void AccumulateRow(const CanonMatrix& canon_matrix, size_t row, double* row_out) const;
   void ClearMatrix();
 };
 }  // namespace sarafanov_m_canon_mat_mul_omp
\ No newline at end of file
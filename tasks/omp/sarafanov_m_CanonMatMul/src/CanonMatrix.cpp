@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/transpose.hpp"
 #include "utility"
 
 namespace sarafanov_m_canon_mat_mul_omp {
@@ -22,10 +23,10 @@ void CanonMatrix::PreRoutine(MatrixType type) {
   StairShift();
 }
 
-void CanonMatrix::SetBaseMatrix(const std::vector<double>& initial_vector) {
+void CanonMatrix::SetBaseMatrix(std::vector<double>&& initial_vector) {
   if (matrix_.empty()) {
     CalculateSize(initial_vector.size());
-    matrix_ = initial_vector;
+    matrix_ = std::move(initial_vector);
   }
 }
 
@@ -60,46 +61,21 @@ void CanonMatrix::StairShift() {
 
 const std::vector<double>& CanonMatrix::GetMatrix() const { return matrix_; }
 
-CanonMatrix CanonMatrix::MultiplicateMatrix(const CanonMatrix& canon_matrix, size_t offset) {
-  std::vector<double> c_matrix(size_ * size_);
+void CanonMatrix::AccumulateRow(const CanonMatrix& canon_matrix, size_t row, double* row_out) const {
   const auto& b_matrix = canon_matrix.GetMatrix();
-  for (size_t i = 0; i < size_; ++i) {
-    for (size_t j = 0; j < size_; ++j) {
-      c_matrix[(i * size_) + j] = matrix_[GetRowIndex((i * size_) + j + offset, i + 1)] *
-                                  b_matrix[GetColumnIndex((j * size_) + i, j + 1, offset)];
+  for (size_t j = 0; j < size_; ++j) {
+    double sum = 0.0;
+    for (size_t offset = 0; offset < size_; ++offset) {
+      sum += matrix_[GetRowIndex((row * size_) + j + offset, row + 1)] *
+             b_matrix[GetColumnIndex((j * size_) + row, j + 1, offset)];
     }
+    row_out[j] = sum;
   }
-  return {c_matrix};
 }
 
 size_t CanonMatrix::GetSize() const { return size_; }
 
-void CanonMatrix::operator+=(const CanonMatrix& canon_matrix) {
-  if (matrix_.empty()) {
-    size_ = canon_matrix.GetSize();
-    matrix_.resize(size_ * size_);
-  }
-  const auto& b_matrix = canon_matrix.GetMatrix();
-#pragma omp parallel
-  {
-#pragma omp for
-    for (int i = 0; i < static_cast<int>(size_); ++i) {
-      for (int j = 0; j < static_cast<int>(size_); ++j) {
-        matrix_[(i * size_) + j] += b_matrix[(j * size_) + i];
-      }
-    }
-  }
-}
-
-void CanonMatrix::Transpose() {
-  std::vector<double> new_matrix(size_ * size_);
-  for (size_t i = 0; i < size_; ++i) {
-    for (size_t j = 0; j < size_; ++j) {
-      new_matrix[(i * size_) + j] = matrix_[(j * size_) + i];
-    }
-  }
-  matrix_ = std::move(new_matrix);
-}
+void CanonMatrix::Transpose() { ppc::linalg::TransposeInPlace(size_, matrix_.data(), size_); }
 
 void CanonMatrix::ClearMatrix() {
   matrix_.clear();
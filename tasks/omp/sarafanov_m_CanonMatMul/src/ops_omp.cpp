@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "omp/sarafanov_m_CanonMatMul/include/CanonMatrix.hpp"
@@ -24,7 +25,7 @@ bool sarafanov_m_canon_mat_mul_omp::CanonMatMulOMP::PreProcessingImpl() {
     matrix_a = ConvertToSquareMatrix(std::max(rows1, columns1),
                                      rows1 > columns1 ? MatrixType::kRowMatrix : MatrixType::kColumnMatrix, matrix_a);
   }
-  a_matrix_.SetBaseMatrix(matrix_a);
+  a_matrix_.SetBaseMatrix(std::move(matrix_a));
   a_matrix_.PreRoutine(MatrixType::kRowMatrix);
   int rows2 = static_cast<int>(task_data->inputs_count[2]);
   int columns2 = static_cast<int>(task_data->inputs_count[3]);
@@ -37,7 +38,7 @@ bool sarafanov_m_canon_mat_mul_omp::CanonMatMulOMP::PreProcessingImpl() {
     matrix_b = ConvertToSquareMatrix(std::max(rows2, columns2),
                                      rows2 > columns2 ? MatrixType::kRowMatrix : MatrixType::kColumnMatrix, matrix_b);
   }
-  b_matrix_.SetBaseMatrix(matrix_b);
+  b_matrix_.SetBaseMatrix(std::move(matrix_b));
   b_matrix_.PreRoutine(MatrixType::kColumnMatrix);
   return true;
 }
@@ -87,18 +88,15 @@ bool sarafanov_m_canon_mat_mul_omp::CanonMatMulOMP::ValidationImpl() {
 
 bool sarafanov_m_canon_mat_mul_omp::CanonMatMulOMP::RunImpl() {
   c_matrix_.ClearMatrix();
-  std::vector<CanonMatrix> mul_results(a_matrix_.GetSize());
-#pragma omp parallel
-  {
-#pragma omp for
-    for (int i = 0; i < static_cast<int>(a_matrix_.GetSize()); ++i) {
-      mul_results[i] = a_matrix_.MultiplicateMatrix(b_matrix_, i);
-    }
+  const auto size = static_cast<int>(a_matrix_.GetSize());
+  std::vector<double> result(a_matrix_.GetSize() * a_matrix_.GetSize());
+  // Every row of the result is owned by one thread, which sums all the offsets for it
+  // in place, so there are no per-offset products to reduce afterwards
+#pragma omp parallel for schedule(static)
+  for (int i = 0; i < size; ++i) {
+    a_matrix_.AccumulateRow(b_matrix_, i, result.data() + (i * size));
   }
-  for (auto &it : mul_results) {
-    c_matrix_ += it;
-  }
-  c_matrix_.Transpose();
+  c_matrix_.SetBaseMatrix(std::move(result));
   return true;
 }
 
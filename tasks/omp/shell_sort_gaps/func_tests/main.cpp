@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/sort/include/shell_sort.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/shell_sort_gaps/include/ops_omp.hpp"
+
+namespace {
+
+using shell_sort_gaps_omp::GapSequence;
+
+std::vector<int> GenerateRandomVector(std::size_t size, int min_value, int max_value) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dis(min_value, max_value);
+  std::vector<int> vec(size);
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+std::vector<int> RunTask(std::vector<int> input, GapSequence sequence) {
+  std::vector<int> output(input.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&sequence));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  shell_sort_gaps_omp::ShellSortOpenMP task(task_data);
+  EXPECT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  return output;
+}
+
+void CheckAllSequences(const std::vector<int> &input) {
+  std::vector<int> expected = input;
+  std::ranges::sort(expected);
+  for (auto sequence : {GapSequence::kCiura, GapSequence::kSedgewick, GapSequence::kTokuda}) {
+    EXPECT_EQ(RunTask(input, sequence), expected) << "sequence " << static_cast<int>(sequence);
+  }
+}
+
+}  // namespace
+
+TEST(shell_sort_gaps_omp, sort_empty) { CheckAllSequences({}); }
+
+TEST(shell_sort_gaps_omp, sort_single) { CheckAllSequences({42}); }
+
+TEST(shell_sort_gaps_omp, sort_small_with_negatives) { CheckAllSequences({1, 5, -7, 3, 7, -3, 8, 4, -1, 6, 0, -7}); }
+
+TEST(shell_sort_gaps_omp, sort_reversed) {
+  std::vector<int> input(5000);
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<int>(input.size() - i);
+  }
+  CheckAllSequences(input);
+}
+
+TEST(shell_sort_gaps_omp, sort_random_1000) { CheckAllSequences(GenerateRandomVector(1000, -1000, 1000)); }
+
+// Larger than one block, so the blocked small-gap passes and the seam repair are exercised
+TEST(shell_sort_gaps_omp, sort_random_multi_block) {
+  CheckAllSequences(GenerateRandomVector((3 * ppc::sort::kShellBlock) + 17, -100000, 100000));
+}
+
+TEST(shell_sort_gaps_omp, sort_few_unique_multi_block) {
+  CheckAllSequences(GenerateRandomVector((2 * ppc::sort::kShellBlock) + 5, 0, 3));
+}
+
+TEST(shell_sort_gaps_omp, validation_fails_on_unknown_sequence) {
+  std::vector<int> input = {3, 2, 1};
+  std::vector<int> output(input.size());
+  std::uint8_t sequence = 3;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->inputs.emplace_back(&sequence);
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  shell_sort_gaps_omp::ShellSortOpenMP task(task_data);
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(shell_sort_gaps_omp, validation_fails_without_sequence) {
+  std::vector<int> input = {3, 2, 1};
+  std::vector<int> output(input.size());
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  shell_sort_gaps_omp::ShellSortOpenMP task(task_data);
+  EXPECT_FALSE(task.Validation());
+}
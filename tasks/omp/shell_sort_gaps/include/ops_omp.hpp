@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/sort/include/shell_sort.hpp"
+#include "core/task/include/task.hpp"
+
+namespace shell_sort_gaps_omp {
+
+using ppc::sort::GapSequence;
+
+// inputs[0]  - int array, inputs_count[0] - its size
+// inputs[1]  - GapSequence to use (inputs_count[1] == 1)
+// outputs[0] - sorted int array of the same size
+class ShellSortOpenMP : public ppc::core::Task {
+ public:
+  explicit ShellSortOpenMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  std::vector<int> data_;
+  std::vector<std::size_t> gaps_;
+};
+
+}  // namespace shell_sort_gaps_omp
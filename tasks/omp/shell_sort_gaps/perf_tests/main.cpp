@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/shell_sort_gaps/include/ops_omp.hpp"
+
+namespace {
+
+using shell_sort_gaps_omp::GapSequence;
+
+constexpr std::size_t kCount = 5000000;
+
+std::vector<int> GenerateRandomVector(std::size_t size) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dis;
+  std::vector<int> vec(size);
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+const char *SequenceName(GapSequence sequence) {
+  switch (sequence) {
+    case GapSequence::kCiura:
+      return "ciura";
+    case GapSequence::kSedgewick:
+      return "sedgewick";
+    case GapSequence::kTokuda:
+      return "tokuda";
+  }
+  return "unknown";
+}
+
+// Returns the perf results of sorting the input; output receives the sorted array
+std::shared_ptr<ppc::core::PerfResults> RunPerf(std::vector<int> &input, std::vector<int> &output,
+                                                GapSequence &sequence, bool pipeline, std::uint64_t num_running) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&sequence));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  auto task = std::make_shared<shell_sort_gaps_omp::ShellSortOpenMP>(task_data);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = num_running;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  if (pipeline) {
+    perf_analyzer->PipelineRun(perf_attr, perf_results);
+  } else {
+    perf_analyzer->TaskRun(perf_attr, perf_results);
+  }
+  return perf_results;
+}
+
+}  // namespace
+
+TEST(shell_sort_gaps_omp, test_pipeline_run) {
+  std::vector<int> in = GenerateRandomVector(kCount);
+  std::vector<int> out(in.size());
+  GapSequence sequence = GapSequence::kCiura;
+
+  ppc::core::Perf::PrintPerfStatistic(RunPerf(in, out, sequence, true, 5));
+  std::ranges::sort(in);
+  EXPECT_EQ(out, in);
+}
+
+TEST(shell_sort_gaps_omp, test_task_run) {
+  std::vector<int> in = GenerateRandomVector(kCount);
+  std::vector<int> out(in.size());
+  GapSequence sequence = GapSequence::kCiura;
+
+  ppc::core::Perf::PrintPerfStatistic(RunPerf(in, out, sequence, false, 5));
+  std::ranges::sort(in);
+  EXPECT_EQ(out, in);
+}
+
+// Compares the gap sequences on the same input for several array sizes
+TEST(shell_sort_gaps_omp, benchmark_sequences) {
+  for (std::size_t size : {std::size_t{100000}, std::size_t{1000000}, std::size_t{4000000}}) {
+    std::vector<int> in = GenerateRandomVector(size);
+    std::vector<int> expected = in;
+    std::ranges::sort(expected);
+    for (auto sequence : {GapSequence::kCiura, GapSequence::kSedgewick, GapSequence::kTokuda}) {
+      std::vector<int> out(in.size());
+      const auto perf_results = RunPerf(in, out, sequence, false, 3);
+      std::cout << "shell_sort_gaps_omp benchmark: sequence=" << SequenceName(sequence) << " n=" << size
+                << " time=" << perf_results->time_sec << '\n';
+      EXPECT_EQ(out, expected);
+    }
+  }
+}
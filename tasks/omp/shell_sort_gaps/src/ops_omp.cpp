@@ -0,0 +1,33 @@
+#include "omp/shell_sort_gaps/include/ops_omp.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sort/include/shell_sort.hpp"
+
+bool shell_sort_gaps_omp::ShellSortOpenMP::PreProcessingImpl() {
+  auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
+  data_ = std::vector<int>(in_ptr, in_ptr + task_data->inputs_count[0]);
+  const auto sequence = *reinterpret_cast<GapSequence *>(task_data->inputs[1]);
+  gaps_ = ppc::sort::MakeGaps(sequence, data_.size());
+  return true;
+}
+
+bool shell_sort_gaps_omp::ShellSortOpenMP::ValidationImpl() {
+  return task_data->inputs.size() == 2 && task_data->inputs_count.size() == 2 && task_data->inputs_count[1] == 1 &&
+         task_data->inputs[1] != nullptr &&
+         *reinterpret_cast<std::uint8_t *>(task_data->inputs[1]) <= static_cast<std::uint8_t>(GapSequence::kTokuda) &&
+         task_data->inputs_count[0] == task_data->outputs_count[0];
+}
+
+bool shell_sort_gaps_omp::ShellSortOpenMP::RunImpl() {
+  ppc::sort::ParallelShellSort(data_.data(), data_.size(), gaps_, ppc::linalg::OmpFor{});
+  return true;
+}
+
+bool shell_sort_gaps_omp::ShellSortOpenMP::PostProcessingImpl() {
+  std::ranges::copy(data_, reinterpret_cast<int *>(task_data->outputs[0]));
+  return true;
+}
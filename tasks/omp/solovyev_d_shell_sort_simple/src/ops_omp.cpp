@@ -1,9 +1,11 @@
 #include "omp/solovyev_d_shell_sort_simple/include/ops_omp.hpp"
 
-#include <cmath>
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sort/include/shell_sort.hpp"
+
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   auto *in_ptr = reinterpret_cast<int *>(task_data->inputs[0]);
@@ -17,20 +19,9 @@ bool solovyev_d_shell_sort_simple_omp::TaskOMP::ValidationImpl() {
 }
 
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::RunImpl() {
-  for (int gap = (int)input_.size() / 2; gap > 0; gap /= 2) {
-#pragma omp parallel for
-    for (int i = 0; i < gap; i++) {
-      for (int f = gap + i; f < (int)input_.size(); f = f + gap) {
-        int val = input_[f];
-        int j = f;
-        while (j >= gap && input_[j - gap] > val) {
-          input_[j] = input_[j - gap];
-          j -= gap;
-        }
-        input_[j] = val;
-      }
-    }
-  }
+  ppc::sort::ParallelShellSort(input_.data(), input_.size(),
+                               ppc::sort::MakeGaps(ppc::sort::GapSequence::kCiura, input_.size()),
+                               ppc::linalg::OmpFor{});
   return true;
 }
 bool solovyev_d_shell_sort_simple_omp::TaskOMP::PostProcessingImpl() {
@@ -3,9 +3,14 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
 namespace sorokin_a_multiplication_sparse_matrices_double_ccs_omp {
 void MultiplyCCS(const std::vector<double> &a_values, const std::vector<int> &a_row_indices, int m,
                  const std::vector<int> &a_col_ptr, const std::vector<double> &b_values,
@@ -15,87 +20,52 @@ void MultiplyCCS(const std::vector<double> &a_values, const std::vector<int> &a_
     throw std::invalid_argument("Invalid val pointer size");
   }
 
-  c_col_ptr.resize(n + 1);
-  std::vector<int> nnz_per_column(n, 0);
-
-#pragma omp parallel for
-  for (int j = 0; j < n; ++j) {
-    std::vector<bool> temp_used(m, false);
-    for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-      int row_b = b_row_indices[t];
-      for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-        int row_a = a_row_indices[i];
-        if (!temp_used[row_a]) {
-          temp_used[row_a] = true;
-          nnz_per_column[j]++;
-        }
-      }
-    }
-  }
+  const ppc::sparse::CcsView<double> a{.rows = static_cast<std::size_t>(m),
+                                       .cols = static_cast<std::size_t>(k),
+                                       .col_ptr = a_col_ptr.data(),
+                                       .row_index = a_row_indices.data(),
+                                       .values = a_values.data()};
+  const ppc::sparse::CcsView<double> b{.rows = static_cast<std::size_t>(k),
+                                       .cols = static_cast<std::size_t>(n),
+                                       .col_ptr = b_col_ptr.data(),
+                                       .row_index = b_row_indices.data(),
+                                       .values = b_values.data()};
+  ppc::sparse::CcsMatrix<double> c;
+  ppc::sparse::SpGemm(a, b, c, ppc::linalg::OmpFor{});
+  c_values = std::move(c.values);
+  c_row_indices = std::move(c.row_index);
+  c_col_ptr = std::move(c.col_ptr);
+}
+}  // namespace sorokin_a_multiplication_sparse_matrices_double_ccs_omp
 
-  c_col_ptr[0] = 0;
-  for (int j = 0; j < n; ++j) {
-    c_col_ptr[j + 1] = c_col_ptr[j] + nnz_per_column[j];
-  }
+namespace {
 
-  int total_nnz = c_col_ptr[n];
-  c_values.resize(total_nnz);
-  c_row_indices.resize(total_nnz);
-#pragma omp parallel for
-  for (int j = 0; j < n; ++j) {
-    std::vector<double> temp_values(m, 0.0);
-    std::vector<bool> temp_used(m, false);
+std::vector<double> ReadValues(const uint8_t *data, unsigned count) {
+  const auto *values = reinterpret_cast<const double *>(data);
+  return {values, values + count};
+}
 
-    for (int t = b_col_ptr[j]; t < b_col_ptr[j + 1]; ++t) {
-      int row_b = b_row_indices[t];
-      double val_b = b_values[t];
-      for (int i = a_col_ptr[row_b]; i < a_col_ptr[row_b + 1]; ++i) {
-        int row_a = a_row_indices[i];
-        temp_values[row_a] += a_values[i] * val_b;
-        temp_used[row_a] = true;
-      }
-    }
-    int pos = c_col_ptr[j];
-    for (int i = 0; i < m; ++i) {
-      if (temp_used[i]) {
-        c_row_indices[pos] = i;
-        c_values[pos] = temp_values[i];
-        pos++;
-      }
-    }
-  }
+// The indices come as doubles and are converted straight into the index arrays
+std::vector<int> ReadIndices(const uint8_t *data, unsigned count) {
+  const auto *indices = reinterpret_cast<const double *>(data);
+  std::vector<int> result(count);
+  std::ranges::transform(indices, indices + count, result.begin(), [](double x) { return static_cast<int>(x); });
+  return result;
 }
-}  // namespace sorokin_a_multiplication_sparse_matrices_double_ccs_omp
+
+}  // namespace
 
 bool sorokin_a_multiplication_sparse_matrices_double_ccs_omp::TestTaskOpenMP::PreProcessingImpl() {
   // Init value for input and output
   M_ = static_cast<int>(task_data->inputs_count[0]);
   K_ = static_cast<int>(task_data->inputs_count[1]);
   N_ = static_cast<int>(task_data->inputs_count[2]);
-  auto *current_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
-  A_values_ = std::vector<double>(current_ptr, current_ptr + task_data->inputs_count[3]);
-  current_ptr = reinterpret_cast<double *>(task_data->inputs[1]);
-  std::vector<double> a_row_indices_d = std::vector<double>(current_ptr, current_ptr + task_data->inputs_count[4]);
-  A_row_indices_.resize(a_row_indices_d.size());
-  std::ranges::transform(a_row_indices_d.begin(), a_row_indices_d.end(), A_row_indices_.begin(),
-                         [](double x) { return static_cast<int>(x); });
-  current_ptr = reinterpret_cast<double *>(task_data->inputs[2]);
-  std::vector<double> a_col_ptr_d = std::vector<double>(current_ptr, current_ptr + task_data->inputs_count[5]);
-  A_col_ptr_.resize(a_col_ptr_d.size());
-  std::ranges::transform(a_col_ptr_d.begin(), a_col_ptr_d.end(), A_col_ptr_.begin(),
-                         [](double x) { return static_cast<int>(x); });
-  current_ptr = reinterpret_cast<double *>(task_data->inputs[3]);
-  B_values_ = std::vector<double>(current_ptr, current_ptr + task_data->inputs_count[6]);
-  current_ptr = reinterpret_cast<double *>(task_data->inputs[4]);
-  std::vector<double> b_row_indices_d = std::vector<double>(current_ptr, current_ptr + task_data->inputs_count[7]);
-  B_row_indices_.resize(b_row_indices_d.size());
-  std::ranges::transform(b_row_indices_d.begin(), b_row_indices_d.end(), B_row_indices_.begin(),
-                         [](double x) { return static_cast<int>(x); });
-  current_ptr = reinterpret_cast<double *>(task_data->inputs[5]);
-  std::vector<double> b_col_ptr_d = std::vector<double>(current_ptr, current_ptr + task_data->inputs_count[8]);
-  B_col_ptr_.resize(b_col_ptr_d.size());
-  std::ranges::transform(b_col_ptr_d.begin(), b_col_ptr_d.end(), B_col_ptr_.begin(),
-                         [](double x) { return static_cast<int>(x); });
+  A_values_ = ReadValues(task_data->inputs[0], task_data->inputs_count[3]);
+  A_row_indices_ = ReadIndices(task_data->inputs[1], task_data->inputs_count[4]);
+  A_col_ptr_ = ReadIndices(task_data->inputs[2], task_data->inputs_count[5]);
+  B_values_ = ReadValues(task_data->inputs[3], task_data->inputs_count[6]);
+  B_row_indices_ = ReadIndices(task_data->inputs[4], task_data->inputs_count[7]);
+  B_col_ptr_ = ReadIndices(task_data->inputs[5], task_data->inputs_count[8]);
   return true;
 }
 
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/sort_benchmark.hpp"
+#include "core/task/include/task.hpp"
+#include "core/util/include/sort_inputs.hpp"
+#include "omp/belov_a_radix_sort_with_batcher_mergesort/include/ops_omp.hpp"
+#include "omp/burykin_m_radix/include/ops_omp.hpp"
+#include "omp/deryabin_m_hoare_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_omp.hpp"
+#include "omp/gusev_n_sorting_int_simple_merging/include/ops_omp.hpp"
+#include "omp/kalyakina_a_Shell_with_simple_merge/include/ops_omp.hpp"
+#include "omp/khovansky_d_double_radix_batcher/include/ops_omp.hpp"
+#include "omp/korovin_n_qsort_batcher/include/ops_omp.hpp"
+#include "omp/koshkin_m_radix_int_simple_merge/include/ops_omp.hpp"
+#include "omp/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
+#include "omp/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherOMP.hpp"
+#include "omp/malyshev_v_radix_sort/include/ops_omp.hpp"
+#include "omp/nikolaev_r_hoare_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/petrov_a_radix_double_batcher/include/ops_omp.hpp"
+#include "omp/shell_sort_gaps/include/ops_omp.hpp"
+#include "omp/smirnov_i_radix_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/solovyev_d_shell_sort_simple/include/ops_omp.hpp"
+#include "omp/sorochkin_d_radix_double_sort_simple_merge/include/ops.hpp"
+#include "omp/sotskov_a_shell_sorting_with_simple_merging/include/ops_omp.hpp"
+#include "omp/tsatsyn_a_radix_sort_simple_merge/include/ops_omp.hpp"
+#include "omp/tyshkevich_a_hoare_simple_merge/include/ops_omp.hpp"
+#include "omp/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_omp.hpp"
+
+namespace {
+
+using ppc::core::MakeSortBenchmarkCase;
+using ppc::core::MakeVectorSortBenchmarkCase;
+using ppc::core::SortBenchmarkCase;
+
+SortBenchmarkCase ShellSortGapsCase(shell_sort_gaps_omp::GapSequence sequence, const std::string &name) {
+  // inputs[1] points to the sequence captured by the factory, which outlives every run
+  return MakeSortBenchmarkCase<int>("shell_sort_gaps_" + name, [sequence](ppc::core::TaskDataPtr task_data) mutable {
+    task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&sequence));
+    task_data->inputs_count.emplace_back(1);
+    return std::make_shared<shell_sort_gaps_omp::ShellSortOpenMP>(task_data);
+  });
+}
+
+}  // namespace
+
+TEST(sort_benchmark_omp, distributions) {
+  using Tyshkevich = tyshkevich_a_hoare_simple_merge_omp::HoareSortTask<double, std::less<>>;
+  std::vector<SortBenchmarkCase> cases = {
+      MakeSortBenchmarkCase<long long>("belov_a_radix_sort_with_batcher_mergesort",
+                                       [](ppc::core::TaskDataPtr task_data) {
+                                         // The array size is passed twice
+                                         task_data->inputs_count.emplace_back(task_data->inputs_count[0]);
+                                         return std::make_shared<
+                                             belov_a_radix_batcher_mergesort_omp::RadixBatcherMergesortParallel>(
+                                             task_data);
+                                       }),
+      MakeSortBenchmarkCase<burykin_m_radix_seq::RadixOMP, int>("burykin_m_radix"),
+      MakeVectorSortBenchmarkCase<double>("deryabin_m_hoare_sort_simple_merge",
+                                          [](ppc::core::TaskDataPtr task_data) {
+                                            // Number of chunks
+                                            task_data->inputs_count.emplace_back(8);
+                                            return std::make_shared<
+                                                deryabin_m_hoare_sort_simple_merge_omp::HoareSortTaskOpenMP>(task_data);
+                                          }),
+      MakeSortBenchmarkCase<fyodorov_m_shell_sort_with_even_odd_batcher_merge_omp::TestTaskOpenmp, int>(
+          "fyodorov_m_shell_sort_with_even_odd_batcher_merge"),
+      MakeSortBenchmarkCase<gusev_n_sorting_int_simple_merging_omp::TestTaskOpenMP, int>(
+          "gusev_n_sorting_int_simple_merging"),
+      MakeSortBenchmarkCase<kalyakina_a_shell_with_simple_merge_omp::ShellSortOpenMP, int>(
+          "kalyakina_a_Shell_with_simple_merge"),
+      MakeSortBenchmarkCase<khovansky_d_double_radix_batcher_omp::RadixOMP, double>("khovansky_d_double_radix_batcher"),
+      MakeSortBenchmarkCase<korovin_n_qsort_batcher_omp::TestTaskOpenMP, int>("korovin_n_qsort_batcher"),
+      MakeSortBenchmarkCase<koshkin_m_radix_int_simple_merge::OmpT, int>("koshkin_m_radix_int_simple_merge"),
+      MakeSortBenchmarkCase<kovalev_k_radix_sort_batcher_merge_omp::TestTaskOpenMP, long long>(
+          "kovalev_k_radix_sort_batcher_merge"),
+      MakeSortBenchmarkCase<kudryashova_i_radix_batcher_omp::TestTaskOpenMP, double>("kudryashova_i_radix_batcher"),
+      MakeSortBenchmarkCase<malyshev_v_radix_sort_omp::RadixSortDoubleOMP, double>("malyshev_v_radix_sort"),
+      MakeSortBenchmarkCase<nikolaev_r_hoare_sort_simple_merge_omp::HoareSortSimpleMergeOpenMP, double>(
+          "nikolaev_r_hoare_sort_simple_merge"),
+      MakeSortBenchmarkCase<petrov_a_radix_double_batcher_omp::TestTaskParallelOmp, double>(
+          "petrov_a_radix_double_batcher"),
+      ShellSortGapsCase(shell_sort_gaps_omp::GapSequence::kCiura, "ciura"),
+      ShellSortGapsCase(shell_sort_gaps_omp::GapSequence::kSedgewick, "sedgewick"),
+      ShellSortGapsCase(shell_sort_gaps_omp::GapSequence::kTokuda, "tokuda"),
+      MakeSortBenchmarkCase<smirnov_i_radix_sort_simple_merge_omp::TestTaskOpenMP, int>(
+          "smirnov_i_radix_sort_simple_merge"),
+      MakeSortBenchmarkCase<solovyev_d_shell_sort_simple_omp::TaskOMP, int>("solovyev_d_shell_sort_simple"),
+      MakeSortBenchmarkCase<sorochkin_d_radix_double_sort_simple_merge_omp::SortTask, double>(
+          "sorochkin_d_radix_double_sort_simple_merge"),
+      MakeSortBenchmarkCase<sotskov_a_shell_sorting_with_simple_merging_omp::TestTaskOpenMP, int>(
+          "sotskov_a_shell_sorting_with_simple_merging"),
+      MakeSortBenchmarkCase<tsatsyn_a_radix_sort_simple_merge_omp::TestTaskOpenMP, double>(
+          "tsatsyn_a_radix_sort_simple_merge"),
+      MakeSortBenchmarkCase<double>("tyshkevich_a_hoare_simple_merge",
+                                    [](ppc::core::TaskDataPtr task_data) {
+                                      return std::make_shared<Tyshkevich>(std::move(task_data), std::less<>());
+                                    }),
+      MakeSortBenchmarkCase<volochaev_s_shell_sort_with_batchers_even_odd_merge_omp::ShellSortOMP, int>(
+          "volochaev_s_Shell_sort_with_Batchers_even-odd_merge"),
+  };
+
+  // Tasks known to crash on or missort some of the inputs; a problem of any other task fails the benchmark
+  const std::set<std::string> expected_failures = {
+      "belov_a_radix_sort_with_batcher_mergesort",
+      "gusev_n_sorting_int_simple_merging",
+      "smirnov_i_radix_sort_simple_merge",
+      "tsatsyn_a_radix_sort_simple_merge",
+  };
+  const std::vector<std::string> problems = ppc::core::RunSortBenchmark("sort_benchmark_omp", cases);
+  for (const auto &problem : problems) {
+    std::cout << "sort_benchmark_omp: problem: " << problem << '\n';
+  }
+  EXPECT_TRUE(ppc::core::UnexpectedSortProblems(problems, expected_failures).empty());
+}
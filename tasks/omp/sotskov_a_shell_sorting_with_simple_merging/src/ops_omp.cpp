@@ -6,27 +6,11 @@
 #include <cstddef>
 #include <vector>
 
-void sotskov_a_shell_sorting_with_simple_merging_omp::ShellSort(std::vector<int>& arr, int left, int right) {
-  int array_size = right - left + 1;
-
-  int gap = 1;
-  while (gap < array_size / 3) {
-    gap = gap * 3 + 1;
-  }
-
-  while (gap > 0) {
-    for (int i = left + gap; i <= right; ++i) {
-      int current_element = arr[i];
-      int j = i;
+#include "core/sort/include/shell_sort.hpp"
 
-      while (j >= left + gap && arr[j - gap] > current_element) {
-        arr[j] = arr[j - gap];
-        j -= gap;
-      }
-      arr[j] = current_element;
-    }
-    gap /= 3;
-  }
+void sotskov_a_shell_sorting_with_simple_merging_omp::ShellSort(std::vector<int>& arr, int left, int right) {
+  const auto array_size = static_cast<std::size_t>(right - left + 1);
+  ppc::sort::ShellSort(arr.data() + left, array_size, ppc::sort::MakeGaps(ppc::sort::GapSequence::kCiura, array_size));
 }
 
 void sotskov_a_shell_sorting_with_simple_merging_omp::ParallelMerge(std::vector<int>& arr, int left, int mid, int right,
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/linalg/include/strassen.hpp"
+#include "core/perf/include/matmul_benchmark.hpp"
+
+namespace {
+
+using ppc::core::MatmulBenchmarkCase;
+using ppc::core::MatmulRun;
+
+constexpr std::size_t kNoSizeLimit = std::numeric_limits<std::size_t>::max();
+constexpr double kFloatTolerance = 1e-5;
+
+MatmulRun GemmRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::GemmWorkspace<double>>();
+  workspace->Reserve(size, size, size);
+  return [size, workspace](const double *a, const double *b, double *c) {
+    ppc::linalg::Gemm(size, size, size, 1.0, a, size, b, size, 0.0, c, size, *workspace, ppc::linalg::OmpFor{});
+  };
+}
+
+// Strassen levels one after another, each addition and leaf product a parallel loop of its own
+MatmulRun DataParallelRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::StrassenWorkspace<double>>();
+  workspace->Reserve(size, size, size);
+  return [size, workspace](const double *a, const double *b, double *c) {
+    ppc::linalg::StrassenWinograd(size, size, size, a, size, b, size, c, size, *workspace,
+                                  ppc::linalg::kStrassenLeafSize, ppc::linalg::OmpFor{});
+  };
+}
+
+// Float inputs; Acc = double is the mixed mode that only rounds the inputs and the result
+template <typename Acc>
+MatmulRun FloatGemmRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::GemmWorkspace<Acc>>();
+  workspace->Reserve(size, size, size);
+  return ppc::core::ConvertingRun<float, Acc>(size, [size, workspace](const float *a, const float *b, Acc *c) {
+    ppc::linalg::Gemm(size, size, size, Acc{1}, a, size, b, size, Acc{0}, c, size, *workspace,
+                      ppc::linalg::OmpFor{});
+  });
+}
+
+MatmulRun FloatDataParallelRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::StrassenWorkspace<float>>();
+  workspace->Reserve(size, size, size);
+  return ppc::core::ConvertingRun<float>(size, [size, workspace](const float *a, const float *b, float *c) {
+    ppc::linalg::StrassenWinograd(size, size, size, a, size, b, size, c, size, *workspace,
+                                  ppc::linalg::kStrassenLeafSize, ppc::linalg::OmpFor{});
+  });
+}
+
+// The nested-sections Strassen of borisov_s_strassen_omp as it was before the task moved to
+// ppc::linalg: the seven products of every level are omp sections over freshly allocated quadrants, and
+// the leaves of n <= 16 a naive loop. It is the baseline that the task DAG is meant to beat.
+std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  std::vector<double> c(n * n, 0.0);
+#pragma omp parallel for
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      double sum = 0.0;
+      for (int k = 0; k < n; ++k) {
+        sum += a[(i * n) + k] * b[(k * n) + j];
+      }
+      c[(i * n) + j] = sum;
+    }
+  }
+  return c;
+}
+
+std::vector<double> AddMatr(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  std::vector<double> c(n * n);
+#pragma omp parallel for
+  for (int i = 0; i < n * n; ++i) {
+    c[i] = a[i] + b[i];
+  }
+  return c;
+}
+
+std::vector<double> SubMatr(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  std::vector<double> c(n * n);
+#pragma omp parallel for
+  for (int i = 0; i < n * n; ++i) {
+    c[i] = a[i] - b[i];
+  }
+  return c;
+}
+
+std::vector<double> SubMatrix(const std::vector<double> &m, int n, int row, int col, int size) {
+  std::vector<double> sub(size * size);
+#pragma omp parallel for
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < size; ++j) {
+      sub[(i * size) + j] = m[((row + i) * n) + (col + j)];
+    }
+  }
+  return sub;
+}
+
+void SetSubMatrix(std::vector<double> &m, const std::vector<double> &sub, int n, int row, int col, int size) {
+#pragma omp parallel for
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < size; ++j) {
+      m[((row + i) * n) + (col + j)] = sub[(i * size) + j];
+    }
+  }
+}
+
+std::vector<double> StrassenRecursive(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  if (n <= 16) {
+    return MultiplyNaive(a, b, n);
+  }
+  int k = n / 2;
+  auto a11 = SubMatrix(a, n, 0, 0, k);
+  auto a12 = SubMatrix(a, n, 0, k, k);
+  auto a21 = SubMatrix(a, n, k, 0, k);
+  auto a22 = SubMatrix(a, n, k, k, k);
+
+  auto b11 = SubMatrix(b, n, 0, 0, k);
+  auto b12 = SubMatrix(b, n, 0, k, k);
+  auto b21 = SubMatrix(b, n, k, 0, k);
+  auto b22 = SubMatrix(b, n, k, k, k);
+
+  std::vector<double> m1;
+  std::vector<double> m2;
+  std::vector<double> m3;
+  std::vector<double> m4;
+  std::vector<double> m5;
+  std::vector<double> m6;
+  std::vector<double> m7;
+
+#pragma omp parallel sections
+  {
+#pragma omp section
+    { m1 = StrassenRecursive(AddMatr(a11, a22, k), AddMatr(b11, b22, k), k); }
+#pragma omp section
+    { m2 = StrassenRecursive(AddMatr(a21, a22, k), b11, k); }
+#pragma omp section
+    { m3 = StrassenRecursive(a11, SubMatr(b12, b22, k), k); }
+#pragma omp section
+    { m4 = StrassenRecursive(a22, SubMatr(b21, b11, k), k); }
+#pragma omp section
+    { m5 = StrassenRecursive(AddMatr(a11, a12, k), b22, k); }
+#pragma omp section
+    { m6 = StrassenRecursive(SubMatr(a21, a11, k), AddMatr(b11, b12, k), k); }
+#pragma omp section
+    { m7 = StrassenRecursive(SubMatr(a12, a22, k), AddMatr(b21, b22, k), k); }
+  }
+
+  std::vector<double> c(n * n, 0.0);
+
+  auto c11 = AddMatr(SubMatr(AddMatr(m1, m4, k), m5, k), m7, k);
+  auto c12 = AddMatr(m3, m5, k);
+  auto c21 = AddMatr(m2, m4, k);
+  auto c22 = AddMatr(AddMatr(SubMatr(m1, m2, k), m3, k), m6, k);
+
+  SetSubMatrix(c, c11, n, 0, 0, k);
+  SetSubMatrix(c, c12, n, 0, k, k);
+  SetSubMatrix(c, c21, n, k, 0, k);
+  SetSubMatrix(c, c22, n, k, k, k);
+
+  return c;
+}
+
+// n is a power of two, so the nested-sections recursion needs no padding
+MatmulRun NestedSectionsRun(std::size_t size) {
+  return [size](const double *a, const double *b, double *c) {
+    const auto n = static_cast<int>(size);
+    const std::vector<double> product =
+        StrassenRecursive(std::vector<double>(a, a + (size * size)), std::vector<double>(b, b + (size * size)), n);
+    std::ranges::copy(product, c);
+  };
+}
+
+MatmulBenchmarkCase TasksCase(std::size_t task_depth, std::size_t max_size) {
+  return {"strassen_tasks_depth" + std::to_string(task_depth),
+          [task_depth](std::size_t size) -> MatmulRun {
+            auto workspace = std::make_shared<ppc::linalg::StrassenWorkspace<double>>();
+            workspace->Reserve(size, size, size, ppc::linalg::kStrassenLeafSize, task_depth);
+            return [size, task_depth, workspace](const double *a, const double *b, double *c) {
+              ppc::linalg::StrassenWinogradTasks(size, size, size, a, size, b, size, c, size, *workspace,
+                                                 ppc::linalg::kStrassenLeafSize, task_depth,
+                                                 ppc::linalg::OmpTaskFor{});
+            };
+          },
+          max_size};
+}
+
+}  // namespace
+
+TEST(strassen_benchmark_omp, task_dag_against_data_parallel) {
+  const std::vector<MatmulBenchmarkCase> cases = {
+      {"gemm", GemmRun},
+      {"strassen_data_parallel", DataParallelRun},
+      // Seven times slower for every doubling of n, about 50 s at 4096
+      {"strassen_nested_sections", NestedSectionsRun, 4096},
+      TasksCase(1, 8192),
+      // About 10 n^2 doubles of scratch at depth 2
+      TasksCase(2, 4096),
+      // Float results are compared with the double gemm, so they get a float tolerance
+      {"gemm_float", FloatGemmRun<float>, kNoSizeLimit, kFloatTolerance},
+      {"gemm_mixed", FloatGemmRun<double>, kNoSizeLimit, kFloatTolerance},
+      {"strassen_float", FloatDataParallelRun, kNoSizeLimit, kFloatTolerance},
+  };
+  const std::vector<std::string> problems = ppc::core::RunMatmulBenchmark("strassen_benchmark_omp", cases);
+  for (const auto &problem : problems) {
+    std::cout << "strassen_benchmark_omp: problem: " << problem << '\n';
+  }
+  EXPECT_TRUE(problems.empty());
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "omp/top_k_select/include/ops_omp.hpp"
+
+namespace {
+
+using top_k_select_omp::SelectMode;
+
+template <typename T>
+std::vector<T> GenerateRandomVector(std::size_t size, T min_value, T max_value) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::vector<T> vec(size);
+  if constexpr (std::is_integral_v<T>) {
+    std::uniform_int_distribution<T> dis(min_value, max_value);
+    std::ranges::generate(vec, [&] { return dis(gen); });
+  } else {
+    std::uniform_real_distribution<T> dis(min_value, max_value);
+    std::ranges::generate(vec, [&] { return dis(gen); });
+  }
+  return vec;
+}
+
+template <typename T>
+std::shared_ptr<ppc::core::TaskData> MakeTaskData(std::vector<T> &input, std::size_t &k, std::vector<T> &output) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&k));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+  return task_data;
+}
+
+template <typename T>
+void CheckTopK(std::vector<T> input, std::size_t k) {
+  std::vector<T> output(k);
+  top_k_select_omp::TopKOpenMP<T> task(MakeTaskData(input, k, output));
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  std::ranges::sort(input);
+  EXPECT_EQ(output, std::vector<T>(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(k)));
+}
+
+template <typename T>
+void CheckNthElement(std::vector<T> input, std::size_t nth) {
+  std::vector<T> output(1);
+  top_k_select_omp::TopKOpenMP<T> task(MakeTaskData(input, nth, output), SelectMode::kNthElement);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+
+  std::ranges::sort(input);
+  EXPECT_EQ(output[0], input[nth]);
+}
+
+}  // namespace
+
+TEST(top_k_select_omp, top_k_zero) { CheckTopK<int>({3, 1, 2}, 0); }
+
+TEST(top_k_select_omp, top_k_all) { CheckTopK<int>({5, -3, 8, 0, -3, 7, 1}, 7); }
+
+TEST(top_k_select_omp, top_k_small_ints) { CheckTopK<int>({9, 4, -7, 4, 12, 0, -1, 4, 3}, 4); }
+
+TEST(top_k_select_omp, top_k_extreme_ints) {
+  CheckTopK<int>({std::numeric_limits<int>::max(), 0, std::numeric_limits<int>::min(), -1, 1}, 3);
+}
+
+TEST(top_k_select_omp, top_k_random_ints) { CheckTopK(GenerateRandomVector<int>(200000, -1000000, 1000000), 100); }
+
+TEST(top_k_select_omp, top_k_many_duplicates) { CheckTopK(GenerateRandomVector<int>(100000, 0, 5), 30000); }
+
+TEST(top_k_select_omp, top_k_all_equal) { CheckTopK(std::vector<int>(50000, 7), 1234); }
+
+TEST(top_k_select_omp, top_k_random_doubles) {
+  CheckTopK(GenerateRandomVector<double>(150000, -1000.0, 1000.0), 777);
+}
+
+TEST(top_k_select_omp, top_k_large_k_floats) { CheckTopK(GenerateRandomVector<float>(50000, -1.0F, 1.0F), 40000); }
+
+TEST(top_k_select_omp, nth_element_min_and_max) {
+  const std::vector<int> input = GenerateRandomVector<int>(10000, -50, 50);
+  CheckNthElement(input, 0);
+  CheckNthElement(input, input.size() - 1);
+}
+
+TEST(top_k_select_omp, nth_element_median_doubles) {
+  const std::vector<double> input = GenerateRandomVector<double>(300001, -1e9, 1e9);
+  CheckNthElement(input, input.size() / 2);
+}
+
+TEST(top_k_select_omp, nth_element_negative_doubles) {
+  CheckNthElement<double>({-0.5, -2.25, 3.0, -1e300, 1e-300, 0.0, -7.5}, 2);
+}
+
+TEST(top_k_select_omp, validation_fails_when_k_exceeds_size) {
+  std::vector<int> input = {1, 2, 3};
+  std::vector<int> output(4);
+  std::size_t k = 4;
+  top_k_select_omp::TopKOpenMP<int> task(MakeTaskData(input, k, output));
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(top_k_select_omp, validation_fails_on_wrong_output_size) {
+  std::vector<int> input = {1, 2, 3};
+  std::vector<int> output(3);
+  std::size_t k = 2;
+  top_k_select_omp::TopKOpenMP<int> task(MakeTaskData(input, k, output));
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(top_k_select_omp, validation_fails_on_nth_out_of_range) {
+  std::vector<int> input = {1, 2, 3};
+  std::vector<int> output(1);
+  std::size_t nth = 3;
+  top_k_select_omp::TopKOpenMP<int> task(MakeTaskData(input, nth, output), SelectMode::kNthElement);
+  EXPECT_FALSE(task.Validation());
+}
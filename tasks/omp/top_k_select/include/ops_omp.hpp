@@ -0,0 +1,229 @@
+#pragma once
+
+#include <omp.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace top_k_select_omp {
+
+// Maps a value to an unsigned key with the same ordering
+template <typename T>
+struct RadixKey;
+
+template <>
+struct RadixKey<int> {
+  using Type = std::uint32_t;
+  static Type Encode(int value) { return std::bit_cast<Type>(value) ^ 0x80000000U; }
+  static int Decode(Type key) { return std::bit_cast<int>(key ^ 0x80000000U); }
+};
+
+template <>
+struct RadixKey<float> {
+  using Type = std::uint32_t;
+  static constexpr Type kSign = 0x80000000U;
+  static Type Encode(float value) {
+    const auto bits = std::bit_cast<Type>(value);
+    return (bits & kSign) != 0 ? ~bits : bits | kSign;
+  }
+  static float Decode(Type key) { return std::bit_cast<float>((key & kSign) != 0 ? key ^ kSign : ~key); }
+};
+
+template <>
+struct RadixKey<double> {
+  using Type = std::uint64_t;
+  static constexpr Type kSign = Type{1} << 63;
+  static Type Encode(double value) {
+    const auto bits = std::bit_cast<Type>(value);
+    return (bits & kSign) != 0 ? ~bits : bits | kSign;
+  }
+  static double Decode(Type key) { return std::bit_cast<double>((key & kSign) != 0 ? key ^ kSign : ~key); }
+};
+
+constexpr int kDigitBits = 8;
+constexpr std::size_t kBuckets = std::size_t{1} << kDigitBits;
+// Candidate sets this small are finished with a serial nth_element
+constexpr std::size_t kSerialSelect = 4096;
+
+// Bounds of the part-th of parts equal slices of [0, size)
+inline std::pair<std::size_t, std::size_t> PartBounds(std::size_t size, std::size_t parts, std::size_t part) {
+  return {size * part / parts, size * (part + 1) / parts};
+}
+
+// Key of the element that would be at position nth if data were sorted.
+// MSD radix select: every pass histograms one digit of the remaining candidates in parallel, picks
+// the bucket holding the wanted rank and keeps only its elements, so each pass touches about
+// 1/256 of the data of the previous one. The input is never modified.
+template <typename T>
+typename RadixKey<T>::Type SelectKey(const T *data, std::size_t size, std::size_t nth) {
+  using Key = typename RadixKey<T>::Type;
+  const auto parts = static_cast<std::size_t>(omp_get_max_threads());
+  std::vector<std::size_t> hist(parts * kBuckets);
+  std::vector<Key> candidates;
+  std::vector<Key> next;
+  bool from_data = true;
+  std::size_t count = size;
+  Key prefix = 0;
+
+  for (int shift = static_cast<int>(sizeof(Key) * 8) - kDigitBits;; shift -= kDigitBits) {
+    if (!from_data && count <= kSerialSelect) {
+      std::nth_element(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(nth), candidates.end());
+      return candidates[nth];
+    }
+    auto key_at = [&](std::size_t i) { return from_data ? RadixKey<T>::Encode(data[i]) : candidates[i]; };
+
+    std::ranges::fill(hist, 0);
+#pragma omp parallel for schedule(static, 1)
+    for (std::int64_t p = 0; p < static_cast<std::int64_t>(parts); ++p) {
+      std::size_t *local = hist.data() + (static_cast<std::size_t>(p) * kBuckets);
+      const auto [begin, end] = PartBounds(count, parts, static_cast<std::size_t>(p));
+      for (std::size_t i = begin; i < end; ++i) {
+        ++local[(key_at(i) >> shift) & (kBuckets - 1)];
+      }
+    }
+
+    std::size_t bucket = 0;
+    std::size_t in_bucket = 0;
+    for (;; ++bucket) {
+      in_bucket = 0;
+      for (std::size_t p = 0; p < parts; ++p) {
+        in_bucket += hist[(p * kBuckets) + bucket];
+      }
+      if (nth < in_bucket) {
+        break;
+      }
+      nth -= in_bucket;
+    }
+    prefix |= static_cast<Key>(bucket) << shift;
+    if (shift == 0) {
+      return prefix;
+    }
+    if (in_bucket == count) {
+      continue;
+    }
+
+    // Stable compaction of the chosen bucket: part p writes after the bucket elements of parts < p
+    std::vector<std::size_t> offsets(parts + 1);
+    for (std::size_t p = 0; p < parts; ++p) {
+      offsets[p + 1] = offsets[p] + hist[(p * kBuckets) + bucket];
+    }
+    next.resize(in_bucket);
+#pragma omp parallel for schedule(static, 1)
+    for (std::int64_t p = 0; p < static_cast<std::int64_t>(parts); ++p) {
+      const auto [begin, end] = PartBounds(count, parts, static_cast<std::size_t>(p));
+      std::size_t out = offsets[p];
+      for (std::size_t i = begin; i < end; ++i) {
+        const Key key = key_at(i);
+        if (((key >> shift) & (kBuckets - 1)) == bucket) {
+          next[out++] = key;
+        }
+      }
+    }
+    candidates.swap(next);
+    from_data = false;
+    count = in_bucket;
+  }
+}
+
+// Value of the element that would be at position nth (0-based) if data were sorted
+template <typename T>
+T NthElement(const T *data, std::size_t size, std::size_t nth) {
+  return RadixKey<T>::Decode(SelectKey(data, size, nth));
+}
+
+// Writes the k smallest elements of data to out in ascending order
+template <typename T>
+void TopK(const T *data, std::size_t size, std::size_t k, T *out) {
+  if (k == 0) {
+    return;
+  }
+  using Key = typename RadixKey<T>::Type;
+  const Key threshold = SelectKey(data, size, k - 1);
+
+  // Everything strictly below the k-th key belongs to the answer; the rest is copies of it
+  const auto parts = static_cast<std::size_t>(omp_get_max_threads());
+  std::vector<std::size_t> offsets(parts + 1);
+#pragma omp parallel for schedule(static, 1)
+  for (std::int64_t p = 0; p < static_cast<std::int64_t>(parts); ++p) {
+    const auto [begin, end] = PartBounds(size, parts, static_cast<std::size_t>(p));
+    offsets[p + 1] = static_cast<std::size_t>(std::count_if(
+        data + begin, data + end, [threshold](const T &value) { return RadixKey<T>::Encode(value) < threshold; }));
+  }
+  for (std::size_t p = 0; p < parts; ++p) {
+    offsets[p + 1] += offsets[p];
+  }
+#pragma omp parallel for schedule(static, 1)
+  for (std::int64_t p = 0; p < static_cast<std::int64_t>(parts); ++p) {
+    const auto [begin, end] = PartBounds(size, parts, static_cast<std::size_t>(p));
+    std::copy_if(data + begin, data + end, out + offsets[p],
+                 [threshold](const T &value) { return RadixKey<T>::Encode(value) < threshold; });
+  }
+  const std::size_t less = offsets[parts];
+  std::fill(out + less, out + k, RadixKey<T>::Decode(threshold));
+  std::sort(out, out + less);
+}
+
+enum class SelectMode : std::uint8_t {
+  // outputs[0] receives the k smallest elements in ascending order (outputs_count[0] == k)
+  kTopK,
+  // outputs[0] receives the element at sorted position k (outputs_count[0] == 1)
+  kNthElement,
+};
+
+// inputs[0]  - array of T, inputs_count[0] - its size
+// inputs[1]  - std::size_t k (inputs_count[1] == 1)
+// outputs[0] - see SelectMode
+template <typename T>
+class TopKOpenMP : public ppc::core::Task {
+ public:
+  explicit TopKOpenMP(ppc::core::TaskDataPtr task_data, SelectMode mode = SelectMode::kTopK)
+      : Task(std::move(task_data)), mode_(mode) {}
+
+  bool PreProcessingImpl() override {
+    auto *in_ptr = reinterpret_cast<T *>(task_data->inputs[0]);
+    input_ = std::vector<T>(in_ptr, in_ptr + task_data->inputs_count[0]);
+    k_ = *reinterpret_cast<std::size_t *>(task_data->inputs[1]);
+    output_.resize(mode_ == SelectMode::kTopK ? k_ : 1);
+    return true;
+  }
+
+  bool ValidationImpl() override {
+    if (task_data->inputs.size() != 2 || task_data->inputs_count.size() != 2 || task_data->inputs_count[1] != 1 ||
+        task_data->inputs[1] == nullptr || task_data->outputs_count.empty()) {
+      return false;
+    }
+    const std::size_t k = *reinterpret_cast<std::size_t *>(task_data->inputs[1]);
+    if (mode_ == SelectMode::kTopK) {
+      return k <= task_data->inputs_count[0] && task_data->outputs_count[0] == k;
+    }
+    return k < task_data->inputs_count[0] && task_data->outputs_count[0] == 1;
+  }
+
+  bool RunImpl() override {
+    if (mode_ == SelectMode::kTopK) {
+      TopK(input_.data(), input_.size(), k_, output_.data());
+    } else {
+      output_[0] = NthElement(input_.data(), input_.size(), k_);
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    std::ranges::copy(output_, reinterpret_cast<T *>(task_data->outputs[0]));
+    return true;
+  }
+
+ private:
+  SelectMode mode_;
+  std::vector<T> input_;
+  std::vector<T> output_;
+  std::size_t k_{};
+};
+
+}  // namespace top_k_select_omp
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/top_k_select/include/ops_omp.hpp"
+
+namespace {
+
+constexpr std::size_t kCount = 50000000;
+constexpr std::size_t kTopK = 1000;
+
+std::vector<int> GenerateRandomVector(std::size_t size) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<int> dis;
+  std::vector<int> vec(size);
+  for (auto &elem : vec) {
+    elem = dis(gen);
+  }
+  return vec;
+}
+
+std::shared_ptr<ppc::core::PerfResults> RunPerf(std::vector<int> &input, std::size_t &k, std::vector<int> &output,
+                                                top_k_select_omp::SelectMode mode, bool pipeline) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  task_data->inputs_count.emplace_back(input.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&k));
+  task_data->inputs_count.emplace_back(1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(output.data()));
+  task_data->outputs_count.emplace_back(output.size());
+
+  auto task = std::make_shared<top_k_select_omp::TopKOpenMP<int>>(task_data, mode);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  if (pipeline) {
+    perf_analyzer->PipelineRun(perf_attr, perf_results);
+  } else {
+    perf_analyzer->TaskRun(perf_attr, perf_results);
+  }
+  return perf_results;
+}
+
+}  // namespace
+
+TEST(top_k_select_omp, test_pipeline_run) {
+  std::vector<int> in = GenerateRandomVector(kCount);
+  std::vector<int> out(kTopK);
+  std::size_t k = kTopK;
+
+  ppc::core::Perf::PrintPerfStatistic(RunPerf(in, k, out, top_k_select_omp::SelectMode::kTopK, true));
+  std::ranges::partial_sort(in, in.begin() + kTopK);
+  EXPECT_EQ(out, std::vector<int>(in.begin(), in.begin() + kTopK));
+}
+
+TEST(top_k_select_omp, test_task_run) {
+  std::vector<int> in = GenerateRandomVector(kCount);
+  std::vector<int> out(kTopK);
+  std::size_t k = kTopK;
+
+  ppc::core::Perf::PrintPerfStatistic(RunPerf(in, k, out, top_k_select_omp::SelectMode::kTopK, false));
+  std::ranges::partial_sort(in, in.begin() + kTopK);
+  EXPECT_EQ(out, std::vector<int>(in.begin(), in.begin() + kTopK));
+}
+
+// Top-k and median selection against a full sort of the same data
+TEST(top_k_select_omp, benchmark_against_full_sort) {
+  std::vector<int> in = GenerateRandomVector(kCount / 5);
+  std::vector<int> sorted = in;
+  const auto start = std::chrono::high_resolution_clock::now();
+  std::ranges::sort(sorted);
+  const std::chrono::duration<double> sort_time = std::chrono::high_resolution_clock::now() - start;
+  std::cout << "top_k_select_omp benchmark: full sort n=" << in.size() << " time=" << sort_time.count() << '\n';
+
+  for (std::size_t k : {std::size_t{10}, std::size_t{10000}, in.size() / 10}) {
+    std::vector<int> out(k);
+    const auto perf_results = RunPerf(in, k, out, top_k_select_omp::SelectMode::kTopK, false);
+    std::cout << "top_k_select_omp benchmark: top-k n=" << in.size() << " k=" << k
+              << " time=" << perf_results->time_sec << '\n';
+    EXPECT_EQ(out, std::vector<int>(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(k)));
+  }
+
+  std::size_t nth = in.size() / 2;
+  std::vector<int> median(1);
+  const auto perf_results = RunPerf(in, nth, median, top_k_select_omp::SelectMode::kNthElement, false);
+  std::cout << "top_k_select_omp benchmark: median n=" << in.size() << " time=" << perf_results->time_sec << '\n';
+  EXPECT_EQ(median[0], sorted[nth]);
+}
@@ -6,6 +6,7 @@
 #include <functional>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -105,3 +106,17 @@ TEST(tyshkevich_a_hoare_simple_merge_omp, test_1025_lt) { TestSort<int>(1025, st
 
 TEST(tyshkevich_a_hoare_simple_merge_omp, test_homogeneous_gt) { TestSort<int>({1, 1, 1}, std::greater<>()); }
 TEST(tyshkevich_a_hoare_simple_merge_omp, test_homogeneous_lt) { TestSort<int>({1, 1, 1}, std::less<>()); }
+
+TEST(tyshkevich_a_hoare_simple_merge_omp, test_100000_gt) { TestSort<int>(100000, std::greater<>()); }
+TEST(tyshkevich_a_hoare_simple_merge_omp, test_100000_lt) { TestSort<int>(100000, std::less<>()); }
+
+TEST(tyshkevich_a_hoare_simple_merge_omp, test_homogeneous_large) {
+  TestSort<int>(std::vector<int>(100000, 7), std::less<>());
+}
+TEST(tyshkevich_a_hoare_simple_merge_omp, test_two_values_large) {
+  std::vector<int> in(100000);
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    in[i] = static_cast<int>(i % 2);
+  }
+  TestSort<int>(std::move(in), std::less<>());
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "seq/dense_gemm/include/ops_seq.hpp"
+
+namespace {
+
+constexpr std::size_t kSize = 512;
+// The batched runs multiply kBatch pairs of kSmallSize x kSmallSize matrices in one task, where a task
+// per product would spend far more time on its pipeline than on the arithmetic
+constexpr std::size_t kSmallSize = 8;
+constexpr std::size_t kBatch = 1 << 16;
+
+std::vector<double> GenerateMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+ppc::core::TaskDataPtr MakeTaskData(std::vector<double> &a, std::vector<double> &b, std::vector<double> &c) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data->inputs_count = {kSize, kSize, kSize};
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data->outputs_count.emplace_back(c.size());
+  return task_data;
+}
+
+ppc::core::TaskDataPtr MakeBatchTaskData(std::vector<double> &a, std::vector<double> &b, std::vector<double> &c) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data->inputs_count = {kSmallSize, kSmallSize, kSmallSize, kBatch};
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data->outputs_count.emplace_back(c.size());
+  return task_data;
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+// Checks one element of every row against a direct dot product
+void CheckSampledElements(const std::vector<double> &a, const std::vector<double> &b, const std::vector<double> &c) {
+  for (std::size_t i = 0; i < kSize; ++i) {
+    const std::size_t j = (i * 7) % kSize;
+    double expected = 0.0;
+    for (std::size_t p = 0; p < kSize; ++p) {
+      expected += a[(i * kSize) + p] * b[(p * kSize) + j];
+    }
+    ASSERT_NEAR(c[(i * kSize) + j], expected, 1e-8);
+  }
+}
+
+// Checks one element of every 1000th product of the batch against a direct dot product
+void CheckSampledProducts(const std::vector<double> &a, const std::vector<double> &b, const std::vector<double> &c) {
+  constexpr std::size_t kElements = kSmallSize * kSmallSize;
+  for (std::size_t product = 0; product < kBatch; product += 1000) {
+    const std::size_t i = product % kSmallSize;
+    const std::size_t j = (product / kSmallSize) % kSmallSize;
+    double expected = 0.0;
+    for (std::size_t p = 0; p < kSmallSize; ++p) {
+      expected += a[(product * kElements) + (i * kSmallSize) + p] * b[(product * kElements) + (p * kSmallSize) + j];
+    }
+    ASSERT_NEAR(c[(product * kElements) + (i * kSmallSize) + j], expected, 1e-10);
+  }
+}
+
+}  // namespace
+
+TEST(dense_gemm_seq, test_pipeline_run) {
+  auto a = GenerateMatrix(kSize, kSize, 1);
+  auto b = GenerateMatrix(kSize, kSize, 2);
+  std::vector<double> c(kSize * kSize);
+  auto task = std::make_shared<dense_gemm_seq::GemmSequential<>>(MakeTaskData(a, b, c));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  CheckSampledElements(a, b, c);
+}
+
+TEST(dense_gemm_seq, test_task_run) {
+  auto a = GenerateMatrix(kSize, kSize, 1);
+  auto b = GenerateMatrix(kSize, kSize, 2);
+  std::vector<double> c(kSize * kSize);
+  auto task = std::make_shared<dense_gemm_seq::GemmSequential<>>(MakeTaskData(a, b, c));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  CheckSampledElements(a, b, c);
+}
+
+TEST(dense_gemm_seq, test_batched_pipeline_run) {
+  auto a = GenerateMatrix(kBatch * kSmallSize, kSmallSize, 1);
+  auto b = GenerateMatrix(kBatch * kSmallSize, kSmallSize, 2);
+  std::vector<double> c(kBatch * kSmallSize * kSmallSize);
+  auto task = std::make_shared<dense_gemm_seq::GemmSequential<>>(MakeBatchTaskData(a, b, c));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  CheckSampledProducts(a, b, c);
+}
+
+TEST(dense_gemm_seq, test_batched_task_run) {
+  auto a = GenerateMatrix(kBatch * kSmallSize, kSmallSize, 1);
+  auto b = GenerateMatrix(kBatch * kSmallSize, kSmallSize, 2);
+  std::vector<double> c(kBatch * kSmallSize * kSmallSize);
+  auto task = std::make_shared<dense_gemm_seq::GemmSequential<>>(MakeBatchTaskData(a, b, c));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(task);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  CheckSampledProducts(a, b, c);
+}
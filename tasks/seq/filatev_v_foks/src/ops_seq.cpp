@@ -19,7 +19,7 @@ bool filatev_v_foks_seq::Focks::PreProcessingImpl() {
   size_ = std::max(size_, size_b_.n);
   size_ = std::max(size_, size_b_.m);
 
-  size_ = (size_ % size_block_ == 0) ? size_ : ((size_ % size_block_) + 1) * size_block_;
+  size_ = (size_ % size_block_ == 0) ? size_ : ((size_ / size_block_) + 1) * size_block_;
 
   matrix_a_.assign(size_ * size_, 0);
   matrix_b_.assign(size_ * size_, 0);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -8,7 +9,6 @@
 namespace kalyakina_a_shell_with_simple_merge_seq {
 
 class ShellSortSequential : public ppc::core::Task {
-  static std::vector<unsigned int> CalculationOfGapLengths(const unsigned int& size);
   void ShellSort(std::vector<int>& vec);
 
  public:
@@ -21,7 +21,7 @@ class ShellSortSequential : public ppc::core::Task {
 
  private:
   std::vector<int> input_;
-  std::vector<unsigned int> Sedgwick_sequence_;
+  std::vector<std::size_t> Sedgwick_sequence_;
 };
 
 }  // namespace kalyakina_a_shell_with_simple_merge_seq
\ No newline at end of file
@@ -1,9 +1,11 @@
 #include "seq/kondratev_ya_ccs_complex_multiplication/include/ops_seq.hpp"
 
-#include <algorithm>
 #include <cmath>
 #include <complex>
-#include <vector>
+#include <cstddef>
+#include <utility>
+
+#include "core/sparse/include/spgemm.hpp"
 
 bool kondratev_ya_ccs_complex_multiplication_seq::IsZero(const std::complex<double> &value) {
   return std::norm(value) < kEpsilonForZero;
@@ -44,37 +46,23 @@ bool kondratev_ya_ccs_complex_multiplication_seq::TestTaskSequential::PostProces
   return true;
 }
 
+ppc::sparse::CcsView<std::complex<double>> kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix::View() const {
+  return {.rows = static_cast<std::size_t>(rows),
+          .cols = static_cast<std::size_t>(cols),
+          .col_ptr = col_ptrs.data(),
+          .row_index = row_index.data(),
+          .values = values.data()};
+}
+
 kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix
 kondratev_ya_ccs_complex_multiplication_seq::CCSMatrix::operator*(const CCSMatrix &other) const {
-  CCSMatrix result({rows, other.cols});
-  result.values.reserve(std::min(rows * other.cols, static_cast<int>(values.size() * other.values.size())));
-  result.row_index.reserve(result.values.capacity());
-
-  std::vector<std::complex<double>> temp_col(rows, std::complex<double>(0.0, 0.0));
-
-  for (int result_col = 0; result_col < other.cols; result_col++) {
-    for (int k = other.col_ptrs[result_col]; k < other.col_ptrs[result_col + 1]; k++) {
-      int row_other = other.row_index[k];
-      std::complex<double> val_other = other.values[k];
-
-      for (int i = col_ptrs[row_other]; i < col_ptrs[row_other + 1]; i++) {
-        int row_this = row_index[i];
-        temp_col[row_this] += values[i] * val_other;
-      }
-    }
-
-    result.col_ptrs[result_col] = static_cast<int>(result.values.size());
-    for (int i = 0; i < rows; i++) {
-      if (!IsZero(temp_col[i])) {
-        result.values.emplace_back(temp_col[i]);
-        result.row_index.emplace_back(i);
-
-        temp_col[i] = std::complex<double>(0.0, 0.0);
-      }
-    }
-  }
-
-  result.col_ptrs[other.cols] = static_cast<int>(result.values.size());
+  ppc::sparse::CcsMatrix<std::complex<double>> product;
+  ppc::sparse::SpGemm(View(), other.View(), product);
+  ppc::sparse::Prune(product, [](const std::complex<double> &value) { return !IsZero(value); });
 
+  CCSMatrix result({rows, other.cols});
+  result.values = std::move(product.values);
+  result.row_index = std::move(product.row_index);
+  result.col_ptrs = std::move(product.col_ptr);
   return result;
-}
\ No newline at end of file
+}
@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
+#include <iostream>
 #include <memory>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/konkov_i_sparse_matmul_ccs/include/ops_seq.hpp"
 
@@ -116,4 +121,43 @@ TEST(konkov_i_SparseMatmulPerfTest_seq, test_task_run) {
     ASSERT_NEAR(val, expected_value, 1e-9);
   }
   ASSERT_EQ(task->C_col_ptr.back(), kSize);
-}
\ No newline at end of file
+}
+
+// The benchmark matrix: every structure of ppc::sparse::SparseBenchmarkSuite through the task, timing
+// PreProcessing and Run together
+TEST(konkov_i_SparseMatmulPerfTest_seq, structured_matrices) {
+  for (const auto& c : ppc::sparse::SparseBenchmarkSuite(1 << 15, 16)) {
+    ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+    konkov_i_sparse_matmul_ccs::SparseMatmulTask task(task_data);
+    task.A_values = c.a.values;
+    task.A_row_indices = c.a.row_index;
+    task.A_col_ptr = c.a.col_ptr;
+    task.B_values = c.b.values;
+    task.B_row_indices = c.b.row_index;
+    task.B_col_ptr = c.b.col_ptr;
+    task.rowsA = static_cast<int>(c.a.rows);
+    task.colsA = static_cast<int>(c.a.cols);
+    task.rowsB = static_cast<int>(c.b.rows);
+    task.colsB = static_cast<int>(c.b.cols);
+    ASSERT_TRUE(task.ValidationImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    // The task leaves the entries that sum to zero out of C
+    ppc::sparse::CcsMatrix<double> expected;
+    ppc::sparse::SpGemm(c.a.View(), c.b.View(), expected);
+    ppc::sparse::Prune(expected, [](double value) { return value != 0.0; });
+    ASSERT_EQ(task.C_col_ptr, expected.col_ptr) << c.name;
+    ASSERT_EQ(task.C_row_indices, expected.row_index) << c.name;
+    for (std::size_t p = 0; p < expected.values.size(); ++p) {
+      ASSERT_NEAR(task.C_values[p], expected.values[p], 1e-9) << c.name << " " << p;
+    }
+    std::cout << ppc::sparse::FormatSparseRate("konkov_i_sparse_matmul_ccs_seq", c.name,
+                                               ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View()),
+                                               c.a.values.size() + c.b.values.size() + task.C_values.size(),
+                                               elapsed.count())
+              << '\n';
+  }
+}
@@ -1,22 +1,35 @@
 #include "seq/konkov_i_sparse_matmul_ccs/include/ops_seq.hpp"
 
-#include <algorithm>
 #include <cstddef>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konkov_i_sparse_matmul_ccs {
 
+namespace {
+
+ppc::sparse::CcsView<double> MakeView(int rows, int cols, const std::vector<int>& col_ptr,
+                                      const std::vector<int>& row_indices, const std::vector<double>& values) {
+  return {.rows = static_cast<std::size_t>(rows),
+          .cols = static_cast<std::size_t>(cols),
+          .col_ptr = col_ptr.data(),
+          .row_index = row_indices.data(),
+          .values = values.data()};
+}
+
+}  // namespace
+
 SparseMatmulTask::SparseMatmulTask(ppc::core::TaskDataPtr task_data) : ppc::core::Task(std::move(task_data)) {}
 
 bool SparseMatmulTask::ValidationImpl() {
   if (colsA != rowsB || rowsA <= 0 || colsB <= 0) {
     return false;
   }
-  if (A_col_ptr.empty() || B_col_ptr.empty()) {
+  if (A_col_ptr.size() != static_cast<std::size_t>(colsA) + 1 ||
+      B_col_ptr.size() != static_cast<std::size_t>(colsB) + 1) {
     return false;
   }
   return true;
@@ -30,48 +43,14 @@ bool SparseMatmulTask::PreProcessingImpl() {
 }
 
 bool SparseMatmulTask::RunImpl() {
-  std::vector<std::unordered_map<int, double>> column_map(colsB);
-
-  for (int col_b = 0; col_b < colsB; ++col_b) {
-    for (int j = B_col_ptr[col_b]; j < B_col_ptr[col_b + 1]; ++j) {
-      int row_b = B_row_indices[j];
-      double val_b = B_values[j];
-
-      if (row_b >= colsA) {
-        continue;
-      }
-
-      for (int k = A_col_ptr[row_b]; k < A_col_ptr[row_b + 1]; ++k) {
-        if (static_cast<size_t>(k) >= A_row_indices.size()) {
-          continue;
-        }
-
-        int row_a = A_row_indices[k];
-        double val_a = A_values[k];
-        column_map[col_b][row_a] += val_a * val_b;
-      }
-    }
-  }
-
-  C_col_ptr.resize(colsB + 1, 0);
-  int count = 0;
-  for (int col = 0; col < colsB; ++col) {
-    std::vector<int> rows;
-    for (const auto& pair : column_map[col]) {
-      if (pair.second != 0) {
-        rows.push_back(pair.first);
-      }
-    }
-    std::ranges::sort(rows);
-
-    for (int row : rows) {
-      C_values.push_back(column_map[col][row]);
-      C_row_indices.push_back(row);
-      count++;
-    }
-    C_col_ptr[col + 1] = count;
-  }
-
+  ppc::sparse::CcsMatrix<double> c;
+  ppc::sparse::SpGemm(MakeView(rowsA, colsA, A_col_ptr, A_row_indices, A_values),
+                      MakeView(rowsB, colsB, B_col_ptr, B_row_indices, B_values), c);
+  // Products that cancel out exactly are not stored
+  ppc::sparse::Prune(c, [](double value) { return value != 0.0; });
+  C_values = std::move(c.values);
+  C_row_indices = std::move(c.row_index);
+  C_col_ptr = std::move(c.col_ptr);
   return true;
 }
 
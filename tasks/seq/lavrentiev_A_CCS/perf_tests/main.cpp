@@ -5,12 +5,16 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <random>
 #include <utility>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/lavrentiev_A_CCS/include/ops_seq.hpp"
 
@@ -107,3 +111,54 @@ TEST(lavrentiev_a_ccs_seq, test_task_run) {
     EXPECT_NEAR(task.result[i], task.random_data[i], kEpsilon);
   }
 }
+
+// The benchmark matrix: every structure of ppc::sparse::SparseBenchmarkSuite through the task, timing
+// PreProcessing and Run together. The task takes dense row-major matrices and compares every row of A with
+// every column of B, so the matrices are kept small.
+TEST(lavrentiev_a_ccs_seq, structured_matrices) {
+  auto to_dense = [](const ppc::sparse::CcsMatrix<double> &m) {
+    std::vector<double> dense(m.rows * m.cols);
+    for (std::size_t j = 0; j < m.cols; ++j) {
+      for (auto p = static_cast<std::size_t>(m.col_ptr[j]); p < static_cast<std::size_t>(m.col_ptr[j + 1]); ++p) {
+        dense[(static_cast<std::size_t>(m.row_index[p]) * m.cols) + j] = m.values[p];
+      }
+    }
+    return dense;
+  };
+  for (const auto &c : ppc::sparse::SparseBenchmarkSuite(512, 8)) {
+    ppc::sparse::CcsMatrix<double> expected;
+    ppc::sparse::SpGemm(c.a.View(), c.b.View(), expected);
+    std::vector<double> a = to_dense(c.a);
+    std::vector<double> b = to_dense(c.b);
+    std::vector<double> result(c.a.rows * c.b.cols);
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+    task_data_seq->inputs_count.emplace_back(c.a.rows);
+    task_data_seq->inputs_count.emplace_back(c.a.cols);
+    task_data_seq->inputs_count.emplace_back(c.b.rows);
+    task_data_seq->inputs_count.emplace_back(c.b.cols);
+    task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(result.data()));
+    task_data_seq->outputs_count.emplace_back(result.size());
+
+    lavrentiev_a_ccs_seq::CCSSequential task(task_data_seq);
+    ASSERT_TRUE(task.ValidationImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    const std::vector<double> expected_dense = to_dense(expected);
+    for (std::size_t i = 0; i < result.size(); ++i) {
+      ASSERT_NEAR(result[i], expected_dense[i], kEpsilon) << c.name << " " << i;
+    }
+    std::size_t result_nnz = 0;
+    for (const double x : result) {
+      result_nnz += x != 0.0 ? 1 : 0;
+    }
+    std::cout << ppc::sparse::FormatSparseRate("lavrentiev_a_ccs_seq", c.name,
+                                               ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View()),
+                                               c.a.values.size() + c.b.values.size() + result_nnz, elapsed.count())
+              << '\n';
+  }
+}
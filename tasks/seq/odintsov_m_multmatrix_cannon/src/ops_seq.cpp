@@ -3,6 +3,9 @@
 #include <cmath>
 #include <cstddef>
 #include <vector>
+
+#include "core/linalg/include/blocking.hpp"
+
 using namespace std;
 void odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::ShiftRow(std::vector<double>& matrix, int root,
                                                                           int row, int shift) {
@@ -93,12 +96,8 @@ bool odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::IsSquere(unsign
 }
 
 int odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::GetBlockSize(int n) {
-  for (int k = (n / 2); k >= 2; k--) {
-    if ((n % k) == 0) {
-      return k;
-    }
-  }
-  return 1;
+  // Сдвиги переставляют блоки целиком, поэтому размер блока должен делить n
+  return static_cast<int>(ppc::linalg::ChooseDividingBlockSize(n, sizeof(double)));
 }
 void odintsov_m_mulmatrix_cannon_seq::MulMatrixCannonSequential::CopyBlock(const std::vector<double>& matrix,
                                                                            std::vector<double>& block, int start,
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/transpose.hpp"
 #include "utility"
 
 namespace sarafanov_m_canon_mat_mul_seq {
@@ -86,15 +87,7 @@ CanonMatrix CanonMatrix::operator+(const CanonMatrix& canon_matrix) {
   return {c_matrix};
 }
 
-void CanonMatrix::Transpose() {
-  std::vector<double> new_matrix(size_ * size_);
-  for (size_t i = 0; i < size_; ++i) {
-    for (size_t j = 0; j < size_; ++j) {
-      new_matrix[(i * size_) + j] = matrix_[(j * size_) + i];
-    }
-  }
-  matrix_ = std::move(new_matrix);
-}
+void CanonMatrix::Transpose() { ppc::linalg::TransposeInPlace(size_, matrix_.data(), size_); }
 
 void CanonMatrix::ClearMatrix() {
   matrix_.clear();
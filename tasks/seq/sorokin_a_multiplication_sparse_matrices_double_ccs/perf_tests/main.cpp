@@ -3,10 +3,14 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/sorokin_a_multiplication_sparse_matrices_double_ccs/include/ops_seq.hpp"
 
@@ -159,3 +163,52 @@ TEST(sorokin_a_multiplication_sparse_matrices_double_ccs_seq, test_task_run) {
   perf_analyzer->TaskRun(perf_attr, perf_results);
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 }
+
+// The benchmark matrix: every structure of ppc::sparse::SparseBenchmarkSuite through the task, timing
+// PreProcessing and Run together. The outputs are sized by the product of ppc::sparse::SpGemm, which C is
+// checked against.
+TEST(sorokin_a_multiplication_sparse_matrices_double_ccs_seq, structured_matrices) {
+  auto as_doubles = [](const std::vector<int> &indices) { return std::vector<double>(indices.begin(), indices.end()); };
+  for (const auto &c : ppc::sparse::SparseBenchmarkSuite(1 << 15, 16)) {
+    ppc::sparse::CcsMatrix<double> expected;
+    ppc::sparse::SpGemm(c.a.View(), c.b.View(), expected);
+
+    std::vector<double> a_values = c.a.values;
+    std::vector<double> a_row_indices = as_doubles(c.a.row_index);
+    std::vector<double> a_col_ptr = as_doubles(c.a.col_ptr);
+    std::vector<double> b_values = c.b.values;
+    std::vector<double> b_row_indices = as_doubles(c.b.row_index);
+    std::vector<double> b_col_ptr = as_doubles(c.b.col_ptr);
+    std::vector<double> c_values(expected.values.size());
+    std::vector<double> c_row_indices(expected.row_index.size());
+    std::vector<double> c_col_ptr(expected.col_ptr.size());
+
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs_count.emplace_back(c.a.rows);
+    task_data_seq->inputs_count.emplace_back(c.a.cols);
+    task_data_seq->inputs_count.emplace_back(c.b.cols);
+    for (auto *input : {&a_values, &a_row_indices, &a_col_ptr, &b_values, &b_row_indices, &b_col_ptr}) {
+      task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(input->data()));
+      task_data_seq->inputs_count.emplace_back(input->size());
+    }
+    for (auto *output : {&c_values, &c_row_indices, &c_col_ptr}) {
+      task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(output->data()));
+      task_data_seq->outputs_count.emplace_back(output->size());
+    }
+
+    sorokin_a_multiplication_sparse_matrices_double_ccs_seq::TestTaskSequential task(task_data_seq);
+    ASSERT_TRUE(task.ValidationImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    ASSERT_EQ(c_values, expected.values) << c.name;
+    ASSERT_EQ(c_col_ptr, as_doubles(expected.col_ptr)) << c.name;
+    std::cout << ppc::sparse::FormatSparseRate("sorokin_a_multiplication_sparse_matrices_double_ccs_seq", c.name,
+                                               ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View()),
+                                               c.a.values.size() + c.b.values.size() + c_values.size(),
+                                               elapsed.count())
+              << '\n';
+  }
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/sort_benchmark.hpp"
+#include "core/task/include/task.hpp"
+#include "seq/belov_a_radix_sort_with_batcher_mergesort/include/ops_seq.hpp"
+#include "seq/bessonov_e_radix_sort_simple_merging/include/ops_seq.hpp"
+#include "seq/burykin_m_radix/include/ops_seq.hpp"
+#include "seq/ermilova_d_shell_sort_batcher_even_odd_merger/include/ops_seq.hpp"
+#include "seq/fyodorov_m_shell_sort_with_even_odd_batcher_merge/include/ops_seq.hpp"
+#include "seq/gusev_n_sorting_int_simple_merging/include/ops_seq.hpp"
+#include "seq/kalyakina_a_Shell_with_simple_merge/include/ops_seq.hpp"
+#include "seq/khovansky_d_double_radix_batcher/include/ops_seq.hpp"
+#include "seq/korovin_n_qsort_batcher/include/ops_seq.hpp"
+#include "seq/koshkin_m_radix_int_simple_merge/include/ops_seq.hpp"
+#include "seq/koshkin_n_shell_sort_batchers_even_odd_merge/include/ops_seq.hpp"
+#include "seq/kovalchuk_a_shell_sort/include/ops_seq.hpp"
+#include "seq/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
+#include "seq/kudryashova_i_radix_batcher/include/kudryashovaRadixBatcherSeq.hpp"
+#include "seq/malyshev_v_radix_sort/include/ops_seq.hpp"
+#include "seq/nikolaev_r_hoare_sort_simple_merge/include/ops_seq.hpp"
+#include "seq/opolin_d_radix_sort_betcher_merge/include/ops_seq.hpp"
+#include "seq/petrov_a_radix_double_batcher/include/ops_seq.hpp"
+#include "seq/shlyakov_m_shell_sort/include/ops_seq.hpp"
+#include "seq/shuravina_o_hoare_simple_merger/include/ops_seq.hpp"
+#include "seq/smirnov_i_radix_sort_simple_merge/include/ops_seq.hpp"
+#include "seq/solovyev_d_shell_sort_simple/include/ops_seq.hpp"
+#include "seq/sorochkin_d_radix_double_sort_simple_merge/include/ops.hpp"
+#include "seq/sotskov_a_shell_sorting_with_simple_merging/include/ops_seq.hpp"
+#include "seq/tsatsyn_a_radix_sort_simple_merge/include/ops_seq.hpp"
+#include "seq/tyshkevich_a_hoare_simple_merge/include/ops_seq.hpp"
+#include "seq/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_seq.hpp"
+
+using ppc::core::MakeSortBenchmarkCase;
+
+TEST(sort_benchmark_seq, distributions) {
+  using Tyshkevich = tyshkevich_a_hoare_simple_merge_seq::HoareSortTask<double, std::less<>>;
+  const std::vector<ppc::core::SortBenchmarkCase> cases = {
+      MakeSortBenchmarkCase<long long>("belov_a_radix_sort_with_batcher_mergesort",
+                                       [](ppc::core::TaskDataPtr task_data) {
+                                         // The array size is passed twice
+                                         task_data->inputs_count.emplace_back(task_data->inputs_count[0]);
+                                         return std::make_shared<
+                                             belov_a_radix_batcher_mergesort_seq::RadixBatcherMergesortSequential>(
+                                             task_data);
+                                       }),
+      MakeSortBenchmarkCase<bessonov_e_radix_sort_simple_merging_seq::TestTaskSequential, double>(
+          "bessonov_e_radix_sort_simple_merging"),
+      MakeSortBenchmarkCase<burykin_m_radix_seq::RadixSequential, int>("burykin_m_radix"),
+      MakeSortBenchmarkCase<ermilova_d_shell_sort_batcher_even_odd_merger_seq::SequentialTask, int>(
+          "ermilova_d_shell_sort_batcher_even_odd_merger"),
+      MakeSortBenchmarkCase<fyodorov_m_shell_sort_with_even_odd_batcher_merge_seq::TestTaskSequential, int>(
+          "fyodorov_m_shell_sort_with_even_odd_batcher_merge"),
+      MakeSortBenchmarkCase<gusev_n_sorting_int_simple_merging_seq::TestTaskSequential, int>(
+          "gusev_n_sorting_int_simple_merging"),
+      MakeSortBenchmarkCase<kalyakina_a_shell_with_simple_merge_seq::ShellSortSequential, int>(
+          "kalyakina_a_Shell_with_simple_merge"),
+      MakeSortBenchmarkCase<khovansky_d_double_radix_batcher_seq::RadixSeq, double>("khovansky_d_double_radix_batcher"),
+      MakeSortBenchmarkCase<korovin_n_qsort_batcher_seq::TestTaskSequential, int>("korovin_n_qsort_batcher"),
+      MakeSortBenchmarkCase<koshkin_m_radix_int_simple_merge::SeqT, int>("koshkin_m_radix_int_simple_merge"),
+      MakeSortBenchmarkCase<int>("koshkin_n_shell_sort_batchers_even_odd_merge",
+                                 [ascending = true](ppc::core::TaskDataPtr task_data) mutable {
+                                   task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(&ascending));
+                                   return std::make_shared<
+                                       koshkin_n_shell_sort_batchers_even_odd_merge_seq::TestTaskSequential>(task_data);
+                                 }),
+      MakeSortBenchmarkCase<kovalchuk_a_shell_sort::ShellSortSequential, int>("kovalchuk_a_shell_sort"),
+      MakeSortBenchmarkCase<kovalev_k_radix_sort_batcher_merge_seq::RadixSortBatcherMerge, long long>(
+          "kovalev_k_radix_sort_batcher_merge"),
+      MakeSortBenchmarkCase<kudryashova_i_radix_batcher_seq::TestTaskSequential, double>("kudryashova_i_radix_batcher"),
+      MakeSortBenchmarkCase<malyshev_v_radix_sort_seq::RadixSortSequential, double>("malyshev_v_radix_sort"),
+      MakeSortBenchmarkCase<nikolaev_r_hoare_sort_simple_merge_seq::HoareSortSimpleMergeSequential, double>(
+          "nikolaev_r_hoare_sort_simple_merge"),
+      MakeSortBenchmarkCase<opolin_d_radix_betcher_sort_seq::RadixBetcherSortTaskSequential, int>(
+          "opolin_d_radix_sort_betcher_merge"),
+      MakeSortBenchmarkCase<petrov_a_radix_double_batcher_seq::TestTaskSequential, double>(
+          "petrov_a_radix_double_batcher"),
+      MakeSortBenchmarkCase<shlyakov_m_shell_sort_seq::TestTaskSequential, int>("shlyakov_m_shell_sort"),
+      MakeSortBenchmarkCase<shuravina_o_hoare_simple_merger::TestTaskSequential, int>(
+          "shuravina_o_hoare_simple_merger"),
+      MakeSortBenchmarkCase<smirnov_i_radix_sort_simple_merge_seq::TestTaskSequential, int>(
+          "smirnov_i_radix_sort_simple_merge"),
+      MakeSortBenchmarkCase<solovyev_d_shell_sort_simple_seq::TaskSequential, int>("solovyev_d_shell_sort_simple"),
+      MakeSortBenchmarkCase<sorochkin_d_radix_double_sort_simple_merge_seq::SortTask, double>(
+          "sorochkin_d_radix_double_sort_simple_merge"),
+      MakeSortBenchmarkCase<sotskov_a_shell_sorting_with_simple_merging_seq::TestTaskSequential, int>(
+          "sotskov_a_shell_sorting_with_simple_merging"),
+      MakeSortBenchmarkCase<tsatsyn_a_radix_sort_simple_merge_seq::TestTaskSequential, double>(
+          "tsatsyn_a_radix_sort_simple_merge"),
+      MakeSortBenchmarkCase<double>("tyshkevich_a_hoare_simple_merge",
+                                    [](ppc::core::TaskDataPtr task_data) {
+                                      return std::make_shared<Tyshkevich>(std::move(task_data), std::less<>());
+                                    }),
+      MakeSortBenchmarkCase<volochaev_s_shell_sort_with_batchers_even_odd_merge_seq::ShellSortSequential, int>(
+          "volochaev_s_Shell_sort_with_Batchers_even-odd_merge"),
+  };
+
+  // Tasks known to crash on or missort some of the inputs; a problem of any other task fails the benchmark
+  const std::set<std::string> expected_failures = {
+      "belov_a_radix_sort_with_batcher_mergesort",
+      "gusev_n_sorting_int_simple_merging",
+      "malyshev_v_radix_sort",
+      "opolin_d_radix_sort_betcher_merge",
+      "smirnov_i_radix_sort_simple_merge",
+      "tsatsyn_a_radix_sort_simple_merge",
+  };
+  const std::vector<std::string> problems = ppc::core::RunSortBenchmark("sort_benchmark_seq", cases);
+  for (const auto &problem : problems) {
+    std::cout << "sort_benchmark_seq: problem: " << problem << '\n';
+  }
+  EXPECT_TRUE(ppc::core::UnexpectedSortProblems(problems, expected_failures).empty());
+}
@@ -1,31 +1,13 @@
 #include "seq/sotskov_a_shell_sorting_with_simple_merging/include/ops_seq.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstddef>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
+
 void sotskov_a_shell_sorting_with_simple_merging_seq::ShellSortWithSimpleMerging(std::vector<int>& arr) {
-  int array_size = static_cast<int>(arr.size());
-
-  int gap = 1;
-  while (gap < array_size / 3) {
-    gap = gap * 3 + 1;
-  }
-
-  while (gap > 0) {
-    for (int i = gap; i < array_size; ++i) {
-      int current_element = arr[i];
-      int j = i;
-
-      while (j >= gap && arr[j - gap] > current_element) {
-        arr[j] = arr[j - gap];
-        j -= gap;
-      }
-      arr[j] = current_element;
-    }
-    gap /= 3;
-  }
+  ppc::sort::ShellSort(arr.data(), arr.size(), ppc::sort::MakeGaps(ppc::sort::GapSequence::kCiura, arr.size()));
 }
 
 bool sotskov_a_shell_sorting_with_simple_merging_seq::TestTaskSequential::PreProcessingImpl() {
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/precision.hpp"
+#include "core/task/include/task.hpp"
+#include "tbb/dense_gemm/include/ops_tbb.hpp"
+
+namespace {
+
+std::vector<double> GenerateMatrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> matrix(rows * cols);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+std::vector<double> NaiveMultiply(const std::vector<double> &a, const std::vector<double> &b, std::size_t m,
+                                  std::size_t k, std::size_t n) {
+  std::vector<double> c(m * n);
+  for (std::size_t i = 0; i < m; ++i) {
+    for (std::size_t p = 0; p < k; ++p) {
+      for (std::size_t j = 0; j < n; ++j) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+template <typename T>
+ppc::core::TaskDataPtr MakeTaskData(std::vector<T> &a, std::vector<T> &b, std::vector<T> &c, std::size_t m,
+                                    std::size_t k, std::size_t n) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data->inputs_count = {static_cast<unsigned>(m), static_cast<unsigned>(k), static_cast<unsigned>(n)};
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+  task_data->outputs_count.emplace_back(c.size());
+  return task_data;
+}
+
+void CheckAgainstNaive(std::size_t m, std::size_t k, std::size_t n) {
+  auto a = GenerateMatrix(m, k, 1);
+  auto b = GenerateMatrix(k, n, 2);
+  std::vector<double> c(m * n);
+  dense_gemm_tbb::GemmTBB task(MakeTaskData(a, b, c, m, k, n));
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  const auto expected = NaiveMultiply(a, b, m, k, n);
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    ASSERT_NEAR(c[i], expected[i], 1e-9) << i;
+  }
+}
+
+// Multiplies batch pairs of matrices in one task and checks each product against the naive one
+void CheckBatchAgainstNaive(std::size_t batch, std::size_t m, std::size_t k, std::size_t n) {
+  auto a = GenerateMatrix(batch * m, k, 8);
+  auto b = GenerateMatrix(batch * k, n, 9);
+  std::vector<double> c(batch * m * n);
+  auto task_data = MakeTaskData(a, b, c, m, k, n);
+  task_data->inputs_count.push_back(static_cast<unsigned>(batch));
+  dense_gemm_tbb::GemmTBB task(task_data);
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  for (std::size_t i = 0; i < batch; ++i) {
+    const auto expected =
+        NaiveMultiply(std::vector<double>(a.begin() + static_cast<std::ptrdiff_t>(i * m * k),
+                                          a.begin() + static_cast<std::ptrdiff_t>((i + 1) * m * k)),
+                      std::vector<double>(b.begin() + static_cast<std::ptrdiff_t>(i * k * n),
+                                          b.begin() + static_cast<std::ptrdiff_t>((i + 1) * k * n)),
+                      m, k, n);
+    for (std::size_t e = 0; e < m * n; ++e) {
+      ASSERT_NEAR(c[(i * m * n) + e], expected[e], 1e-9) << "product " << i << ", element " << e;
+    }
+  }
+}
+
+// Runs the task on float inputs and compares its result with the double product of the same inputs
+template <typename Acc>
+ppc::linalg::ErrorStats FloatErrorAgainstDouble(std::size_t m, std::size_t k, std::size_t n) {
+  const auto a_wide = GenerateMatrix(m, k, 6);
+  const auto b_wide = GenerateMatrix(k, n, 7);
+  std::vector<float> a(a_wide.begin(), a_wide.end());
+  std::vector<float> b(b_wide.begin(), b_wide.end());
+  std::vector<float> c(m * n);
+  dense_gemm_tbb::GemmTBB<float, Acc> task(MakeTaskData(a, b, c, m, k, n));
+  EXPECT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  const auto expected = NaiveMultiply(std::vector<double>(a.begin(), a.end()), std::vector<double>(b.begin(), b.end()),
+                                      m, k, n);
+  return ppc::linalg::CompareToReference(c.data(), expected.data(), c.size());
+}
+
+}  // namespace
+
+TEST(dense_gemm_tbb, multiplies_1x1) { CheckAgainstNaive(1, 1, 1); }
+
+TEST(dense_gemm_tbb, multiplies_square) { CheckAgainstNaive(128, 128, 128); }
+
+TEST(dense_gemm_tbb, multiplies_odd_square) { CheckAgainstNaive(101, 101, 101); }
+
+TEST(dense_gemm_tbb, multiplies_rectangular) { CheckAgainstNaive(37, 300, 515); }
+
+TEST(dense_gemm_tbb, multiplies_row_by_column) { CheckAgainstNaive(1, 777, 1); }
+
+TEST(dense_gemm_tbb, multiplies_column_by_row) { CheckAgainstNaive(300, 1, 300); }
+
+TEST(dense_gemm_tbb, identity_keeps_matrix) {
+  constexpr std::size_t kN = 67;
+  auto a = GenerateMatrix(kN, kN, 3);
+  std::vector<double> identity(kN * kN);
+  for (std::size_t i = 0; i < kN; ++i) {
+    identity[(i * kN) + i] = 1.0;
+  }
+  std::vector<double> c(kN * kN);
+  dense_gemm_tbb::GemmTBB task(MakeTaskData(a, identity, c, kN, kN, kN));
+  ASSERT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  EXPECT_EQ(c, a);
+}
+
+TEST(dense_gemm_tbb, rejects_wrong_output_size) {
+  auto a = GenerateMatrix(4, 5, 4);
+  auto b = GenerateMatrix(5, 6, 5);
+  std::vector<double> c(4 * 5);
+  dense_gemm_tbb::GemmTBB task(MakeTaskData(a, b, c, 4, 5, 6));
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(dense_gemm_tbb, multiplies_batch_of_small_matrices) {
+  CheckBatchAgainstNaive(1000, 8, 8, 8);
+  CheckBatchAgainstNaive(300, 5, 3, 7);
+}
+
+TEST(dense_gemm_tbb, multiplies_batch_of_large_matrices) { CheckBatchAgainstNaive(3, 70, 90, 80); }
+
+TEST(dense_gemm_tbb, rejects_output_of_one_product_of_a_batch) {
+  auto a = GenerateMatrix(2 * 4, 5, 4);
+  auto b = GenerateMatrix(2 * 5, 6, 5);
+  std::vector<double> c(4 * 6);
+  auto task_data = MakeTaskData(a, b, c, 4, 5, 6);
+  task_data->inputs_count.push_back(2);
+  dense_gemm_tbb::GemmTBB task(task_data);
+  EXPECT_FALSE(task.Validation());
+}
+
+TEST(dense_gemm_tbb, float_is_close_to_double) {
+  const auto error = FloatErrorAgainstDouble<float>(97, 1000, 83);
+  EXPECT_LT(error.max_rel, 1e-5) << "max_abs=" << error.max_abs;
+}
+
+TEST(dense_gemm_tbb, mixed_precision_only_rounds_the_result) {
+  const auto single = FloatErrorAgainstDouble<float>(97, 1000, 83);
+  const auto mixed = FloatErrorAgainstDouble<double>(97, 1000, 83);
+  // Half an ulp of float, relative to the largest element
+  EXPECT_LT(mixed.max_rel, 1e-7);
+  EXPECT_LT(mixed.max_abs, single.max_abs);
+}
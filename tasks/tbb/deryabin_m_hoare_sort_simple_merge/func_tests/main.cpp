@@ -358,3 +358,34 @@ TEST(deryabin_m_hoare_sort_simple_merge_tbb, test_invalid_chunk_count) {
   deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB hoare_sort_task_tbb(task_data_tbb);
   ASSERT_EQ(hoare_sort_task_tbb.Validation(), false);
 }
+
+TEST(deryabin_m_hoare_sort_simple_merge_tbb, test_large_array_few_unique_elements) {
+  // Create data
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_int_distribution<> distribution(0, 3);
+  std::vector<double> input_array(300000);
+  std::ranges::generate(input_array.begin(), input_array.end(), [&] { return distribution(gen); });
+  std::vector<std::vector<double>> in_array(1, input_array);
+  size_t chunk_count = 8;
+  std::vector<double> output_array(300000);
+  std::vector<std::vector<double>> out_array(1, output_array);
+  std::vector<double> true_solution(input_array);
+  std::ranges::sort(true_solution.begin(), true_solution.end());
+
+  // Create TaskData
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_array.data()));
+  task_data_tbb->inputs_count.emplace_back(input_array.size());
+  task_data_tbb->inputs_count.emplace_back(chunk_count);
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_array.data()));
+  task_data_tbb->outputs_count.emplace_back(output_array.size());
+
+  // Create Task
+  deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB hoare_sort_task_tbb(task_data_tbb);
+  ASSERT_EQ(hoare_sort_task_tbb.Validation(), true);
+  hoare_sort_task_tbb.PreProcessing();
+  hoare_sort_task_tbb.Run();
+  hoare_sort_task_tbb.PostProcessing();
+  ASSERT_EQ(true_solution, out_array[0]);
+}
@@ -1,14 +1,17 @@
 #include "tbb/deryabin_m_hoare_sort_simple_merge/include/ops_tbb.hpp"
 
-#include <tbb/tbb.h>
+#include <oneapi/tbb/task_arena.h>
 
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <functional>
 #include <numbers>
 #include <vector>
 
-#include "oneapi/tbb/parallel_for.h"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sort/include/quick_sort.hpp"
+#include "core/util/include/util.hpp"
 
 void deryabin_m_hoare_sort_simple_merge_tbb::HoaraSort(std::vector<double>& a, size_t first, size_t last) {
   if (first >= last) {
@@ -105,8 +108,6 @@ bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskSequential::PostProces
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::PreProcessingImpl() {
   input_array_A_ = reinterpret_cast<std::vector<double>*>(task_data->inputs[0])[0];
   dimension_ = task_data->inputs_count[0];
-  chunk_count_ = task_data->inputs_count[1];
-  min_chunk_size_ = dimension_ / chunk_count_;
   return true;
 }
 
@@ -117,15 +118,11 @@ bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::ValidationImpl()
 }
 
 bool deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB::RunImpl() {
-  oneapi::tbb::parallel_for(0, (int)chunk_count_, 1, [=, this](int count) {
-    HoaraSort(input_array_A_, count * min_chunk_size_, ((count + 1) * min_chunk_size_) - 1);
+  // параллельная быстрая сортировка на месте, без разбиения на части и слияния
+  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+  arena.execute([&] {
+    ppc::sort::ParallelHoareSort(input_array_A_.data(), dimension_, std::less<>(), ppc::linalg::TbbFor{});
   });
-  for (size_t i = 0; i < (size_t)(log((double)chunk_count_) / std::numbers::ln2); i++) {
-    oneapi::tbb::parallel_for(0, (int)chunk_count_ >> (i + 1), 1, [=, this](int j) {
-      MergeTwoParts(input_array_A_, (size_t)j * min_chunk_size_ << (i + 1),
-                    (((size_t)j + 1) * min_chunk_size_ << (i + 1)) - 1, dimension_);
-    });
-  }
   return true;
 }
 
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace filatev_v_foks_tbb {
@@ -38,6 +39,9 @@ class Focks : public ppc::core::Task {
   std::vector<double> matrix_a_;
   std::vector<double> matrix_b_;
   std::vector<double> matrix_c_;
+
+  // One per thread, so that every block product reuses the packing buffers of its thread
+  std::vector<ppc::linalg::GemmWorkspace<double>> workspaces_;
 };
 
 }  // namespace filatev_v_foks_tbb
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/sparse_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 using Complex = std::complex<double>;
@@ -23,6 +24,7 @@ struct SparseMatrixCRS {
   SparseMatrixCRS(const SparseMatrixCRS& other) = default;
   SparseMatrixCRS& operator=(const SparseMatrixCRS& other) = default;
   static void PrintSparseMatrix(const SparseMatrixCRS& matrix);
+  [[nodiscard]] ppc::sparse::CrsView<Complex> View() const;
 };
 std::vector<Complex> ParseMatrixIntoVec(const SparseMatrixCRS& mat);
 SparseMatrixCRS ParseVectorIntoMatrix(std::vector<Complex>& vec);
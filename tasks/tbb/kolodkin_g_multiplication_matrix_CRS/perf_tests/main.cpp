@@ -1,13 +1,19 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
+#include <iostream>
 #include <memory>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/benchmark.hpp"
+#include "core/sparse/include/convert.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "tbb/kolodkin_g_multiplication_matrix_CRS/include/ops_tbb.hpp"
 
@@ -134,3 +140,54 @@ TEST(kolodkin_g_multiplication_matrix__task_tbb, test_task_run) {
   kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS res =
       kolodkin_g_multiplication_matrix_tbb::ParseVectorIntoMatrix(out);
 }
+
+// The benchmark matrix: every structure of ppc::sparse::SparseBenchmarkSuite through the task, timing
+// PreProcessing and Run together. The task multiplies complex matrices, so the real entries of the suite go in
+// as real parts, and C is checked against the product of ppc::sparse::SpGemm in CRS. The task also passes the
+// indices of C as complex numbers and keeps copies of them, so the matrices are smaller than the other tasks' ones.
+TEST(kolodkin_g_multiplication_matrix__task_tbb, structured_matrices) {
+  auto to_task = [](const ppc::sparse::CcsMatrix<double> &m) {
+    const auto crs = ppc::sparse::CcsToCrs(m.View());
+    kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS res(static_cast<int>(m.rows), static_cast<int>(m.cols));
+    res.values = std::vector<Complex>(crs.values.begin(), crs.values.end());
+    res.colIndices = crs.col_index;
+    res.rowPtr = crs.row_ptr;
+    return kolodkin_g_multiplication_matrix_tbb::ParseMatrixIntoVec(res);
+  };
+  for (const auto &c : ppc::sparse::SparseBenchmarkSuite(1 << 13, 16)) {
+    ppc::sparse::CcsMatrix<double> expected;
+    ppc::sparse::SpGemm(c.a.View(), c.b.View(), expected);
+    const auto expected_crs = ppc::sparse::CcsToCrs(expected.View());
+
+    std::vector<Complex> in = to_task(c.a);
+    const std::vector<Complex> in_b = to_task(c.b);
+    in.insert(in.end(), in_b.begin(), in_b.end());
+    std::vector<Complex> out(5 + (2 * expected.values.size()) + c.a.rows + 1);
+
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    task_data_tbb->inputs_count.emplace_back(in.size());
+    task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_tbb->outputs_count.emplace_back(out.size());
+
+    kolodkin_g_multiplication_matrix_tbb::TestTaskTBB task(task_data_tbb);
+    ASSERT_TRUE(task.ValidationImpl());
+    const auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(task.PreProcessingImpl());
+    ASSERT_TRUE(task.RunImpl());
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_TRUE(task.PostProcessingImpl());
+    const auto res = kolodkin_g_multiplication_matrix_tbb::ParseVectorIntoMatrix(out);
+    ASSERT_EQ(res.rowPtr, expected_crs.row_ptr) << c.name;
+    ASSERT_EQ(res.colIndices, expected_crs.col_index) << c.name;
+    for (std::size_t i = 0; i < res.values.size(); ++i) {
+      ASSERT_NEAR(res.values[i].real(), expected_crs.values[i], 1e-9) << c.name << " " << i;
+      ASSERT_EQ(res.values[i].imag(), 0.0) << c.name << " " << i;
+    }
+    std::cout << ppc::sparse::FormatSparseRate("kolodkin_g_multiplication_matrix_tbb", c.name,
+                                               ppc::sparse::SpGemmMultiplyAdds(c.a.View(), c.b.View()),
+                                               c.a.values.size() + c.b.values.size() + res.values.size(),
+                                               elapsed.count())
+              << '\n';
+  }
+}
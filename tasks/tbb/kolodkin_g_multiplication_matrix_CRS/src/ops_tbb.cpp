@@ -1,8 +1,5 @@
 #include "tbb/kolodkin_g_multiplication_matrix_CRS/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/parallel_for.h>
-#include <tbb/tbb.h>
-
 #include <cmath>
 #include <complex>
 #include <cstddef>
@@ -10,6 +7,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/sparse/include/spgemm.hpp"
+
 void kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::AddValue(int row, Complex value, int col) {
   bool found = false;
   for (int j = rowPtr[row]; j < rowPtr[row + 1]; j++) {
@@ -28,6 +28,14 @@ void kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::AddValue(int row, Co
   }
 }
 
+ppc::sparse::CrsView<Complex> kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::View() const {
+  return {.rows = static_cast<std::size_t>(numRows),
+          .cols = static_cast<std::size_t>(numCols),
+          .row_ptr = rowPtr.data(),
+          .col_index = colIndices.data(),
+          .values = values.data()};
+}
+
 void kolodkin_g_multiplication_matrix_tbb::SparseMatrixCRS::PrintSparseMatrix(const SparseMatrixCRS& matrix) {
   for (int i = 0; i < matrix.numRows; i++) {
     for (int j = matrix.rowPtr[i]; j < matrix.rowPtr[i + 1]; j++) {
@@ -142,31 +150,15 @@ bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::ValidationImpl() {
 }
 
 bool kolodkin_g_multiplication_matrix_tbb::TestTaskTBB::RunImpl() {
-  SparseMatrixCRS c(A_.numRows, B_.numCols);
-
-  std::vector<std::vector<std::pair<int, Complex>>> local_results(A_.numRows);
-
-  tbb::parallel_for(tbb::blocked_range<unsigned int>(0, A_.numRows), [&](const tbb::blocked_range<unsigned int>& r) {
-    for (unsigned int i = r.begin(); i < r.end(); ++i) {
-      for (unsigned int j = A_.rowPtr[i]; j < (unsigned int)A_.rowPtr[i + 1]; ++j) {
-        unsigned int col_a = A_.colIndices[j];
-        Complex value_a = A_.values[j];
-
-        for (unsigned int k = B_.rowPtr[col_a]; k < (unsigned int)B_.rowPtr[col_a + 1]; ++k) {
-          unsigned int col_b = B_.colIndices[k];
-          Complex value_b = B_.values[k];
-          local_results[i].emplace_back(col_b, value_a * value_b);
-        }
-      }
-    }
-  });
-
-  for (size_t row_index = 0; row_index < local_results.size(); ++row_index) {
-    for (const auto& [col_index, value] : local_results[row_index]) {
-      c.AddValue(static_cast<int>(row_index), value, col_index);
-    }
-  }
+  // The CRS arrays of A * B are the CCS arrays of B^T * A^T, and those of A and B read as CCS are A^T and B^T
+  ppc::sparse::CcsMatrix<Complex> product;
+  ppc::sparse::SpGemm(ppc::sparse::TransposedView(B_.View()), ppc::sparse::TransposedView(A_.View()), product,
+                      ppc::linalg::TbbFor{});
 
+  SparseMatrixCRS c(A_.numRows, B_.numCols);
+  c.values = std::move(product.values);
+  c.colIndices = std::move(product.row_index);
+  c.rowPtr = std::move(product.col_ptr);
   output_ = ParseMatrixIntoVec(c);
 
   return true;
@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/sparse/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kondratev_ya_ccs_complex_multiplication_tbb {
@@ -23,6 +24,7 @@ struct CCSMatrix {
   CCSMatrix() : rows(0), cols(0) {}
   CCSMatrix(std::pair<int, int> sizes) : rows(sizes.first), cols(sizes.second) { col_ptrs.resize(cols + 1, 0); }
   CCSMatrix operator*(const CCSMatrix& other) const;
+  [[nodiscard]] ppc::sparse::CcsView<std::complex<double>> View() const;
 };
 
 class TestTaskTBB : public ppc::core::Task {
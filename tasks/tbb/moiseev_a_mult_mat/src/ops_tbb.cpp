@@ -2,10 +2,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/parallel_for.hpp"
 #include "core/util/include/util.hpp"
-#include "oneapi/tbb/parallel_for.h"
 #include "oneapi/tbb/task_arena.h"
 
 bool moiseev_a_mult_mat_tbb::MultMatTBB::PreProcessingImpl() {
@@ -23,12 +25,6 @@ bool moiseev_a_mult_mat_tbb::MultMatTBB::PreProcessingImpl() {
 
   matrix_size_ = static_cast<int>(std::sqrt(input_size_a));
 
-  block_size_ = static_cast<int>(std::sqrt(matrix_size_));
-  if (matrix_size_ % block_size_ != 0) {
-    block_size_ = 1;
-  }
-  num_blocks_ = matrix_size_ / block_size_;
-
   return true;
 }
 
@@ -38,36 +34,11 @@ bool moiseev_a_mult_mat_tbb::MultMatTBB::ValidationImpl() {
 }
 
 bool moiseev_a_mult_mat_tbb::MultMatTBB::RunImpl() {
+  const auto n = static_cast<std::size_t>(matrix_size_);
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
   arena.execute([&] {
-    oneapi::tbb::parallel_for(0, num_blocks_, [&](int block_row) {
-      for (int block_col = 0; block_col < num_blocks_; ++block_col) {
-        for (int block_step = 0; block_step < num_blocks_; ++block_step) {
-          int a_block_col = (block_row + block_step) % num_blocks_;
-          int b_block_row = a_block_col;
-
-          int block_row_start = block_row * block_size_;
-          int block_col_start = block_col * block_size_;
-          int a_col_start = a_block_col * block_size_;
-          int b_row_start = b_block_row * block_size_;
-
-          for (int row_offset = 0; row_offset < block_size_; ++row_offset) {
-            for (int col_offset = 0; col_offset < block_size_; ++col_offset) {
-              double block_result = 0.0;
-              for (int inner_dim_offset = 0; inner_dim_offset < block_size_; ++inner_dim_offset) {
-                double a_element =
-                    matrix_a_[((block_row_start + row_offset) * matrix_size_) + (a_col_start + inner_dim_offset)];
-                double b_element =
-                    matrix_b_[((b_row_start + inner_dim_offset) * matrix_size_) + (block_col_start + col_offset)];
-                block_result += a_element * b_element;
-              }
-              matrix_c_[((block_row_start + row_offset) * matrix_size_) + (block_col_start + col_offset)] +=
-                  block_result;
-            }
-          }
-        }
-      }
-    });
+    ppc::linalg::Gemm(n, n, n, 1.0, matrix_a_.data(), n, matrix_b_.data(), n, 0.0, matrix_c_.data(), n,
+                      ppc::linalg::TbbFor{});
   });
   return true;
 }
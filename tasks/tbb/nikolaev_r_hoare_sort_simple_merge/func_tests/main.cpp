@@ -54,7 +54,7 @@ class HoareSortTest : public testing::TestWithParam<size_t> {
 TEST_P(HoareSortTest, sort_test) { CreateTest(GetParam()); }
 
 INSTANTIATE_TEST_SUITE_P(nikolaev_r_hoare_sort_simple_merge_seq, HoareSortTest,
-                         testing::Values(1, 2, 10, 100, 150, 200, 1000, 2000, 5000));
+                         testing::Values(1, 2, 10, 100, 150, 200, 1000, 2000, 5000, 100000, 300000));
 
 }  // namespace
 
@@ -120,3 +120,52 @@ TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_input_and_output_sizes_not_equ
   nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
   ASSERT_FALSE(hoare_sort_simple_merge_tbb.Validation());
 }
+
+TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_few_unique_values) {
+  std::vector<double> in(200000);
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = static_cast<double>((i * 7919) % 3);
+  }
+  std::vector<double> out(in.size(), 0.0);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data_tbb->inputs_count.emplace_back(in.size());
+  task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_tbb->outputs_count.emplace_back(out.size());
+
+  nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.Validation());
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.PreProcessing());
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.Run());
+  ASSERT_TRUE(hoare_sort_simple_merge_tbb.PostProcessing());
+
+  std::ranges::sort(in);
+  EXPECT_EQ(out, in);
+}
+
+TEST(nikolaev_r_hoare_sort_simple_merge_tbb, test_sorted_and_equal_inputs) {
+  std::vector<double> sorted(150000);
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    sorted[i] = static_cast<double>(i);
+  }
+  std::vector<double> equal(150000, 42.0);
+
+  for (auto *in : {&sorted, &equal}) {
+    std::vector<double> out(in->size(), 0.0);
+
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->inputs.emplace_back(reinterpret_cast<uint8_t *>(in->data()));
+    task_data_tbb->inputs_count.emplace_back(in->size());
+    task_data_tbb->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_tbb->outputs_count.emplace_back(out.size());
+
+    nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB hoare_sort_simple_merge_tbb(task_data_tbb);
+    ASSERT_TRUE(hoare_sort_simple_merge_tbb.Validation());
+    ASSERT_TRUE(hoare_sort_simple_merge_tbb.PreProcessing());
+    ASSERT_TRUE(hoare_sort_simple_merge_tbb.Run());
+    ASSERT_TRUE(hoare_sort_simple_merge_tbb.PostProcessing());
+
+    EXPECT_EQ(out, *in);
+  }
+}
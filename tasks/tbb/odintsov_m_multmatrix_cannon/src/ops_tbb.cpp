@@ -1,138 +1,28 @@
 #include "tbb/odintsov_m_multmatrix_cannon/include/ops_tbb.hpp"
 
-#include <oneapi/tbb/global_control.h>
-#include <oneapi/tbb/mutex.h>
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/task_arena.h>
 #include <tbb/tbb.h>
 
-#include <algorithm>
 #include <cmath>
 #include <core/util/include/util.hpp>
 #include <cstddef>
 #include <vector>
 
-using namespace std;
-void odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::ShiftRow(std::vector<double>& matrix, int root, int row,
-                                                                   int shift) {
-  shift = shift % root;
-  std::vector<double> tmp(root);
-  for (int j = 0; j < root; j++) {
-    tmp[j] = matrix[(row * root) + ((j + shift) % root)];
-  }
-  for (int j = 0; j < root; j++) {
-    matrix[(row * root) + j] = tmp[j];
-  }
-}
-
-void odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::ShiftColumn(std::vector<double>& matrix, int root, int col,
-                                                                      int shift) {
-  shift = shift % root;
-  std::vector<double> tmp(root);
-
-  for (int i = 0; i < root; i++) {
-    tmp[i] = matrix[(((i + shift) % root) * root) + col];
-  }
-  for (int i = 0; i < root; i++) {
-    matrix[(i * root) + col] = tmp[i];
-  }
-}
-void odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::ShiftBlocksUp(std::vector<double>& matrix, int root,
-                                                                        int sz) const {
-  int p = root / block_sz_;
-  for (int bj = 0; bj < p; bj++) {
-    std::vector<double> first_block(block_sz_ * block_sz_);
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        first_block[(i * block_sz_) + j] = matrix[(i * root) + ((bj * block_sz_) + j)];
-      }
-    }
-
-    for (int bi = 0; bi < (p - 1); bi++) {
-      for (int i = 0; i < block_sz_; i++) {
-        for (int j = 0; j < block_sz_; j++) {
-          matrix[((bi * block_sz_ + i) * root) + (bj * block_sz_) + j] =
-              matrix[(((bi + 1) * block_sz_) * root) + (i * root) + ((bj * block_sz_) + j)];
-        }
-      }
-    }
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        matrix[((((p - 1) * block_sz_) * root) + (i * root) + ((bj * block_sz_) + j))] =
-            first_block[(i * block_sz_) + j];
-      }
-    }
-  }
-}
-
-void odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::ShiftBlocksLeft(std::vector<double>& matrix, int root,
-                                                                          int sz) const {
-  int p = root / block_sz_;
-  for (int bi = 0; bi < p; bi++) {
-    std::vector<double> first_block(block_sz_ * block_sz_);
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        first_block[(i * block_sz_) + j] = matrix[((bi * block_sz_ + i) * root) + j];
-      }
-    }
-
-    for (int bj = 0; bj < (p - 1); bj++) {
-      for (int i = 0; i < block_sz_; i++) {
-        for (int j = 0; j < block_sz_; j++) {
-          matrix[((bi * block_sz_ + i) * root) + (bj * block_sz_) + j] =
-              matrix[((bi * block_sz_ + i) * root) + (((bj + 1) * block_sz_) + j)];
-        }
-      }
-    }
-
-    for (int i = 0; i < block_sz_; i++) {
-      for (int j = 0; j < block_sz_; j++) {
-        matrix[((bi * block_sz_ + i) * root) + (((p - 1) * block_sz_) + j)] = first_block[(i * block_sz_) + j];
-      }
-    }
-  }
-}
+#include "core/linalg/include/blocking.hpp"
+#include "core/linalg/include/gemm.hpp"
 
+using namespace std;
 bool odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::IsSquere(unsigned int num) {
   auto root = static_cast<unsigned int>(std::sqrt(num));
   return (root * root) == num;
 }
 
 int odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::GetBlockSize(int n) {
-  for (int k = (n / 2); k >= 2; k--) {
-    if ((n % k) == 0) {
-      return k;
-    }
-  }
-  return 1;
-}
-void odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::CopyBlock(const std::vector<double>& matrix,
-                                                                    std::vector<double>& block, int start, int root,
-                                                                    int block_sz) {
-  for (int i = 0; i < block_sz; i++) {
-    for (int j = 0; j < block_sz; j++) {
-      int index = start + (i * root) + j;
-      block[(i * block_sz) + j] = matrix[index];
-    }
-  }
-}
-void odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::InitializeShift(std::vector<double>& matrix, int root,
-                                                                          int grid_size, int block_sz,
-                                                                          bool is_row_shift) {
-  for (int b = 0; b < grid_size; ++b) {
-    for (int index = b * block_sz; index < (b + 1) * block_sz; ++index) {
-      for (int shift = 0; shift < b; ++shift) {
-        if (is_row_shift) {
-          ShiftRow(matrix, root, index, block_sz);
-        } else {
-          ShiftColumn(matrix, root, index, block_sz);
-        }
-      }
-    }
-  }
+  // Блоки читаются на месте, последний блок может быть короче остальных
+  return static_cast<int>(ppc::linalg::ChooseBlockSize(n, sizeof(double)));
 }
+
 bool odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::PreProcessingImpl() {
   szA_ = task_data->inputs_count[0];
   szB_ = task_data->inputs_count[1];
@@ -143,6 +33,10 @@ bool odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::PreProcessingImpl() {
   matrixC_.assign(szA_, 0);
 
   block_sz_ = GetBlockSize(static_cast<int>(sqrt(szA_)));
+  workspaces_.resize(ppc::util::GetPPCNumThreads());
+  for (auto& workspace : workspaces_) {
+    workspace.Reserve(block_sz_, block_sz_, block_sz_);
+  }
   return true;
 }
 
@@ -158,54 +52,30 @@ bool odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::ValidationImpl() {
 }
 
 bool odintsov_m_mulmatrix_cannon_tbb::MulMatrixCannonTBB::RunImpl() {
-  // Определяем число потоков, доступное в системе.
-  int num_threads = ppc::util::GetPPCNumThreads();
-
-  // Создаем global_control с корректным числом потоков.
-  oneapi::tbb::global_control gc(oneapi::tbb::global_control::max_allowed_parallelism, num_threads);
-
-  int root = static_cast<int>(std::sqrt(szA_));
-  // Если root/block_sz_ меньше 1, гарантируем минимум 1 итерацию.
-  int num_blocks = std::max(1, root / block_sz_);
-  int grid_size = num_blocks;  // grid_size = root / block_sz_
-
-  // Начальные сдвиги матриц
-  InitializeShift(matrixA_, root, grid_size, block_sz_, true);
-  InitializeShift(matrixB_, root, grid_size, block_sz_, false);
-
-  tbb::mutex mtx;
-  for (int step = 0; step < grid_size; step++) {
-    // Параллельное выполнение по блокам по строкам (bi)
-    tbb::parallel_for(0, num_blocks, [&](int bi) {
-      std::vector<double> local_block_a(block_sz_ * block_sz_, 0);
-      std::vector<double> local_block_b(block_sz_ * block_sz_, 0);
-
-      for (int bj = 0; bj < num_blocks; bj++) {
-        int start = ((bi * block_sz_) * root) + (bj * block_sz_);
-        // Копируем блоки локально из глобальных матриц
-        CopyBlock(matrixA_, local_block_a, start, root, block_sz_);
-        CopyBlock(matrixB_, local_block_b, start, root, block_sz_);
-
-        // Вычисляем произведение блоков
-        for (int i = 0; i < block_sz_; i++) {
-          for (int k = 0; k < block_sz_; k++) {
-            double a_ik = local_block_a[(i * block_sz_) + k];
-            for (int j = 0; j < block_sz_; j++) {
-              int index = ((bi * block_sz_ + i) * root) + (bj * block_sz_ + j);
-              {
-                tbb::mutex::scoped_lock lock(mtx);
-                matrixC_[index] += a_ik * local_block_b[(k * block_sz_) + j];
-              }
-            }
-          }
-        }
+  const auto root = static_cast<size_t>(std::sqrt(szA_));
+  const ppc::linalg::BlockTiling tiling(root, block_sz_);
+  const size_t grid_size = tiling.Count();
+
+  // Каждый блок C принадлежит одной итерации, которая выполняет для него все шаги.
+  // Сдвиги блоков заменены индексами: на шаге step на месте (bi, bj) оказались бы
+  // блоки A(bi, k) и B(k, bj), где k = CannonBlock(bi, bj, step), и они читаются
+  // прямо из неизменных A и B
+  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+  arena.execute([&] {
+    oneapi::tbb::parallel_for(size_t{0}, grid_size * grid_size, [&](size_t block) {
+      const size_t bi = block / grid_size;
+      const size_t bj = block % grid_size;
+      auto& workspace = workspaces_[oneapi::tbb::this_task_arena::current_thread_index()];
+      double* c_block = matrixC_.data() + (tiling.Begin(bi) * root) + tiling.Begin(bj);
+      for (size_t step = 0; step < grid_size; step++) {
+        const size_t k = ppc::linalg::CannonBlock(bi, bj, step, grid_size);
+        ppc::linalg::Gemm(tiling.Size(bi), tiling.Size(bj), tiling.Size(k), 1.0,
+                          matrixA_.data() + (tiling.Begin(bi) * root) + tiling.Begin(k), root,
+                          matrixB_.data() + (tiling.Begin(k) * root) + tiling.Begin(bj), root, 1.0, c_block, root,
+                          workspace);
       }
     });
-
-    // Последовательные сдвиги после каждого шага
-    ShiftBlocksLeft(matrixA_, root, block_sz_);
-    ShiftBlocksUp(matrixB_, root, block_sz_);
-  }
+  });
   return true;
 }
 
@@ -24,8 +24,8 @@ class CanonMatrix {
   [[nodiscard]] const std::vector<double>& GetMatrix() const;
   [[nodiscard]] size_t GetSize() const;
   [[nodiscard]] bool IsEmpty() const;
-  CanonMatrix MultiplicateMatrix(const CanonMatrix& canon_matrix, size_t offset);
-  void operator+=(const CanonMatrix& canon_matrix);
+  // Writes the given row of the full product, summed over all the offsets, to row_out
+  void AccumulateRow(const CanonMatrix& canon_matrix, size_t row, double* row_out) const;
   void ClearMatrix();
 };
 }  // namespace sarafanov_m_canon_mat_mul_tbb
\ No newline at end of file
@@ -87,22 +87,20 @@ bool sarafanov_m_canon_mat_mul_tbb::CanonMatMulTBB::ValidationImpl() {
 
 bool sarafanov_m_canon_mat_mul_tbb::CanonMatMulTBB::RunImpl() {
   c_matrix_.ClearMatrix();
-  std::vector<CanonMatrix> mul_results(ppc::util::GetPPCNumThreads());
+  const size_t size = a_matrix_.GetSize();
+  std::vector<double> result(size * size);
+  // Every row of the result is owned by one task, which sums all the offsets for it
+  // in place, so there are no per-thread partial products to reduce afterwards
   oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
   arena.execute([&] {
-    oneapi::tbb::parallel_for(
-        oneapi::tbb::blocked_range<size_t>(0, a_matrix_.GetSize(), a_matrix_.GetSize() / ppc::util::GetPPCNumThreads()),
-        [&](const oneapi::tbb::blocked_range<size_t> &distance) {
-          for (auto i = distance.begin(); i != distance.end(); ++i) {
-            mul_results[tbb::this_task_arena::current_thread_index()] += a_matrix_.MultiplicateMatrix(b_matrix_, i);
-          }
-        });
-  });
-  std::ranges::for_each(mul_results, [&](const auto &vector) {
-    if (!vector.IsEmpty()) {
-      c_matrix_ += vector;
-    }
+    oneapi::tbb::parallel_for(oneapi::tbb::blocked_range<size_t>(0, size),
+                              [&](const oneapi::tbb::blocked_range<size_t> &rows) {
+                                for (auto i = rows.begin(); i != rows.end(); ++i) {
+                                  a_matrix_.AccumulateRow(b_matrix_, i, result.data() + (i * size));
+                                }
+                              });
   });
+  c_matrix_.SetBaseMatrix(std::move(result));
   return true;
 }
 
@@ -9,6 +9,8 @@
 #include <utility>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
+
 namespace shlyakov_m_shell_sort_tbb {
 
 bool TestTaskTBB::PreProcessingImpl() {
@@ -64,23 +66,12 @@ bool TestTaskTBB::RunImpl() {
 }
 
 void ShellSort(int left, int right, std::vector<int>& arr) {
-  int gap = 1;
-  const int size = right - left + 1;
-  while (gap <= size / 3) {
-    gap = gap * 3 + 1;
-  }
-
-  for (; gap > 0; gap /= 3) {
-    for (int k = left + gap; k <= right; ++k) {
-      const int val = arr[k];
-      int j = k;
-      while (j >= left + gap && arr[j - gap] > val) {
-        arr[j] = arr[j - gap];
-        j -= gap;
-      }
-      arr[j] = val;
-    }
+  // The segments past the end of a short array are empty
+  if (right <= left) {
+    return;
   }
+  const auto size = static_cast<std::size_t>(right - left + 1);
+  ppc::sort::ShellSort(arr.data() + left, size, ppc::sort::MakeGaps(ppc::sort::GapSequence::kCiura, size));
 }
 
 void Merge(int left, int mid, int right, std::vector<int>& arr, std::vector<int>& buffer) {
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/sort_benchmark.hpp"
+#include "core/task/include/task.hpp"
+#include "tbb/deryabin_m_hoare_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/gusev_n_sorting_int_simple_merging/include/ops_tbb.hpp"
+#include "tbb/kalyakina_a_Shell_with_simple_merge/include/ops_tbb.hpp"
+#include "tbb/korovin_n_qsort_batcher/include/ops_tbb.hpp"
+#include "tbb/kovalev_k_radix_sort_batcher_merge/include/header.hpp"
+#include "tbb/mezhuev_m_bitwise_integer_sort_with_simple_merge/include/ops_tbb.hpp"
+#include "tbb/nikolaev_r_hoare_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/petrov_a_radix_double_batcher/include/ops_tbb.hpp"
+#include "tbb/shlyakov_m_shell_sort/include/ops_tbb.hpp"
+#include "tbb/smirnov_i_radix_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/sotskov_a_shell_sorting_with_simple_merging/include/ops_tbb.hpp"
+#include "tbb/tsatsyn_a_radix_sort_simple_merge/include/ops_tbb.hpp"
+#include "tbb/vershinina_a_hoare_sort_tbb/include/ops_tbb.hpp"
+#include "tbb/volochaev_s_Shell_sort_with_Batchers_even-odd_merge/include/ops_tbb.hpp"
+
+using ppc::core::MakeSortBenchmarkCase;
+
+TEST(sort_benchmark_tbb, distributions) {
+  const std::vector<ppc::core::SortBenchmarkCase> cases = {
+      ppc::core::MakeVectorSortBenchmarkCase<double>(
+          "deryabin_m_hoare_sort_simple_merge",
+          [](ppc::core::TaskDataPtr task_data) {
+            // Number of chunks
+            task_data->inputs_count.emplace_back(8);
+            return std::make_shared<deryabin_m_hoare_sort_simple_merge_tbb::HoareSortTaskTBB>(task_data);
+          }),
+      MakeSortBenchmarkCase<gusev_n_sorting_int_simple_merging_tbb::SortingIntSimpleMergingTBB, int>(
+          "gusev_n_sorting_int_simple_merging"),
+      MakeSortBenchmarkCase<kalyakina_a_shell_with_simple_merge_tbb::ShellSortTBB, int>(
+          "kalyakina_a_Shell_with_simple_merge"),
+      MakeSortBenchmarkCase<korovin_n_qsort_batcher_tbb::TestTaskTBB, int>("korovin_n_qsort_batcher"),
+      MakeSortBenchmarkCase<kovalev_k_radix_sort_batcher_merge_tbb::TestTaskTBB, long long>(
+          "kovalev_k_radix_sort_batcher_merge"),
+      MakeSortBenchmarkCase<mezhuev_m_bitwise_integer_sort_tbb::SortTBB, int>(
+          "mezhuev_m_bitwise_integer_sort_with_simple_merge"),
+      MakeSortBenchmarkCase<nikolaev_r_hoare_sort_simple_merge_tbb::HoareSortSimpleMergeTBB, double>(
+          "nikolaev_r_hoare_sort_simple_merge"),
+      MakeSortBenchmarkCase<petrov_a_radix_double_batcher_tbb::TestTaskParallelTbb, double>(
+          "petrov_a_radix_double_batcher"),
+      MakeSortBenchmarkCase<shlyakov_m_shell_sort_tbb::TestTaskTBB, int>("shlyakov_m_shell_sort"),
+      MakeSortBenchmarkCase<smirnov_i_radix_sort_simple_merge_tbb::TestTaskTBB, int>(
+          "smirnov_i_radix_sort_simple_merge"),
+      MakeSortBenchmarkCase<sotskov_a_shell_sorting_with_simple_merging_tbb::TestTaskTBB, int>(
+          "sotskov_a_shell_sorting_with_simple_merging"),
+      MakeSortBenchmarkCase<tsatsyn_a_radix_sort_simple_merge_tbb::TestTaskTBB, double>(
+          "tsatsyn_a_radix_sort_simple_merge"),
+      MakeSortBenchmarkCase<vershinina_a_hoare_sort_tbb::TestTaskTBB, double>("vershinina_a_hoare_sort_tbb"),
+      MakeSortBenchmarkCase<volochaev_s_shell_sort_with_batchers_even_odd_merge_tbb::ShellSortTBB, int>(
+          "volochaev_s_Shell_sort_with_Batchers_even-odd_merge"),
+  };
+
+  // Tasks known to crash on or missort some of the inputs; a problem of any other task fails the benchmark
+  const std::set<std::string> expected_failures = {
+      "gusev_n_sorting_int_simple_merging",
+      "mezhuev_m_bitwise_integer_sort_with_simple_merge",
+      "smirnov_i_radix_sort_simple_merge",
+      "tsatsyn_a_radix_sort_simple_merge",
+  };
+  const std::vector<std::string> problems = ppc::core::RunSortBenchmark("sort_benchmark_tbb", cases);
+  for (const auto &problem : problems) {
+    std::cout << "sort_benchmark_tbb: problem: " << problem << '\n';
+  }
+  EXPECT_TRUE(ppc::core::UnexpectedSortProblems(problems, expected_failures).empty());
+}
@@ -7,27 +7,12 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/sort/include/shell_sort.hpp"
 #include "core/util/include/util.hpp"
 
 void sotskov_a_shell_sorting_with_simple_merging_tbb::ShellSort(std::vector<int>& arr, int left, int right) {
-  int array_size = right - left + 1;
-  int gap = 1;
-  while (gap < array_size / 3) {
-    gap = gap * 3 + 1;
-  }
-
-  while (gap > 0) {
-    for (int i = left + gap; i <= right; ++i) {
-      int current_element = arr[i];
-      int j = i;
-      while (j >= left + gap && arr[j - gap] > current_element) {
-        arr[j] = arr[j - gap];
-        j -= gap;
-      }
-      arr[j] = current_element;
-    }
-    gap /= 3;
-  }
+  const auto array_size = static_cast<std::size_t>(right - left + 1);
+  ppc::sort::ShellSort(arr.data() + left, array_size, ppc::sort::MakeGaps(ppc::sort::GapSequence::kCiura, array_size));
 }
 
 void sotskov_a_shell_sorting_with_simple_merging_tbb::ParallelMerge(std::vector<int>& arr, int left, int mid,
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <oneapi/tbb/task_arena.h>
+
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/gemm.hpp"
+#include "core/linalg/include/parallel_for.hpp"
+#include "core/linalg/include/strassen.hpp"
+#include "core/perf/include/matmul_benchmark.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+using ppc::core::MatmulBenchmarkCase;
+using ppc::core::MatmulRun;
+
+constexpr std::size_t kNoSizeLimit = std::numeric_limits<std::size_t>::max();
+constexpr double kFloatTolerance = 1e-5;
+
+MatmulRun GemmRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::GemmWorkspace<double>>();
+  workspace->Reserve(size, size, size);
+  return [size, workspace](const double *a, const double *b, double *c) {
+    ppc::linalg::Gemm(size, size, size, 1.0, a, size, b, size, 0.0, c, size, *workspace, ppc::linalg::TbbFor{});
+  };
+}
+
+// Strassen levels one after another, each addition and leaf product a parallel loop of its own
+MatmulRun DataParallelRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::StrassenWorkspace<double>>();
+  workspace->Reserve(size, size, size);
+  return [size, workspace](const double *a, const double *b, double *c) {
+    ppc::linalg::StrassenWinograd(size, size, size, a, size, b, size, c, size, *workspace,
+                                  ppc::linalg::kStrassenLeafSize, ppc::linalg::TbbFor{});
+  };
+}
+
+// Float inputs; Acc = double is the mixed mode that only rounds the inputs and the result
+template <typename Acc>
+MatmulRun FloatGemmRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::GemmWorkspace<Acc>>();
+  workspace->Reserve(size, size, size);
+  return ppc::core::ConvertingRun<float, Acc>(size, [size, workspace](const float *a, const float *b, Acc *c) {
+    ppc::linalg::Gemm(size, size, size, Acc{1}, a, size, b, size, Acc{0}, c, size, *workspace,
+                      ppc::linalg::TbbFor{});
+  });
+}
+
+MatmulRun FloatDataParallelRun(std::size_t size) {
+  auto workspace = std::make_shared<ppc::linalg::StrassenWorkspace<float>>();
+  workspace->Reserve(size, size, size);
+  return ppc::core::ConvertingRun<float>(size, [size, workspace](const float *a, const float *b, float *c) {
+    ppc::linalg::StrassenWinograd(size, size, size, a, size, b, size, c, size, *workspace,
+                                  ppc::linalg::kStrassenLeafSize, ppc::linalg::TbbFor{});
+  });
+}
+
+MatmulBenchmarkCase TasksCase(std::size_t task_depth, std::size_t max_size) {
+  return {"strassen_tasks_depth" + std::to_string(task_depth),
+          [task_depth](std::size_t size) -> MatmulRun {
+            auto workspace = std::make_shared<ppc::linalg::StrassenWorkspace<double>>();
+            workspace->Reserve(size, size, size, ppc::linalg::kStrassenLeafSize, task_depth);
+            return [size, task_depth, workspace](const double *a, const double *b, double *c) {
+              ppc::linalg::StrassenWinogradTasks(size, size, size, a, size, b, size, c, size, *workspace,
+                                                 ppc::linalg::kStrassenLeafSize, task_depth,
+                                                 ppc::linalg::TbbFor{});
+            };
+          },
+          max_size};
+}
+
+// Runs the case inside an arena of the configured thread count, like the tbb tasks do
+MatmulBenchmarkCase InArena(MatmulBenchmarkCase matmul_case) {
+  matmul_case.prepare = [prepare = std::move(matmul_case.prepare)](std::size_t size) -> MatmulRun {
+    return [run = prepare(size)](const double *a, const double *b, double *c) {
+      oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+      arena.execute([&] { run(a, b, c); });
+    };
+  };
+  return matmul_case;
+}
+
+}  // namespace
+
+TEST(strassen_benchmark_tbb, task_dag_against_data_parallel) {
+  const std::vector<MatmulBenchmarkCase> cases = {
+      InArena({"gemm", GemmRun}),
+      InArena({"strassen_data_parallel", DataParallelRun}),
+      InArena(TasksCase(1, 8192)),
+      // About 10 n^2 doubles of scratch at depth 2
+      InArena(TasksCase(2, 4096)),
+      // Float results are compared with the double gemm, so they get a float tolerance
+      InArena({"gemm_float", FloatGemmRun<float>, kNoSizeLimit, kFloatTolerance}),
+      InArena({"gemm_mixed", FloatGemmRun<double>, kNoSizeLimit, kFloatTolerance}),
+      InArena({"strassen_float", FloatDataParallelRun, kNoSizeLimit, kFloatTolerance}),
+  };
+  const std::vector<std::string> problems = ppc::core::RunMatmulBenchmark("strassen_benchmark_tbb", cases);
+  for (const auto &problem : problems) {
+    std::cout << "strassen_benchmark_tbb: problem: " << problem << '\n';
+  }
+  EXPECT_TRUE(problems.empty());
+}